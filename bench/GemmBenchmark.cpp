@@ -0,0 +1,69 @@
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include "LiczbyWatkow.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+/*
+    Wydajność mnożenia macierzy gemm w GFLOP/s dla 1..maks. wątków,
+    z naiwną pętlą i-k-j jako punktem odniesienia.
+
+    Użycie: GemmBenchmark [n] [maks. liczba wątków]
+    Pomiary mają sens tylko dla kompilacji z optymalizacją
+    (cmake -DCMAKE_BUILD_TYPE=Release).
+*/
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+static numlib::Matrix randomMatrix(int n, unsigned seed) {
+    numlib::Matrix A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+    }
+    return A;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 2000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : static_cast<int>(thread::hardware_concurrency());
+    if (maxThreads < 1) maxThreads = 1;
+
+    numlib::Matrix A = randomMatrix(n, 1), B = randomMatrix(n, 2), C(n, n);
+    double flops = 2.0 * n * n * n;
+    cout << "n = " << n << ", SIMD: " << numlib::simd::levelName(numlib::simd::activeLevel()) << endl;
+    cout << fixed << setprecision(3);
+
+    auto t0 = Clock::now();
+    for (int i = 0; i < n; i++) {
+        double* c = C.row(i);
+        for (int p = 0; p < n; p++) {
+            double a = A(i, p);
+            const double* b = B.row(p);
+            for (int j = 0; j < n; j++) c[j] += a * b[j];
+        }
+    }
+    double tNaive = chrono::duration<double>(Clock::now() - t0).count();
+    cout << "pętla i-k-j        : " << tNaive << " s, " << flops / tNaive * 1e-9 << " GFLOP/s" << endl;
+
+    for (int threads : threadCounts(maxThreads)) {
+        numlib::setNumThreads(threads);
+        // Najlepszy z trzech pomiarów
+        double best = 1e300;
+        for (int rep = 0; rep < 3; rep++) {
+            t0 = Clock::now();
+            numlib::gemm(numlib::Op::None, numlib::Op::None, 1.0, A.view(), B.view(), 0.0, C.view());
+            best = min(best, chrono::duration<double>(Clock::now() - t0).count());
+        }
+        cout << "gemm, " << setw(3) << threads << " wątków : " << best << " s, "
+             << flops / best * 1e-9 << " GFLOP/s, przyspieszenie " << tNaive / best << "x" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/Watki.h"
+#include "LiczbyWatkow.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+/*
+    Porównanie czasu rozwiązania gęstego układu n x n:
+    - eliminacja Gaussa kolumna po kolumnie na vector<vector<double>>
+      (pętla z dotychczasowej funkcji Gauss, bez wypisywania),
+    - blokowy rozkład LU dla rosnącej liczby wątków,
+    - LU w pojedynczej precyzji z poprawianiem iteracyjnym (MixedLU),
+    - LU i rozkład Cholesky'ego dla macierzy symetrycznej dodatnio określonej.
+
+    Użycie: LUBenchmark [n] [maks. liczba wątków]
+    Pomiary mają sens tylko dla kompilacji z optymalizacją
+    (cmake -DCMAKE_BUILD_TYPE=Release).
+*/
+
+using Clock = chrono::steady_clock;
+
+static vector<double> columnGauss(vector<vector<double>> A, vector<double> b) {
+    int n = b.size();
+    for (int k = 0; k < n - 1; k++) {
+        int pivot_row = k;
+        for (int i = k + 1; i < n; i++) {
+            if (abs(A[i][k]) > abs(A[pivot_row][k])) pivot_row = i;
+        }
+        swap(A[k], A[pivot_row]);
+        swap(b[k], b[pivot_row]);
+        for (int i = k + 1; i < n; i++) {
+            double factor = A[i][k] / A[k][k];
+            for (int j = k; j < n; j++) {
+                A[i][j] -= factor * A[k][j];
+            }
+            b[i] -= factor * b[k];
+        }
+    }
+    vector<double> x(n);
+    for (int i = n - 1; i >= 0; i--) {
+        double sum = 0.0;
+        for (int j = i + 1; j < n; j++) sum += A[i][j] * x[j];
+        x[i] = (b[i] - sum) / A[i][i];
+    }
+    return x;
+}
+
+static double residual(const numlib::Matrix& A, const vector<double>& x, const vector<double>& b) {
+    double worst = 0.0;
+    for (size_t i = 0; i < A.rows(); i++) {
+        double sum = 0.0;
+        for (size_t j = 0; j < A.cols(); j++) sum += A(i, j) * x[j];
+        worst = max(worst, abs(sum - b[i]));
+    }
+    return worst;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 2000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : static_cast<int>(thread::hardware_concurrency());
+    if (maxThreads < 1) maxThreads = 1;
+
+    numlib::Matrix A(n, n);
+    vector<double> b(n);
+    unsigned seed = 2024;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+        b[i] = 1.0;
+    }
+
+    cout << "n = " << n << endl;
+
+    auto t0 = Clock::now();
+    auto xRef = columnGauss(A.toRows(), b);
+    double tRef = chrono::duration<double>(Clock::now() - t0).count();
+    cout << fixed << setprecision(3);
+    cout << "Gauss (kolumnowo)      : " << tRef << " s, residuum " << scientific
+         << residual(A, xRef, b) << fixed << endl;
+
+    double tSingle = 0.0;
+    for (int threads : threadCounts(maxThreads)) {
+        numlib::setNumThreads(threads);
+        t0 = Clock::now();
+        numlib::LU lu(A);
+        auto x = lu.solve(b);
+        double t = chrono::duration<double>(Clock::now() - t0).count();
+        if (threads == 1) tSingle = t;
+        cout << "LU blokowy, " << setw(3) << threads << " wątków: " << t << " s, przyspieszenie "
+             << tRef / t << "x (wzgl. 1 wątku " << tSingle / t << "x), residuum "
+             << scientific << residual(A, x, b) << fixed << endl;
+    }
+
+    t0 = Clock::now();
+    auto refined = numlib::MixedPrecisionSolve(A, b);
+    double tMixed = chrono::duration<double>(Clock::now() - t0).count();
+    cout << "LU float + poprawianie, " << maxThreads << " wątków: " << tMixed << " s, kroków "
+         << refined.iterations << (refined.fallback ? " (rozkład w double)" : "") << ", residuum "
+         << scientific << residual(A, refined.x, b) << fixed << endl;
+
+    // Macierz symetryczna z dominującą przekątną jest dodatnio określona
+    numlib::Matrix S(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) S(i, j) = A(i, j) + A(j, i);
+        S(i, i) += 2.0 * n;
+    }
+    t0 = Clock::now();
+    auto xLU = numlib::LU(S).solve(b);
+    double tLU = chrono::duration<double>(Clock::now() - t0).count();
+    t0 = Clock::now();
+    auto xChol = numlib::Cholesky(S).solve(b);
+    double tChol = chrono::duration<double>(Clock::now() - t0).count();
+    cout << "SPD, " << maxThreads << " wątków: LU " << tLU << " s, Cholesky " << tChol
+         << " s, przyspieszenie " << tLU / tChol << "x, residuum " << scientific
+         << residual(S, xChol, b) << fixed << endl;
+    return 0;
+}
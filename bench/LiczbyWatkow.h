@@ -0,0 +1,10 @@
+#pragma once
+#include <vector>
+
+// Liczby wątków do pomiaru skalowania: potęgi dwójki mniejsze od maxThreads, na końcu maxThreads
+inline std::vector<int> threadCounts(int maxThreads) {
+    std::vector<int> counts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) counts.push_back(threads);
+    counts.push_back(maxThreads < 1 ? 1 : maxThreads);
+    return counts;
+}
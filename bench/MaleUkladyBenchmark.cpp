@@ -0,0 +1,121 @@
+#include "../include/numlib/UkladyWsadowe.h"
+#include "../include/numlib/MaleUklady.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include "LiczbyWatkow.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <thread>
+
+/*
+    Porównanie rozwiązywania wielu małych układów n x n (n = 3, 6, 9, 12):
+    - GaussSolve wywoływany osobno dla każdego układu,
+    - fixed::solve<N> (rozmiar w czasie kompilacji, bez alokacji) osobno
+      dla każdego układu,
+    - SolveSmallBatched (struktura tablic, wektoryzacja po układach)
+      dla rosnącej liczby wątków.
+    Wydajność podana jest w GFLOP/s przy koszcie 2n³/3 + 2n² operacji na układ.
+
+    Użycie: MaleUkladyBenchmark [liczba układów] [maks. liczba wątków]
+    Pomiary mają sens tylko dla kompilacji z optymalizacją
+    (cmake -DCMAKE_BUILD_TYPE=Release).
+*/
+
+using Clock = chrono::steady_clock;
+
+// Rozwiązuje kolejno wszystkie układy przez fixed::solve<N>; zwraca czas i rozwiązanie pierwszego.
+// Układy są najpierw przepisywane do tablicy std::array, więc mierzony jest tylko solver.
+template<size_t N>
+static double timeFixed(const vector<double>& A, const vector<double>& b, size_t batch, vector<double>& first) {
+    vector<numlib::fixed::Mat<N>> systems(batch);
+    vector<numlib::fixed::Vec<N>> rhs(batch);
+    for (size_t s = 0; s < batch; s++) {
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = 0; j < N; j++) systems[s][i][j] = A[(i * N + j) * batch + s];
+            rhs[s][i] = b[i * batch + s];
+        }
+    }
+    auto t0 = Clock::now();
+    for (size_t s = 0; s < batch; s++) {
+        numlib::fixed::solveInPlace(systems[s], rhs[s]);
+    }
+    double t = chrono::duration<double>(Clock::now() - t0).count();
+    first.assign(rhs[0].begin(), rhs[0].end());
+    return t;
+}
+
+static double timeFixed(int n, const vector<double>& A, const vector<double>& b, size_t batch, vector<double>& first) {
+    switch (n) {
+        case 3: return timeFixed<3>(A, b, batch, first);
+        case 6: return timeFixed<6>(A, b, batch, first);
+        case 9: return timeFixed<9>(A, b, batch, first);
+        default: return timeFixed<12>(A, b, batch, first);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t batch = argc > 1 ? atol(argv[1]) : 200000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : static_cast<int>(thread::hardware_concurrency());
+    if (maxThreads < 1) maxThreads = 1;
+
+    cout << "układów: " << batch << ", SIMD: " << numlib::simd::levelName(numlib::simd::activeLevel()) << endl;
+    cout << fixed << setprecision(2);
+
+    for (int n : {3, 6, 9, 12}) {
+        vector<double> A(n * n * batch), b(n * batch);
+        unsigned seed = 77;
+        for (size_t k = 0; k < A.size(); k++) {
+            seed = seed * 1103515245u + 12345u;
+            A[k] = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+        for (size_t s = 0; s < batch; s++) {
+            for (int i = 0; i < n; i++) A[(i * n + i) * batch + s] += n;
+        }
+        for (size_t k = 0; k < b.size(); k++) b[k] = 1.0 + k % 3;
+        double flops = (2.0 * n * n * n / 3.0 + 2.0 * n * n) * batch;
+
+        auto t0 = Clock::now();
+        numlib::Matrix M(n, n);
+        vector<double> rhs(n);
+        vector<double> first;
+        for (size_t s = 0; s < batch; s++) {
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) M(i, j) = A[(i * n + j) * batch + s];
+                rhs[i] = b[i * batch + s];
+            }
+            auto x = numlib::GaussSolve(M, rhs);
+            if (s == 0) first = x;
+        }
+        double tRef = chrono::duration<double>(Clock::now() - t0).count();
+        cout << "n = " << setw(2) << n << ": GaussSolve pojedynczo " << tRef * 1e3 << " ms ("
+             << flops / tRef * 1e-9 << " GFLOP/s)" << endl;
+
+        vector<double> fixedFirst;
+        double tFixed = timeFixed(n, A, b, batch, fixedFirst);
+        double fixedDiff = 0.0;
+        for (int i = 0; i < n; i++) fixedDiff = max(fixedDiff, abs(fixedFirst[i] - first[i]));
+        cout << "        fixed::solve<" << n << "> pojedynczo " << tFixed * 1e3 << " ms ("
+             << flops / tFixed * 1e-9 << " GFLOP/s), przyspieszenie " << tRef / tFixed << "x, różnica "
+             << scientific << fixedDiff << fixed << endl;
+
+        double tSingle = 0.0;
+        for (int threads : threadCounts(maxThreads)) {
+            numlib::setNumThreads(threads);
+            vector<double> x(b);
+            t0 = Clock::now();
+            numlib::SolveSmallBatched(n, batch, A, x);
+            double t = chrono::duration<double>(Clock::now() - t0).count();
+            if (threads == 1) tSingle = t;
+            double diff = 0.0;
+            for (int i = 0; i < n; i++) diff = max(diff, abs(x[i * batch] - first[i]));
+            cout << "        wsadowo, " << setw(3) << threads << " wątków: " << t * 1e3 << " ms ("
+                 << flops / t * 1e-9 << " GFLOP/s), przyspieszenie " << tRef / t << "x (wzgl. 1 wątku "
+                 << tSingle / t << "x), różnica " << scientific << diff
+                 << fixed << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include "../include/numlib/WartosciWlasne.h"
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/*
+    Czas rozkładu własnego losowej macierzy symetrycznej n x n dla
+    n = 100 ... 4000 (lub rozmiarów podanych w wierszu poleceń):
+    - cykliczna metoda Jacobiego jako punkt odniesienia (tylko n <= 500),
+    - redukcja do postaci trójdiagonalnej,
+    - same wartości własne (redukcja + QL),
+    - wszystkie wartości i wektory (redukcja + "dziel i zwyciężaj" + Q Z),
+    - 10% najmniejszych wartości z wektorami (bisekcja + odwrotna iteracja),
+    dla 1 wątku i maksymalnej liczby wątków.
+
+    Użycie: SymmetricEigenBenchmark [maks. liczba wątków] [n1 n2 ...]
+    Pomiary mają sens tylko dla kompilacji z optymalizacją
+    (cmake -DCMAKE_BUILD_TYPE=Release).
+*/
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+static numlib::Matrix randomSymmetric(int n, unsigned seed) {
+    numlib::Matrix A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = A(j, i) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+    }
+    return A;
+}
+
+// Cykliczna metoda Jacobiego (same wartości), zakończenie przy normie poza przekątną < 1e-12 ||A||
+static vector<double> jacobiEigenvalues(numlib::Matrix A) {
+    int n = static_cast<int>(A.rows());
+    double total = 0.0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) total += A(i, j) * A(i, j);
+    }
+    for (int sweep = 0; sweep < 50; sweep++) {
+        double off = 0.0;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                if (i != j) off += A(i, j) * A(i, j);
+            }
+        }
+        if (off <= 1e-24 * total) break;
+        for (int p = 0; p < n - 1; p++) {
+            for (int q = p + 1; q < n; q++) {
+                if (A(p, q) == 0.0) continue;
+                double theta = (A(q, q) - A(p, p)) / (2.0 * A(p, q));
+                double t = copysign(1.0, theta) / (abs(theta) + sqrt(theta * theta + 1.0));
+                double c = 1.0 / sqrt(t * t + 1.0), s = t * c;
+                for (int k = 0; k < n; k++) {
+                    double akp = A(k, p), akq = A(k, q);
+                    A(k, p) = c * akp - s * akq;
+                    A(k, q) = s * akp + c * akq;
+                }
+                for (int k = 0; k < n; k++) {
+                    double apk = A(p, k), aqk = A(q, k);
+                    A(p, k) = c * apk - s * aqk;
+                    A(q, k) = s * apk + c * aqk;
+                }
+            }
+        }
+    }
+    vector<double> values(n);
+    for (int i = 0; i < n; i++) values[i] = A(i, i);
+    sort(values.begin(), values.end());
+    return values;
+}
+
+// max |A V - V diag(values)| / max |A|
+static double residual(const numlib::Matrix& A, const numlib::EigenDecomposition& r) {
+    numlib::Matrix AV = numlib::multiply(A, r.vectors);
+    double worst = 0.0, norm = 0.0;
+    for (size_t i = 0; i < AV.rows(); i++) {
+        for (size_t j = 0; j < AV.cols(); j++) {
+            worst = max(worst, abs(AV(i, j) - r.vectors(i, j) * r.values[j]));
+        }
+        for (size_t j = 0; j < A.cols(); j++) norm = max(norm, abs(A(i, j)));
+    }
+    return worst / norm;
+}
+
+template <typename F>
+static double seconds(F f) {
+    auto t0 = Clock::now();
+    f();
+    return chrono::duration<double>(Clock::now() - t0).count();
+}
+
+int main(int argc, char** argv) {
+    int maxThreads = argc > 1 ? atoi(argv[1]) : static_cast<int>(thread::hardware_concurrency());
+    if (maxThreads < 1) maxThreads = 1;
+    vector<int> sizes;
+    for (int i = 2; i < argc; i++) sizes.push_back(atoi(argv[i]));
+    if (sizes.empty()) sizes = {100, 250, 500, 1000, 2000, 4000};
+
+    cout << fixed << setprecision(3);
+    for (int n : sizes) {
+        numlib::Matrix A = randomSymmetric(n, static_cast<unsigned>(n));
+        cout << "\nn = " << n << endl;
+
+        if (n <= 500) {
+            vector<double> reference;
+            double t = seconds([&] { reference = jacobiEigenvalues(A); });
+            numlib::EigenDecomposition values = numlib::SymmetricEigen(A, false);
+            double diff = 0.0;
+            for (int i = 0; i < n; i++) diff = max(diff, abs(reference[i] - values.values[i]));
+            cout << "Jacobi cykliczny (wartości)     : " << t << " s, różnica wartości "
+                 << scientific << diff << fixed << endl;
+        }
+
+        for (int threads = 1;; threads = maxThreads) {
+            numlib::setNumThreads(threads);
+            numlib::EigenDecomposition values, full, part;
+            double tTri = seconds([&] { numlib::Tridiagonalization tri(A); });
+            double tValues = seconds([&] { values = numlib::SymmetricEigen(A, false); });
+            double tFull = seconds([&] { full = numlib::SymmetricEigen(A); });
+            size_t count = max<size_t>(1, n / 10);
+            double tPart = seconds([&] { part = numlib::SymmetricEigenIndex(A, 0, count - 1); });
+            cout << setw(3) << threads << " wątków: redukcja " << tTri << " s, wartości " << tValues
+                 << " s, wartości i wektory " << tFull << " s, " << count << " najmniejszych z wektorami "
+                 << tPart << " s" << endl;
+            cout << "            residuum: pełny " << scientific << residual(A, full)
+                 << ", część widma " << residual(A, part) << fixed << endl;
+            if (threads == maxThreads) break;
+        }
+    }
+    numlib::setNumThreads(0);
+    return 0;
+}
@@ -130,6 +130,17 @@ namespace numlib {
          * @return true jeśli sukces, false w przeciwnym razie
          */
         bool approximate();
+
+        /**
+         * @brief Przeprowadza dyskretną aproksymację średniokwadratową w punktach danych
+         *
+         * Współczynniki minimalizują sumę kwadratów błędów w punktach danych.
+         * Zadanie rozwiązywane jest rozkładem QR z wyborem kolumn macierzy
+         * A(i, j) = φ_j(x_i), bez równań normalnych, więc wskaźnik uwarunkowania
+         * nie jest podnoszony do kwadratu.
+         * @return true jeśli sukces, false w przeciwnym razie
+         */
+        bool approximateDiscrete();
         
         /**
          * @brief Oblicza wartość aproksymacji w punkcie x
@@ -149,6 +160,17 @@ namespace numlib {
          * @return wartość błędu
          */
         double computeError() const;
+
+        /**
+         * @brief Wskaźnik uwarunkowania macierzy Grama: lambda_max / lambda_min
+         *
+         * Macierz Grama składana jest tak jak w approximate(), a jej wartości
+         * własne liczone przez SymmetricEigen. Duża wartość oznacza prawie
+         * liniowo zależne funkcje bazowe na przedziale [a, b]. Gdy najmniejsza
+         * wartość własna nie jest dodatnia, zwracana jest nieskończoność.
+         * @throw runtime_error gdy brak funkcji bazowych
+         */
+        double gramConditionNumber() const;
         
         /**
          * @brief Czyści dane
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "Macierz.h"
+#include "MacierzRzadka.h"
+#include "MetodyKrylowa.h"
+
+namespace numlib {
+
+    /**
+     * @brief Eksponenta macierzy e^A metodą skalowania i potęgowania z aproksymacją Padé
+     *
+     * Algorytm Highama (2005): stopień aproksymacji Padé (3, 5, 7, 9 lub 13)
+     * dobierany jest według ||A||_1 tak, by błąd był na poziomie precyzji
+     * arytmetyki; dla dużych norm A dzielona jest przez 2^s, a wynik
+     * podnoszony s razy do kwadratu. Koszt to kilka iloczynów macierzy
+     * (gemm) i jeden rozkład LU z wieloma prawymi stronami.
+     *
+     * @throw invalid_argument dla macierzy niekwadratowej lub zawierającej NaN/Inf
+     */
+    Matrix expm(ConstMatrixView A);
+
+    /**
+     * @brief Działanie eksponenty na wektor: e^{tA} v bez tworzenia e^{tA}
+     *
+     * Metoda Kryłowa z krokami w czasie (jak expv z pakietu Expokit): dla
+     * bazy Arnoldiego V_m z wektora bieżącego e^{tau A} w ~ beta V_m e^{tau H_m} e_1,
+     * gdzie e^{tau H_m} to expm małej macierzy (m + 2) x (m + 2) uzupełnionej
+     * o składniki do szacowania błędu. Krok tau jest dobierany według
+     * oszacowania błędu lokalnego, a przy odrzuceniu zmniejszany bez
+     * ponownego budowania bazy. Potrzebne jest tylko mnożenie A x, więc
+     * pamięć to O(n m) - metoda nadaje się dla dużych macierzy rzadkich.
+     *
+     * @param tolerance dopuszczalny błąd względem ||v|| na jednostkę czasu
+     * @param subspace wymiar podprzestrzeni Kryłowa m
+     * @throw invalid_argument dla nieprawidłowych parametrów
+     * @throw runtime_error gdy krok nie spełnia tolerancji mimo zmniejszania
+     */
+    std::vector<double> expmMultiply(const LinearOperator& A, const std::vector<double>& v, double t,
+                                     double tolerance = 1e-10, int subspace = 30);
+    std::vector<double> expmMultiply(const SparseMatrix& A, const std::vector<double>& v, double t,
+                                     double tolerance = 1e-10, int subspace = 30);
+
+    /**
+     * @brief e^{t_k A} v dla wielu chwil t_k (niemalejących, >= 0) w jednym przebiegu
+     *
+     * Chwile wypadające wewnątrz przyjętego kroku liczone są z tej samej
+     * bazy Kryłowa (jedno expm małej macierzy na chwilę), więc koszt jest
+     * prawie taki jak jednego wywołania dla t = max t_k, a nie sumą kosztów
+     * osobnych wywołań.
+     *
+     * @return macierz: wiersz k to e^{t_k A} v
+     */
+    Matrix expmMultiply(const LinearOperator& A, const std::vector<double>& v, const std::vector<double>& times,
+                        double tolerance = 1e-10, int subspace = 30);
+    Matrix expmMultiply(const SparseMatrix& A, const std::vector<double>& v, const std::vector<double>& times,
+                        double tolerance = 1e-10, int subspace = 30);
+
+    /**
+     * @brief Układ liniowy o stałych współczynnikach y' = A y na siatce t0 + k h
+     *
+     * Odpowiednik RungegKutty dla układów liniowych, ale bez błędu
+     * dyskretyzacji: E = e^{hA} liczona jest raz, a każdy krok to jedno
+     * mnożenie y_{k+1} = E y_k.
+     *
+     * @return (chwile t0 .. t0 + n h, macierz (n + 1) x dim ze stanami w wierszach)
+     * @throw invalid_argument dla n <= 0, h <= 0 lub niezgodnych wymiarów
+     */
+    std::pair<std::vector<double>, Matrix> LinearODE(ConstMatrixView A, const std::vector<double>& y0,
+                                                     double t0, double h, int n);
+
+} // namespace numlib
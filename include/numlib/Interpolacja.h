@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <iostream>
+#include "Macierz.h"
 
 using namespace std;
 
@@ -8,4 +9,130 @@ namespace numlib {
 	double Newton(const vector<double>& XIN, const vector<double>& coeffs, double x);
 
 	vector<double> DividedDiff(const vector<double>& XIN, const vector<double>& FXIN);
+
+	/**
+	 * @brief Wartoci wielomianu Newtona (wspczynniki z DividedDiff) w wielu punktach naraz
+	 *
+	 * W przeciwiestwie do Newton nic nie wypisuje. Kady punkt liczony jest
+	 * schematem Hornera c_{n-1} -> r (x - x_i) + c_i w O(n), wektorowo po
+	 * punktach (simd::newtonHorner); due paczki dzielone s midzy wtki.
+	 * out moe wskazywa na t sam pami co x.
+	 *
+	 * @throw invalid_argument przy niezgodnych dugociach XIN i coeffs lub x i out
+	 */
+	void NewtonEvaluate(const vector<double>& XIN, const vector<double>& coeffs,
+	                    Span<const double> x, Span<double> out);
+	vector<double> NewtonEvaluate(const vector<double>& XIN, const vector<double>& coeffs, const vector<double>& x);
+
+	/**
+	 * @brief Wielomian interpolacyjny Newtona budowany przyrostowo z napywajcych wzw
+	 *
+	 * Przechowywana jest tylko ostatnia przektna tablicy ilorazw rnicowych,
+	 * czyli posta Newtona z wzami od najnowszego: c_k = f[x_n, x_{n-1}, ..., x_{n-k}].
+	 * Dodanie wza to O(n) zamiast O(n^2) dla DividedDiff na caym zbiorze,
+	 * a usunicie najstarszego wza odcina tylko skadnik najwyszego rzdu
+	 * (O(1), bez utraty dokadnoci). Przy ograniczonym oknie najstarszy wze
+	 * usuwany jest automatycznie - wygodne dla danych napywajcych na bieco.
+	 */
+	class NewtonInterpolator {
+	private:
+		vector<double> xs;        // wzy od najnowszego
+		vector<double> diagonal;  // wspczynniki postaci Newtona dla wzw xs
+		size_t capacity;          // 0 - bez ograniczenia
+	public:
+		/**
+		 * @param window maksymalna liczba wzw (0 - bez ograniczenia)
+		 */
+		explicit NewtonInterpolator(size_t window = 0) : capacity(window) {}
+
+		/**
+		 * @brief Dodaje wze (x, fx) w O(n); przy penym oknie usuwa najstarszy
+		 * @throw invalid_argument gdy x pokrywa si z jednym z pozostajcych wzw
+		 */
+		void addNode(double x, double fx);
+
+		/**
+		 * @brief Usuwa najstarszy wze
+		 * @throw runtime_error gdy brak wzw
+		 */
+		void removeOldest();
+
+		void clear();
+
+		size_t size() const { return xs.size(); }
+		size_t window() const { return capacity; }
+
+		// Wzy i wspczynniki w kolejnoci od najnowszego - zgodne z NewtonEvaluate
+		const vector<double>& nodes() const { return xs; }
+		const vector<double>& coefficients() const { return diagonal; }
+
+		/**
+		 * @brief Warto wielomianu w punkcie x (0 dla pustego interpolatora)
+		 */
+		double operator()(double x) const;
+
+		/**
+		 * @brief Wartoci w wielu punktach - jak NewtonEvaluate
+		 */
+		void evaluate(Span<const double> x, Span<double> out) const;
+		vector<double> evaluate(const vector<double>& x) const;
+	};
+
+	/**
+	 * @brief Rodzaj wzw Czebyszewa: First - zera T_n, Second - ekstrema T_{n-1} (z kocami przedziau)
+	 */
+	enum class ChebyshevKind { First, Second };
+
+	/**
+	 * @brief Interpolacja Lagrange'a we wzorze barycentrycznym
+	 *
+	 * p(x) = sum w_j f_j / (x - x_j) / sum w_j / (x - x_j). Wagi w_j zale
+	 * tylko od wzw: dla dowolnych liczone s raz w O(n^2), dla wzw
+	 * Czebyszewa znane s jawnie (O(n)). Warto w punkcie kosztuje O(n),
+	 * zmiana wartoci funkcji przy tych samych wzach te O(n) - bez
+	 * przeliczania wag. Wzr jest stabilny numerycznie take dla wysokich
+	 * stopni; na wzach Czebyszewa nie wystpuje zjawisko Rungego.
+	 */
+	class BarycentricInterpolator {
+	private:
+		vector<double> xs;
+		vector<double> w;
+		vector<double> fs;
+
+		BarycentricInterpolator(vector<double> nodes, vector<double> weights, vector<double> values)
+			: xs(move(nodes)), w(move(weights)), fs(move(values)) {}
+	public:
+		/**
+		 * @brief Wagi dla dowolnych parami rnych wzw w O(n^2)
+		 * @throw invalid_argument dla pustego zbioru, niezgodnych dugoci lub powtrzonych wzw
+		 */
+		BarycentricInterpolator(const vector<double>& nodes, const vector<double>& values);
+
+		/**
+		 * @brief n wzw Czebyszewa na [a, b] z wagami w postaci jawnej; wartoci rwne 0 do czasu setValues
+		 * @throw invalid_argument dla n == 0, n == 1 przy drugim rodzaju lub a >= b
+		 */
+		static BarycentricInterpolator chebyshev(size_t n, double a, double b,
+		                                         ChebyshevKind kind = ChebyshevKind::Second);
+
+		/**
+		 * @brief Nowe wartoci funkcji w tych samych wzach (O(n))
+		 * @throw invalid_argument przy niezgodnej dugoci
+		 */
+		void setValues(const vector<double>& values);
+
+		size_t size() const { return xs.size(); }
+		const vector<double>& nodes() const { return xs; }
+		const vector<double>& weights() const { return w; }
+		const vector<double>& values() const { return fs; }
+
+		double operator()(double x) const;
+
+		/**
+		 * @brief Wartoci w wielu punktach: wektorowo po punktach (simd::barycentric), due paczki na wtkach
+		 * @throw invalid_argument przy niezgodnych dugociach x i out
+		 */
+		void evaluate(Span<const double> x, Span<double> out) const;
+		vector<double> evaluate(const vector<double>& x) const;
+	};
 }
\ No newline at end of file
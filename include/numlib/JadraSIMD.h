@@ -0,0 +1,101 @@
+#pragma once
+#include <cstddef>
+
+namespace numlib {
+
+    /**
+     * @brief Poziomy instrukcji wektorowych, dla których istnieją wersje jąder
+     */
+    enum class SimdLevel {
+        Scalar,
+        SSE2,
+        AVX2,    // AVX2 + FMA
+        AVX512   // AVX-512F
+    };
+
+    /**
+     * @brief Jądra obliczeniowe algebry liniowej z wyborem wersji w czasie działania
+     *
+     * Przy pierwszym użyciu wykrywany jest najwyższy poziom SIMD obsługiwany przez
+     * procesor (CPUID), więc ten sam plik wykonywalny działa na różnych maszynach.
+     * Wszystkie solvery biblioteki korzystają z tych samych jąder.
+     */
+    namespace simd {
+
+        /**
+         * @brief y[i] += a * x[i] dla i < n
+         */
+        void axpy(std::size_t n, double a, const double* x, double* y);
+
+        /**
+         * @brief Zwraca sumę x[i] * y[i] dla i < n
+         */
+        double dot(std::size_t n, const double* x, const double* y);
+
+        /**
+         * @brief y[p] = wartość wielomianu w postaci Newtona w punkcie x[p] dla p < m
+         *
+         * Wielomian c_0 + c_1 (x - x_0) + ... + c_{n-1} (x - x_0)...(x - x_{n-2})
+         * liczony jest schematem Hornera r = r (x - x_i) + c_i; wektoryzacja
+         * przebiega po punktach. y może być tą samą tablicą co x.
+         */
+        void newtonHorner(std::size_t n, const double* nodes, const double* coeffs,
+                          std::size_t m, const double* x, double* y);
+
+        /**
+         * @brief y[p] = sum w_j f_j / (x[p] - x_j) / sum w_j / (x[p] - x_j) dla p < m
+         *
+         * Druga (właściwa) postać wzoru barycentrycznego dla n >= 1 węzłów;
+         * gdy x[p] jest równy węzłowi x_j, wynikiem jest f_j. Wektoryzacja
+         * przebiega po punktach. y może być tą samą tablicą co x.
+         */
+        void barycentric(std::size_t n, const double* nodes, const double* weights, const double* values,
+                         std::size_t m, const double* x, double* y);
+
+        /**
+         * @brief C -= L * U dla bloków zapisanych wierszami
+         *
+         * C ma wymiary m x n, L - m x k, U - k x n; ldc, ldl, ldu to odstępy
+         * między wierszami. Jest to aktualizacja rzędu k używana przez blokowe
+         * rozkłady macierzy.
+         */
+        void rankUpdate(std::size_t m, std::size_t n, std::size_t k,
+                        const double* L, std::size_t ldl,
+                        const double* U, std::size_t ldu,
+                        double* C, std::size_t ldc);
+
+        /**
+         * @brief Wersje pojedynczej precyzji axpy i rankUpdate
+         *
+         * Rejestr mieści dwa razy więcej elementów float niż double, więc rozkład
+         * LU w pojedynczej precyzji wykonuje się około dwa razy szybciej.
+         */
+        void axpy(std::size_t n, float a, const float* x, float* y);
+        void rankUpdate(std::size_t m, std::size_t n, std::size_t k,
+                        const float* L, std::size_t ldl,
+                        const float* U, std::size_t ldu,
+                        float* C, std::size_t ldc);
+
+        /**
+         * @brief Najwyższy poziom SIMD obsługiwany przez procesor
+         */
+        SimdLevel detectedLevel();
+
+        /**
+         * @brief Aktualnie używany poziom SIMD
+         */
+        SimdLevel activeLevel();
+
+        /**
+         * @brief Wymusza wersję jąder (np. do testów porównawczych)
+         * @return false jeśli procesor nie obsługuje danego poziomu
+         */
+        bool setLevel(SimdLevel level);
+
+        /**
+         * @brief Nazwa poziomu SIMD do wyświetlenia
+         */
+        const char* levelName(SimdLevel level);
+    }
+
+} // namespace numlib
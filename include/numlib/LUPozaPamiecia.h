@@ -0,0 +1,97 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <string>
+#include "Macierz.h"
+#include "PlikMapowany.h"
+
+namespace numlib {
+
+    /**
+     * @brief Rozkład PA = LU macierzy większej niż pamięć RAM (out-of-core)
+     *
+     * Macierz n x n przechowywana jest w pliku odwzorowanym w pamięć jako
+     * kwadratowe kafelki tileSize x tileSize. Kafelki jednej kolumny blokowej
+     * leżą w pliku jeden za drugim, więc kolumna blokowa jest ciągłym
+     * fragmentem pliku.
+     *
+     * Rozkład jest lewostronny (left-looking): kolumna blokowa J jest
+     * aktualizowana kolejno wszystkimi wcześniejszymi kolumnami L, a następnie
+     * rozkładana z częściowym wyborem elementu głównego. W każdym kroku w pamięci
+     * potrzebne są tylko bieżąca kolumna blokowa i czytana sekwencyjnie kolumna L.
+     * Następna kolumna do odczytu jest zlecana systemowi z wyprzedzeniem
+     * (MappedFile::prefetch), więc odczyt z dysku nakłada się z obliczeniami.
+     *
+     * Zamiany wierszy z kolumny blokowej K nie są przenoszone do wcześniejszych
+     * kolumn L (jak w LINPACK), bo wymagałoby to ponownego zapisu całego pliku;
+     * solveInPlace stosuje je w tej samej kolejności co rozkład. Aktualizacje
+     * wykonywane są na puli wątków, a wynik nie zależy od liczby wątków.
+     *
+     * Plik nie jest usuwany po zniszczeniu obiektu.
+     */
+    class OutOfCoreLU {
+    private:
+        MappedFile storage;
+        std::size_t n = 0;
+        std::size_t tile = 0;
+        std::size_t tiles = 0;      // liczba kafelków w wierszu i kolumnie
+        std::vector<int> piv;       // piv[k] - wiersz zamieniony z wierszem k w kroku k
+        bool factored = false;
+
+        double* blockColumn(std::size_t J) const;
+        void prefetchColumn(std::size_t J, std::size_t firstRow) const;
+        void updatePanel(std::size_t J, std::size_t K);
+
+    public:
+        static constexpr std::size_t DEFAULT_TILE_SIZE = 256;
+
+        /**
+         * @brief Tworzy plik na macierz n x n (początkowo zerową)
+         * @throw runtime_error gdy pliku nie można utworzyć
+         */
+        OutOfCoreLU(const std::string& path, std::size_t n, std::size_t tileSize = DEFAULT_TILE_SIZE);
+
+        /**
+         * @brief Kopiuje A do pliku i od razu ją rozkłada
+         */
+        OutOfCoreLU(const std::string& path, ConstMatrixView A, std::size_t tileSize = DEFAULT_TILE_SIZE);
+
+        std::size_t size() const { return n; }
+        std::size_t tileSize() const { return tile; }
+        std::size_t tileCount() const { return tiles; }
+        bool isFactored() const { return factored; }
+        const std::vector<int>& pivots() const { return piv; }
+
+        /**
+         * @brief Widok kafelka (I, J) w pliku, np. do wypełnienia macierzy przed rozkładem
+         *
+         * Kafelki z ostatniego wiersza i kolumny są odpowiednio mniejsze.
+         */
+        MatrixView tileView(std::size_t I, std::size_t J);
+
+        /**
+         * @brief Zapisuje wiersz i macierzy (n elementów)
+         */
+        void setRow(std::size_t i, Span<const double> values);
+
+        /**
+         * @brief Rozkłada macierz zapisaną w pliku
+         * @throw runtime_error dla macierzy osobliwej
+         */
+        void factorize();
+
+        /**
+         * @brief Rozwiązuje Ax = b, nadpisując b rozwiązaniem
+         */
+        void solveInPlace(Span<double> b) const;
+
+        /**
+         * @brief Rozwiązuje AX = B dla wielu prawych stron (kolumny B), nadpisując B
+         */
+        void solveInPlace(MatrixView B) const;
+
+        std::vector<double> solve(const std::vector<double>& b) const;
+        Matrix solve(ConstMatrixView B) const;
+    };
+
+} // namespace numlib
@@ -0,0 +1,212 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace numlib {
+
+    /**
+     * @brief Wyrównanie bufora macierzy w bajtach (linia cache / rejestr AVX-512)
+     */
+    constexpr std::size_t MATRIX_ALIGNMENT = 64;
+
+    /**
+     * @brief Alokator zwracający pamięć wyrównaną do MATRIX_ALIGNMENT
+     */
+    template <typename T>
+    struct AlignedAllocator {
+        using value_type = T;
+
+        AlignedAllocator() noexcept = default;
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n) {
+            if (n == 0) return nullptr;
+            std::size_t bytes = n * sizeof(T);
+            bytes = (bytes + MATRIX_ALIGNMENT - 1) / MATRIX_ALIGNMENT * MATRIX_ALIGNMENT;
+            void* p = ::operator new(bytes, std::align_val_t(MATRIX_ALIGNMENT));
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, std::size_t) noexcept {
+            ::operator delete(p, std::align_val_t(MATRIX_ALIGNMENT));
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U>&) const noexcept { return true; }
+        template <typename U>
+        bool operator!=(const AlignedAllocator<U>&) const noexcept { return false; }
+    };
+
+    /**
+     * @brief Nieposiadający widok ciągłego fragmentu pamięci (odpowiednik std::span)
+     */
+    template <typename T>
+    class Span {
+    private:
+        T* ptr = nullptr;
+        std::size_t len = 0;
+    public:
+        Span() = default;
+        Span(T* data, std::size_t size) : ptr(data), len(size) {}
+        template <typename Alloc>
+        Span(std::vector<std::remove_const_t<T>, Alloc>& v) : ptr(v.data()), len(v.size()) {}
+        template <typename Alloc, typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+        Span(const std::vector<std::remove_const_t<T>, Alloc>& v) : ptr(v.data()), len(v.size()) {}
+        template <typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+        Span(const Span<U>& other) : ptr(other.data()), len(other.size()) {}
+
+        T* data() const { return ptr; }
+        std::size_t size() const { return len; }
+        bool empty() const { return len == 0; }
+        T& operator[](std::size_t i) const { return ptr[i]; }
+        T* begin() const { return ptr; }
+        T* end() const { return ptr + len; }
+        Span subspan(std::size_t offset, std::size_t count) const { return Span(ptr + offset, count); }
+    };
+
+    /**
+     * @brief Widok prostokątnego bloku macierzy gęstej w układzie wierszowym
+     *
+     * Element (i, j) leży pod adresem data + i * stride + j. Widok nie posiada
+     * pamięci, więc może opisywać podmacierz większej macierzy.
+     */
+    template <typename T>
+    class MatrixViewT {
+    private:
+        T* ptr = nullptr;
+        std::size_t nrows = 0, ncols = 0, ld = 0;
+    public:
+        MatrixViewT() = default;
+        MatrixViewT(T* data, std::size_t rows, std::size_t cols, std::size_t stride)
+            : ptr(data), nrows(rows), ncols(cols), ld(stride) {}
+        template <typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+        MatrixViewT(const MatrixViewT<U>& other)
+            : ptr(other.data()), nrows(other.rows()), ncols(other.cols()), ld(other.stride()) {}
+
+        T* data() const { return ptr; }
+        std::size_t rows() const { return nrows; }
+        std::size_t cols() const { return ncols; }
+        std::size_t stride() const { return ld; }
+
+        T& operator()(std::size_t i, std::size_t j) const { return ptr[i * ld + j]; }
+        T* row(std::size_t i) const { return ptr + i * ld; }
+        Span<T> rowSpan(std::size_t i) const { return Span<T>(row(i), ncols); }
+
+        /**
+         * @brief Zwraca widok podmacierzy o lewym górnym rogu (i, j)
+         */
+        MatrixViewT block(std::size_t i, std::size_t j, std::size_t r, std::size_t c) const {
+            return MatrixViewT(ptr + i * ld + j, r, c, ld);
+        }
+    };
+
+    using MatrixView = MatrixViewT<double>;
+    using ConstMatrixView = MatrixViewT<const double>;
+
+    /**
+     * @brief Macierz gęsta przechowywana wierszami w jednym, wyrównanym buforze
+     *
+     * Długość wiersza w pamięci (stride) jest zaokrąglana w górę do wielokrotności
+     * MATRIX_ALIGNMENT, dzięki czemu każdy wiersz zaczyna się na granicy linii cache.
+     */
+    template <typename T>
+    class MatrixT {
+    private:
+        std::vector<T, AlignedAllocator<T>> buffer;
+        std::size_t nrows = 0, ncols = 0, ld = 0;
+
+        static std::size_t paddedStride(std::size_t cols) {
+            const std::size_t per_line = MATRIX_ALIGNMENT / sizeof(T);
+            return (cols + per_line - 1) / per_line * per_line;
+        }
+
+    public:
+        MatrixT() = default;
+
+        /**
+         * @brief Tworzy macierz rows x cols wypełnioną wartością value
+         */
+        MatrixT(std::size_t rows, std::size_t cols, T value = T())
+            : buffer(rows * paddedStride(cols), value), nrows(rows), ncols(cols), ld(paddedStride(cols)) {}
+
+        /**
+         * @brief Kopiuje macierz zapisaną jako wektor wierszy
+         */
+        static MatrixT fromRows(const std::vector<std::vector<T>>& rowsData) {
+            std::size_t r = rowsData.size();
+            std::size_t c = r ? rowsData[0].size() : 0;
+            MatrixT m(r, c);
+            for (std::size_t i = 0; i < r; ++i) {
+                if (rowsData[i].size() != c) {
+                    throw std::invalid_argument("Wiersze macierzy mają różne długości");
+                }
+                std::copy(rowsData[i].begin(), rowsData[i].end(), m.row(i));
+            }
+            return m;
+        }
+
+        static MatrixT identity(std::size_t n) {
+            MatrixT m(n, n);
+            for (std::size_t i = 0; i < n; ++i) m(i, i) = T(1);
+            return m;
+        }
+
+        /**
+         * @brief Kopiuje zawartość dowolnego widoku do nowej macierzy
+         */
+        template <typename U>
+        static MatrixT copyOf(MatrixViewT<U> src) {
+            MatrixT m(src.rows(), src.cols());
+            for (std::size_t i = 0; i < src.rows(); ++i) {
+                for (std::size_t j = 0; j < src.cols(); ++j) {
+                    m(i, j) = static_cast<T>(src(i, j));
+                }
+            }
+            return m;
+        }
+
+        std::vector<std::vector<T>> toRows() const {
+            std::vector<std::vector<T>> out(nrows);
+            for (std::size_t i = 0; i < nrows; ++i) {
+                out[i].assign(row(i), row(i) + ncols);
+            }
+            return out;
+        }
+
+        std::size_t rows() const { return nrows; }
+        std::size_t cols() const { return ncols; }
+        std::size_t stride() const { return ld; }
+        bool empty() const { return nrows == 0 || ncols == 0; }
+
+        T* data() { return buffer.data(); }
+        const T* data() const { return buffer.data(); }
+
+        T& operator()(std::size_t i, std::size_t j) { return buffer[i * ld + j]; }
+        const T& operator()(std::size_t i, std::size_t j) const { return buffer[i * ld + j]; }
+
+        T* row(std::size_t i) { return buffer.data() + i * ld; }
+        const T* row(std::size_t i) const { return buffer.data() + i * ld; }
+
+        MatrixViewT<T> view() { return MatrixViewT<T>(data(), nrows, ncols, ld); }
+        MatrixViewT<const T> view() const { return MatrixViewT<const T>(data(), nrows, ncols, ld); }
+        operator MatrixViewT<T>() { return view(); }
+        operator MatrixViewT<const T>() const { return view(); }
+
+        MatrixViewT<T> block(std::size_t i, std::size_t j, std::size_t r, std::size_t c) {
+            return view().block(i, j, r, c);
+        }
+        MatrixViewT<const T> block(std::size_t i, std::size_t j, std::size_t r, std::size_t c) const {
+            return view().block(i, j, r, c);
+        }
+    };
+
+    using Matrix = MatrixT<double>;
+    using MatrixF = MatrixT<float>;
+
+} // namespace numlib
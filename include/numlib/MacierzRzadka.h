@@ -0,0 +1,172 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Macierz.h"
+
+namespace numlib {
+
+    class SparseMatrixCSC;
+
+    /**
+     * @brief Nieposiadający widok macierzy CSR, np. tablic odwzorowanych z pliku
+     *
+     * Tablice mają ten sam układ co w SparseMatrix. Widok nie sprawdza ich spójności.
+     */
+    class SparseMatrixView {
+    private:
+        std::size_t nrows = 0, ncols = 0;
+        Span<const std::size_t> rowPtr;
+        Span<const int> colIdx;
+        Span<const double> vals;
+
+    public:
+        SparseMatrixView() = default;
+        SparseMatrixView(std::size_t rows, std::size_t cols, Span<const std::size_t> rowPointers,
+                         Span<const int> columnIndices, Span<const double> values)
+            : nrows(rows), ncols(cols), rowPtr(rowPointers), colIdx(columnIndices), vals(values) {}
+
+        std::size_t rows() const { return nrows; }
+        std::size_t cols() const { return ncols; }
+        std::size_t nnz() const { return vals.size(); }
+
+        Span<const std::size_t> rowPointers() const { return rowPtr; }
+        Span<const int> columnIndices() const { return colIdx; }
+        Span<const double> values() const { return vals; }
+
+        /**
+         * @brief y = A x; wiersze dzielone są na pulę wątków po równo względem liczby niezerowych
+         */
+        void multiply(Span<const double> x, Span<double> y) const;
+        std::vector<double> multiply(const std::vector<double>& x) const;
+    };
+
+    /**
+     * @brief Macierz rzadka w formacie CSR (Compressed Sparse Row)
+     *
+     * Wiersz i zajmuje pozycje rowPtr[i] .. rowPtr[i+1]-1 tablic colIdx i values.
+     * Indeksy kolumn w każdym wierszu są posortowane rosnąco i nie powtarzają się.
+     */
+    class SparseMatrix {
+    private:
+        std::size_t nrows = 0, ncols = 0;
+        std::vector<std::size_t> rowPtr;
+        std::vector<int> colIdx;
+        std::vector<double> vals;
+
+    public:
+        SparseMatrix() : rowPtr(1, 0) {}
+
+        /**
+         * @brief Tworzy macierz z gotowych tablic CSR
+         * @throw invalid_argument gdy tablice są niespójne
+         */
+        SparseMatrix(std::size_t rows, std::size_t cols, std::vector<std::size_t> rowPointers,
+                     std::vector<int> columnIndices, std::vector<double> values);
+
+        /**
+         * @brief Kopiuje tablice widoku do nowej macierzy (ze sprawdzeniem spójności)
+         */
+        static SparseMatrix copyOf(SparseMatrixView src);
+
+        std::size_t rows() const { return nrows; }
+        std::size_t cols() const { return ncols; }
+        std::size_t nnz() const { return vals.size(); }
+
+        const std::vector<std::size_t>& rowPointers() const { return rowPtr; }
+        const std::vector<int>& columnIndices() const { return colIdx; }
+        const std::vector<double>& values() const { return vals; }
+        std::vector<double>& values() { return vals; }
+
+        SparseMatrixView view() const {
+            return SparseMatrixView(nrows, ncols, rowPtr, colIdx, vals);
+        }
+
+        /**
+         * @brief Zwraca element (i, j) lub 0, jeśli nie należy do wzorca (O(log nnz w wierszu))
+         */
+        double at(std::size_t i, std::size_t j) const;
+
+        /**
+         * @brief Zwraca przekątną macierzy
+         */
+        std::vector<double> diagonal() const;
+
+        /**
+         * @brief y = A x; wiersze dzielone są na pulę wątków po równo względem liczby niezerowych
+         */
+        void multiply(Span<const double> x, Span<double> y) const;
+        std::vector<double> multiply(const std::vector<double>& x) const;
+
+        /**
+         * @brief Zwraca macierz transponowaną (również w CSR)
+         */
+        SparseMatrix transpose() const;
+
+        SparseMatrixCSC toCSC() const;
+    };
+
+    /**
+     * @brief Macierz rzadka w formacie CSC (Compressed Sparse Column)
+     *
+     * Kolumna j zajmuje pozycje colPtr[j] .. colPtr[j+1]-1 tablic rowIdx i values.
+     */
+    class SparseMatrixCSC {
+    private:
+        std::size_t nrows = 0, ncols = 0;
+        std::vector<std::size_t> colPtr;
+        std::vector<int> rowIdx;
+        std::vector<double> vals;
+
+    public:
+        SparseMatrixCSC() : colPtr(1, 0) {}
+        SparseMatrixCSC(std::size_t rows, std::size_t cols, std::vector<std::size_t> columnPointers,
+                        std::vector<int> rowIndices, std::vector<double> values);
+
+        std::size_t rows() const { return nrows; }
+        std::size_t cols() const { return ncols; }
+        std::size_t nnz() const { return vals.size(); }
+
+        const std::vector<std::size_t>& columnPointers() const { return colPtr; }
+        const std::vector<int>& rowIndices() const { return rowIdx; }
+        const std::vector<double>& values() const { return vals; }
+
+        /**
+         * @brief y = A x (rozrzucanie kolumnami, jednowątkowo)
+         */
+        std::vector<double> multiply(const std::vector<double>& x) const;
+
+        SparseMatrix toCSR() const;
+    };
+
+    /**
+     * @brief Budowanie macierzy rzadkiej z listy trójek (i, j, wartość) - format COO
+     *
+     * Trójki można dodawać w dowolnej kolejności; powtórzone pozycje są sumowane
+     * (jak przy składaniu macierzy sztywności z elementów).
+     */
+    class CooBuilder {
+    private:
+        std::size_t nrows, ncols;
+        std::vector<int> rowIdx, colIdx;
+        std::vector<double> vals;
+
+    public:
+        CooBuilder(std::size_t rows, std::size_t cols) : nrows(rows), ncols(cols) {}
+
+        void reserve(std::size_t count);
+
+        /**
+         * @brief Dodaje wartość do pozycji (i, j)
+         * @throw out_of_range dla indeksu spoza macierzy
+         */
+        void add(std::size_t i, std::size_t j, double value);
+
+        std::size_t size() const { return vals.size(); }
+
+        /**
+         * @brief Tworzy macierz CSR w czasie O(nnz + n) (sortowanie kubełkowe)
+         */
+        SparseMatrix build() const;
+    };
+
+} // namespace numlib
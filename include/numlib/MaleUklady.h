@@ -0,0 +1,145 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace numlib {
+
+    /**
+     * @brief Układy równań o rozmiarze N znanym w czasie kompilacji (małe N, np. 2..16).
+     *
+     * Macierz i wektor są tablicami std::array na stosie, więc nic nie jest
+     * alokowane. Pętle eliminacji rozwijane są przez szablony (index_sequence),
+     * zatem kompilator widzi ciąg działań o stałych indeksach i może trzymać
+     * całą macierz w rejestrach. Wszystkie funkcje są constexpr - układ o
+     * stałych współczynnikach można rozwiązać już w czasie kompilacji.
+     */
+    namespace fixed {
+
+        template<std::size_t N>
+        using Vec = std::array<double, N>;
+
+        template<std::size_t N>
+        using Mat = std::array<std::array<double, N>, N>;
+
+        constexpr double PIVOT_TOLERANCE = 1e-10;
+
+        namespace detail {
+            constexpr double absolute(double x) { return x < 0.0 ? -x : x; }
+
+            constexpr void checkPivot(double pivot) {
+                if (absolute(pivot) < PIVOT_TOLERANCE) {
+                    throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+                }
+            }
+        }
+
+        /**
+         * @brief Eliminacja bez zamiany wierszy - najszybsza, ale tylko dla macierzy
+         * z dominującą przekątną lub symetrycznych dodatnio określonych
+         */
+        struct NoPivoting {
+            template<std::size_t K, std::size_t N>
+            static constexpr void pivot(Mat<N>& A, Vec<N>&) {
+                detail::checkPivot(A[K][K]);
+            }
+        };
+
+        namespace detail {
+            // Zamienia wiersze K i I (oraz b), jeśli |A[I][K]| > |A[K][K]|. Indeksy są
+            // stałymi, a wybór realizowany bez skoków, więc macierz może zostać w rejestrach.
+            template<std::size_t K, std::size_t I, std::size_t N, std::size_t... J>
+            constexpr void conditionalSwap(Mat<N>& A, Vec<N>& b, std::index_sequence<J...>) {
+                bool larger = absolute(A[I][K]) > absolute(A[K][K]);
+                double top = 0.0, bottom = 0.0;
+                ((top = A[K][K + J], bottom = A[I][K + J],
+                  A[K][K + J] = larger ? bottom : top, A[I][K + J] = larger ? top : bottom), ...);
+                top = b[K];
+                bottom = b[I];
+                b[K] = larger ? bottom : top;
+                b[I] = larger ? top : bottom;
+            }
+
+            template<std::size_t K, std::size_t N, std::size_t... I>
+            constexpr void pivotColumn(Mat<N>& A, Vec<N>& b, std::index_sequence<I...>) {
+                (conditionalSwap<K, K + 1 + I>(A, b, std::make_index_sequence<N - K>{}), ...);
+            }
+        }
+
+        /**
+         * @brief Częściowy wybór elementu głównego: do wiersza K trafia wiersz
+         * z największym |A[i][K]|, i >= K (jak w GaussSolve)
+         *
+         * Kolumny na lewo od K są już wyeliminowane, więc zamieniane są tylko
+         * kolumny K..N-1.
+         */
+        struct PartialPivoting {
+            template<std::size_t K, std::size_t N>
+            static constexpr void pivot(Mat<N>& A, Vec<N>& b) {
+                detail::pivotColumn<K>(A, b, std::make_index_sequence<N - K - 1>{});
+                detail::checkPivot(A[K][K]);
+            }
+        };
+
+        namespace detail {
+            // Wiersz I -= f * wiersz K dla kolumn K+1..N-1 (kolumna K nie jest już potrzebna)
+            template<std::size_t K, std::size_t I, std::size_t N, std::size_t... J>
+            constexpr void eliminateRow(Mat<N>& A, Vec<N>& b, double inverse, std::index_sequence<J...>) {
+                double f = A[I][K] * inverse;
+                ((A[I][K + 1 + J] -= f * A[K][K + 1 + J]), ...);
+                b[I] -= f * b[K];
+            }
+
+            template<std::size_t K, std::size_t N, std::size_t... I>
+            constexpr void eliminateColumn(Mat<N>& A, Vec<N>& b, std::index_sequence<I...>) {
+                // Dla K = N - 1 nie ma wierszy do eliminacji
+                [[maybe_unused]] double inverse = 1.0 / A[K][K];
+                (eliminateRow<K, K + 1 + I>(A, b, inverse, std::make_index_sequence<N - K - 1>{}), ...);
+            }
+
+            template<typename Pivoting, std::size_t N, std::size_t... K>
+            constexpr void forward(Mat<N>& A, Vec<N>& b, std::index_sequence<K...>) {
+                ((Pivoting::template pivot<K>(A, b),
+                  eliminateColumn<K>(A, b, std::make_index_sequence<N - K - 1>{})), ...);
+            }
+
+            // x[I] = (b[I] - sum_{J > I} A[I][J] x[J]) / A[I][I]; wynik nadpisuje b
+            template<std::size_t I, std::size_t N, std::size_t... J>
+            constexpr void backRow(const Mat<N>& A, Vec<N>& b, std::index_sequence<J...>) {
+                double sum = b[I];
+                ((sum -= A[I][I + 1 + J] * b[I + 1 + J]), ...);
+                b[I] = sum / A[I][I];
+            }
+
+            template<std::size_t N, std::size_t... S>
+            constexpr void backward(const Mat<N>& A, Vec<N>& b, std::index_sequence<S...>) {
+                (backRow<N - 1 - S>(A, b, std::make_index_sequence<S>{}), ...);
+            }
+        }
+
+        /**
+         * @brief Rozwiązuje A x = b eliminacją Gaussa, nadpisując b rozwiązaniem;
+         * zawartość A po wywołaniu jest nieokreślona
+         * @tparam Pivoting PartialPivoting (domyślnie) lub NoPivoting
+         * @throw runtime_error gdy element główny jest mniejszy niż PIVOT_TOLERANCE
+         */
+        template<typename Pivoting = PartialPivoting, std::size_t N>
+        constexpr void solveInPlace(Mat<N>& A, Vec<N>& b) {
+            static_assert(N > 0, "Rozmiar układu musi być dodatni");
+            detail::forward<Pivoting>(A, b, std::make_index_sequence<N>{});
+            detail::backward(A, b, std::make_index_sequence<N>{});
+        }
+
+        /**
+         * @brief Jak solveInPlace, ale argumenty przekazywane są przez wartość
+         * (kopia na stosie, bez alokacji)
+         */
+        template<typename Pivoting = PartialPivoting, std::size_t N>
+        constexpr Vec<N> solve(Mat<N> A, Vec<N> b) {
+            solveInPlace<Pivoting>(A, b);
+            return b;
+        }
+    }
+
+} // namespace numlib
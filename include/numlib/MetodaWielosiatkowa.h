@@ -0,0 +1,139 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "MacierzRzadka.h"
+#include "MetodyKrylowa.h"
+
+namespace numlib {
+
+    class Cholesky;
+
+    /**
+     * @brief Zadanie -div(k grad u) + c u = f na prostokątnej siatce 1D/2D/3D
+     *
+     * Stałe współczynniki kx, ky, kz (dopuszczalna anizotropia), zerowe warunki
+     * Dirichleta na brzegu, schemat 3/5/7-punktowy. Niewiadome to punkty
+     * wewnętrzne; punkt (i, j, k) ma indeks i + nx * (j + ny * k). Dla
+     * nieużywanych wymiarów n = 1.
+     */
+    struct StructuredGrid {
+        int dimensions = 2;
+        std::size_t nx = 1, ny = 1, nz = 1;
+        double hx = 1.0, hy = 1.0, hz = 1.0;
+        double kx = 1.0, ky = 1.0, kz = 1.0;
+        double c = 0.0;
+
+        std::size_t size() const { return nx * ny * nz; }
+
+        /**
+         * @brief Siatka kwadratowa/sześcienna n^d punktów wewnętrznych na [0, 1]^d
+         */
+        static StructuredGrid unitCube(int dimensions, std::size_t n);
+    };
+
+    enum class CycleType {
+        V,
+        W,
+        F       // na każdym poziomie: cykl F na siatce grubszej, a po nim cykl V
+    };
+
+    enum class Smoother {
+        WeightedJacobi,
+        RedBlackGaussSeidel     // kolory według parzystości i + j + k
+    };
+
+    struct MultigridOptions {
+        CycleType cycle = CycleType::V;
+        Smoother smoother = Smoother::RedBlackGaussSeidel;
+        int preSmoothing = 2;
+        int postSmoothing = 2;
+        double jacobiWeight = 0.0;  // 0 - 2d / (2d + 1), optymalne tłumienie dla laplasjanu
+        double tolerance = 1e-8;    // na względne residuum (tylko solve)
+        int maxCycles = 100;
+    };
+
+    /**
+     * @brief Geometryczna metoda wielosiatkowa dla StructuredGrid
+     *
+     * Kolejne siatki powstają przez podwojenie kroku: n punktów wewnętrznych
+     * (n nieparzyste) przechodzi w (n - 1) / 2. Zgrubianie kończy się, gdy
+     * któryś z używanych wymiarów jest parzysty lub mniejszy niż 3, więc
+     * najlepiej działają siatki n = 2^L - 1. Operator na siatce grubszej to
+     * ten sam schemat z większym krokiem. Residuum przenoszone jest
+     * w dół pełnym ważeniem (1/4, 1/2, 1/4 w każdym wymiarze), a poprawka
+     * w górę interpolacją (bi/tri)liniową. Na najgrubszej siatce układ
+     * rozwiązywany jest rozkładem Cholesky'ego, o ile ma ona najwyżej 2000
+     * niewiadomych. Większa najgrubsza siatka (np. gdy n jest parzyste i nie da
+     * się jej zgrubić) rozwiązywana jest metodą CG bez preconditionera do
+     * względnego residuum 1e-12, co najwyżej 10 * n iteracji - taki solve może
+     * dominować koszt cyklu.
+     *
+     * Wygładzanie, residuum i przenoszenie między siatkami dzielone są na
+     * paski wierszy wykonywane na puli wątków; wynik nie zależy od liczby
+     * wątków. Koszt jednego cyklu V i W jest O(n), a liczba cykli potrzebnych
+     * do zadanej dokładności nie rośnie z rozmiarem siatki.
+     *
+     * Jako preconditioner (apply) wykonuje jeden cykl od zerowego przybliżenia,
+     * przy czym w wygładzaniu końcowym kolory przeglądane są w odwrotnej
+     * kolejności. Dzięki temu cykle V i W przy preSmoothing == postSmoothing są
+     * symetryczne i nadają się do CG. W solve i iterate kolejność kolorów jest
+     * zawsze ta sama, co daje mniej więcej dwa razy lepszy współczynnik
+     * zbieżności. Bufory poziomów są wspólne - obiektu nie należy używać
+     * jednocześnie z kilku wątków.
+     */
+    class Multigrid : public Preconditioner {
+    private:
+        struct Level {
+            StructuredGrid grid;
+            std::vector<double> x, b, r;
+        };
+
+        MultigridOptions options;
+        mutable std::vector<Level> levels;
+        std::unique_ptr<Cholesky> coarse;
+
+        void cycle(std::size_t level, CycleType type, bool symmetric) const;
+        void run(const std::vector<double>& b, std::vector<double>& x, bool symmetric) const;
+        void smooth(std::size_t level, int sweeps, bool reverse) const;
+        void solveCoarsest() const;
+
+    public:
+        /**
+         * @throw invalid_argument dla nieprawidłowej siatki (wymiar spoza 1..3, n = 0, h <= 0, k <= 0, c < 0)
+         */
+        explicit Multigrid(const StructuredGrid& grid, const MultigridOptions& options = {});
+        ~Multigrid() override;
+
+        std::size_t size() const { return levels.front().grid.size(); }
+        std::size_t levelCount() const { return levels.size(); }
+        const StructuredGrid& grid(std::size_t level = 0) const { return levels[level].grid; }
+
+        /**
+         * @brief y = A x dla siatki najdrobniejszej (bez składania macierzy)
+         */
+        void multiply(const std::vector<double>& x, std::vector<double>& y) const;
+
+        /**
+         * @brief Operator najdrobniejszej siatki jako macierz CSR (np. do porównań z innymi solverami)
+         */
+        SparseMatrix matrix() const;
+
+        /**
+         * @brief Jeden cykl dla A x = b, poprawiający x w miejscu
+         */
+        void iterate(const std::vector<double>& b, std::vector<double>& x) const;
+
+        /**
+         * @brief Cykle aż do względnego residuum ||b - Ax|| / ||b|| < tolerance
+         * @param x0 przybliżenie początkowe (puste - wektor zerowy)
+         */
+        KrylovResult solve(const std::vector<double>& b, const std::vector<double>& x0 = {}) const;
+
+        /**
+         * @brief z = jeden cykl dla A z = r od z = 0
+         */
+        void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+    };
+
+} // namespace numlib
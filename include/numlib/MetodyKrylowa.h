@@ -0,0 +1,96 @@
+#pragma once
+#include <vector>
+#include <functional>
+#include "MacierzRzadka.h"
+
+namespace numlib {
+
+    /**
+     * @brief Operator liniowy y = A x podany jako funkcja (wersja bez jawnej macierzy)
+     */
+    using LinearOperator = std::function<void(const std::vector<double>& x, std::vector<double>& y)>;
+
+    /**
+     * @brief Klasa bazowa dla preconditionerów: z = M^-1 r
+     */
+    class Preconditioner {
+    public:
+        virtual ~Preconditioner() = default;
+        virtual void apply(const std::vector<double>& r, std::vector<double>& z) const = 0;
+    };
+
+    /**
+     * @brief Preconditioner Jacobiego (odwrotność przekątnej)
+     */
+    class JacobiPreconditioner : public Preconditioner {
+    private:
+        std::vector<double> invDiag;
+    public:
+        /**
+         * @throw runtime_error gdy na przekątnej występuje zero
+         */
+        explicit JacobiPreconditioner(const SparseMatrix& A);
+        void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+    };
+
+    /**
+     * @brief Niepełny rozkład LU bez wypełnienia - ILU(0)
+     *
+     * Czynniki L i U mają wzorzec niezerowych macierzy A. Wymaga obecności
+     * przekątnej we wzorcu.
+     */
+    class ILU0Preconditioner : public Preconditioner {
+    private:
+        SparseMatrix lu;
+        std::vector<std::size_t> diagPos;
+    public:
+        /**
+         * @throw runtime_error gdy brakuje elementu przekątnej lub pojawi się zerowy element główny
+         */
+        explicit ILU0Preconditioner(const SparseMatrix& A);
+        void apply(const std::vector<double>& r, std::vector<double>& z) const override;
+    };
+
+    /**
+     * @brief Wynik metody iteracyjnej
+     */
+    struct KrylovResult {
+        std::vector<double> x;          // przybliżone rozwiązanie
+        int iterations;                 // liczba wykonanych iteracji
+        double residual;                // końcowe względne residuum ||b - Ax|| / ||b||
+        bool converged;
+        std::vector<double> residuals;  // względne residuum po każdej iteracji (pozycja 0 - przybliżenie początkowe)
+    };
+
+    /**
+     * @brief Metoda gradientów sprzężonych (A symetryczna dodatnio określona)
+     * @param M preconditioner (symetryczny, dodatnio określony) lub nullptr
+     * @param x0 przybliżenie początkowe (puste - wektor zerowy)
+     */
+    KrylovResult CG(const LinearOperator& A, const std::vector<double>& b, const Preconditioner* M = nullptr,
+                    double tolerance = 1e-8, int maxIterations = 1000, const std::vector<double>& x0 = {});
+    KrylovResult CG(const SparseMatrix& A, const std::vector<double>& b, const Preconditioner* M = nullptr,
+                    double tolerance = 1e-8, int maxIterations = 1000, const std::vector<double>& x0 = {});
+
+    /**
+     * @brief Metoda BiCGSTAB dla macierzy niesymetrycznych (preconditioning prawostronny)
+     */
+    KrylovResult BiCGSTAB(const LinearOperator& A, const std::vector<double>& b, const Preconditioner* M = nullptr,
+                          double tolerance = 1e-8, int maxIterations = 1000, const std::vector<double>& x0 = {});
+    KrylovResult BiCGSTAB(const SparseMatrix& A, const std::vector<double>& b, const Preconditioner* M = nullptr,
+                          double tolerance = 1e-8, int maxIterations = 1000, const std::vector<double>& x0 = {});
+
+    /**
+     * @brief Metoda GMRES z restartem co m iteracji (preconditioning prawostronny)
+     *
+     * Residuum w historii jest liczone z obrotów Givensa, więc nie wymaga
+     * dodatkowego mnożenia przez A.
+     */
+    KrylovResult GMRES(const LinearOperator& A, const std::vector<double>& b, int restart = 30,
+                       const Preconditioner* M = nullptr, double tolerance = 1e-8, int maxIterations = 1000,
+                       const std::vector<double>& x0 = {});
+    KrylovResult GMRES(const SparseMatrix& A, const std::vector<double>& b, int restart = 30,
+                       const Preconditioner* M = nullptr, double tolerance = 1e-8, int maxIterations = 1000,
+                       const std::vector<double>& x0 = {});
+
+} // namespace numlib
@@ -0,0 +1,82 @@
+#pragma once
+#include <vector>
+#include "Macierz.h"
+#include "MacierzRzadka.h"
+#include "MetodyKrylowa.h"
+
+namespace numlib {
+
+    enum class StationaryMethod {
+        Jacobi,
+        GaussSeidel,
+        SOR,
+        SSOR        // SOR w przód, a następnie wstecz (macierz iteracji symetryczna dla symetrycznej A)
+    };
+
+    enum class Ordering {
+        Natural,    // wiersze po kolei, jeden wątek
+        Multicolor  // wiersze grupowane kolorami (dla siatek 5-punktowych: czerwono-czarne);
+                    // dla gęstych wzorców zastępowana naturalną
+    };
+
+    /**
+     * @brief Parametry metod stacjonarnych
+     */
+    struct StationaryOptions {
+        StationaryMethod method = StationaryMethod::GaussSeidel;
+        Ordering ordering = Ordering::Multicolor;   // nie dotyczy metody Jacobiego i SSOR
+        double omega = 0.0;         // SOR, SSOR, Jacobi tłumiony; 0 - SOR/SSOR: dobór automatyczny, Jacobi: 1
+        double tolerance = 1e-8;    // na względne residuum ||b - Ax|| / ||b||
+        int maxIterations = 10000;
+    };
+
+    /**
+     * @brief Wynik metody stacjonarnej: jak dla metod Kryłowa oraz użyte omega i liczba kolorów
+     */
+    struct StationaryResult : KrylovResult {
+        double omega = 1.0;
+        int colors = 1;
+    };
+
+    /**
+     * @brief Metody Jacobiego, Gaussa-Seidla, SOR i SSOR
+     *
+     * Przy kolejności wielokolorowej wiersze dzielone są zachłannym
+     * kolorowaniem grafu macierzy (wzorzec A + A^T) tak, aby wiersze jednego
+     * koloru nie zależały od siebie. Półkrok Gaussa-Seidla dla jednego koloru
+     * wykonywany jest wtedy równolegle na puli wątków, a wynik nie zależy od
+     * liczby wątków. Dla macierzy gęstej kolory wyznaczane są z dokładnych zer.
+     * Gdy wierszy ma średnio ponad 32 niezera poza przekątną (np. macierz
+     * faktycznie gęsta), kolorów byłoby prawie tyle co wierszy - wtedy
+     * używana jest kolejność naturalna, a wynik podaje jeden kolor.
+     * SSOR wykonywany jest zawsze w kolejności naturalnej - przy kolorowaniu
+     * czerwono-czarnym półkrok wsteczny powtarzałby ostatni kolor i metoda
+     * byłaby wolniejsza od zwykłego Gaussa-Seidla.
+     *
+     * Automatyczne omega: najpierw wykonywane są zwykłe kroki Gaussa-Seidla,
+     * a z ilorazu kolejnych poprawek ||x_k+1 - x_k|| / ||x_k - x_k-1||
+     * (przyspieszonego procesem Aitkena) szacowany jest promień spektralny rho
+     * iteracji Gaussa-Seidla. Dla macierzy zgodnie uporządkowanych (np.
+     * czerwono-czarnych) omega = 2 / (1 + sqrt(1 - rho)) (Young), dla SSOR -
+     * 2 / (1 + sqrt(2 (1 - sqrt(rho)))). Kroki szacowania liczą się do iteracji.
+     *
+     * Zbieżność gwarantowana jest m.in. dla macierzy z dominującą przekątną,
+     * a Gaussa-Seidla i SOR (0 < omega < 2) także dla symetrycznych dodatnio
+     * określonych.
+     *
+     * @throw invalid_argument przy niezgodnych wymiarach
+     * @throw runtime_error gdy na przekątnej występuje zero
+     */
+    StationaryResult StationarySolve(const SparseMatrix& A, const std::vector<double>& b,
+                                     const StationaryOptions& options = {}, const std::vector<double>& x0 = {});
+    StationaryResult StationarySolve(ConstMatrixView A, const std::vector<double>& b,
+                                     const StationaryOptions& options = {}, const std::vector<double>& x0 = {});
+
+    /**
+     * @brief Zachłanne kolorowanie grafu macierzy (wzorzec A + A^T, bez przekątnej)
+     * @param color kolor każdego wiersza
+     * @return liczba kolorów
+     */
+    int greedyColoring(const SparseMatrix& A, std::vector<int>& color);
+
+} // namespace numlib
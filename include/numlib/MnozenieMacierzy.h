@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include "Macierz.h"
+
+namespace numlib {
+
+    /**
+     * @brief Czy argument jest brany wprost, czy transponowany
+     */
+    enum class Op {
+        None,
+        Transpose
+    };
+
+    enum class Triangle {
+        Lower,
+        Upper
+    };
+
+    enum class Side {
+        Left,   // op(T) X = alpha B
+        Right   // X op(T) = alpha B
+    };
+
+    enum class Diagonal {
+        NonUnit,
+        Unit    // przekątna T traktowana jako jedynki (nie jest czytana)
+    };
+
+    /**
+     * @brief C = alpha * op(A) * op(B) + beta * C
+     *
+     * Mnożenie zorganizowane jak w nowoczesnych bibliotekach BLAS: blok op(B)
+     * o wymiarach kc x nc jest przepisywany (pakowany) do ciągłych pasków po nr
+     * kolumn, a blok op(A) mc x kc - do pasków po mr wierszy. Mikrojądro liczy
+     * kafelek mr x nr macierzy C w rejestrach (AVX-512: 8 x 24, AVX2: 6 x 8),
+     * czytając oba paski sekwencyjnie. Pasek A pozostaje w L1, blok B w L2.
+     *
+     * Bloki wierszy C wykonywane są na puli wątków. Każdy element C liczony
+     * jest w tej samej kolejności działań, więc wynik nie zależy od liczby
+     * wątków. Wersja jądra wybierana jest według simd::activeLevel().
+     *
+     * @throw invalid_argument przy niezgodnych wymiarach
+     */
+    void gemm(Op opA, Op opB, double alpha, ConstMatrixView A, ConstMatrixView B,
+              double beta, MatrixView C);
+
+    // C = A * B
+    Matrix multiply(ConstMatrixView A, ConstMatrixView B);
+
+    /**
+     * @brief C = alpha * op(A) * op(A)^T + beta * C tylko w trójkącie uplo macierzy C
+     *
+     * Dla op = None A ma wymiary n x k, dla op = Transpose - k x n (wtedy
+     * liczone jest A^T A). Drugi trójkąt C nie jest zmieniany. Bloki poza
+     * przekątną liczone są przez gemm, więc koszt to około połowy gemm.
+     */
+    void syrk(Triangle uplo, Op op, double alpha, ConstMatrixView A, double beta, MatrixView C);
+
+    /**
+     * @brief Rozwiązuje układ z macierzą trójkątną dla wielu prawych stron, nadpisując B
+     *
+     * Side::Left: op(T) X = alpha B, Side::Right: X op(T) = alpha B. Używany
+     * jest tylko trójkąt uplo macierzy T. Bloki przekątne rozwiązywane są
+     * bezpośrednio, a aktualizacja pozostałej części B wykonywana przez gemm.
+     *
+     * @throw invalid_argument przy niezgodnych wymiarach
+     */
+    void trsm(Side side, Triangle uplo, Op op, Diagonal diag, double alpha,
+              ConstMatrixView T, MatrixView B);
+
+} // namespace numlib
@@ -0,0 +1,164 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Macierz.h"
+#include "MacierzRzadka.h"
+#include "PlikMapowany.h"
+
+namespace numlib {
+
+    /**
+     * @brief Rodzaj danych zapisanych w pliku macierzy
+     */
+    enum class MatrixFileLayout : std::uint8_t {
+        Dense = 0,      // rows wierszy po stride elementów (stride >= cols, jak w Matrix)
+        Vector = 1,     // rows elementów bez przerw
+        SparseCSR = 2   // rowPointers (rows + 1 x uint64), columnIndices (nnz x int32), values (nnz x double)
+    };
+
+    enum class ScalarType : std::uint8_t {
+        Float64 = 0,
+        Float32 = 1
+    };
+
+    constexpr std::uint32_t MATRIX_FILE_VERSION = 1;
+
+    /**
+     * @brief 64-bajtowy nagłówek binarnego pliku macierzy
+     *
+     * Po nagłówku leżą surowe dane (little-endian). Każda sekcja danych zaczyna
+     * się na przesunięciu od początku pliku wyrównanym do alignment bajtów, więc
+     * po odwzorowaniu pliku w pamięć można jej używać bezpośrednio, bez kopiowania.
+     */
+    struct MatrixFileHeader {
+        char magic[8];              // "NUMLIBMF"
+        std::uint32_t version;      // MATRIX_FILE_VERSION
+        std::uint8_t layout;        // MatrixFileLayout
+        std::uint8_t scalar;        // ScalarType (SparseCSR - zawsze Float64)
+        std::uint16_t reserved0;
+        std::uint32_t alignment;    // potęga dwójki z przedziału [8, 4096]
+        std::uint32_t byteOrder;    // 0x01020304 - wykrywa plik z innej architektury
+        std::uint64_t rows;
+        std::uint64_t cols;
+        std::uint64_t stride;       // Dense: elementów na wiersz
+        std::uint64_t nnz;          // SparseCSR: liczba niezerowych
+        std::uint64_t reserved1;
+    };
+
+    static_assert(sizeof(MatrixFileHeader) == 64, "Nagłówek pliku macierzy musi mieć 64 bajty");
+
+    /**
+     * @brief Plik macierzy odwzorowany w pamięć - dostęp do danych bez kopiowania
+     *
+     * Otwarcie pliku sprawdza tylko nagłówek i rozmiar, więc trwa tyle samo dla
+     * 1 KB i 10 GB danych; strony wczytywane są dopiero przy dostępie. Widoki są
+     * ważne, dopóki istnieje obiekt MatrixFile. Indeksy macierzy rzadkiej nie są
+     * sprawdzane (patrz SparseMatrix::copyOf).
+     */
+    class MatrixFile {
+    public:
+        enum class Access {
+            ReadOnly,       // widoki tylko do odczytu
+            CopyOnWrite     // dodatkowo mutableDense() - zmiany nie trafiają do pliku
+        };
+
+    private:
+        MappedFile file;
+        MatrixFileHeader header{};
+        Access access;
+
+        const char* section(std::size_t offset) const {
+            return static_cast<const char*>(file.data()) + offset;
+        }
+        void require(MatrixFileLayout layout, ScalarType scalar) const;
+
+    public:
+        /**
+         * @brief Otwiera plik i sprawdza nagłówek
+         * @throw runtime_error gdy plik nie istnieje, ma błędny nagłówek lub jest za krótki
+         */
+        explicit MatrixFile(const std::string& path, Access access = Access::ReadOnly);
+
+        const MatrixFileHeader& fileHeader() const { return header; }
+        MatrixFileLayout layout() const { return static_cast<MatrixFileLayout>(header.layout); }
+        ScalarType scalarType() const { return static_cast<ScalarType>(header.scalar); }
+        std::size_t rows() const { return header.rows; }
+        std::size_t cols() const { return header.cols; }
+        std::size_t nnz() const { return header.nnz; }
+
+        /**
+         * @brief Widok macierzy gęstej typu double
+         * @throw runtime_error gdy plik zawiera dane innego rodzaju
+         */
+        ConstMatrixView dense() const;
+        MatrixViewT<const float> denseFloat() const;
+
+        /**
+         * @brief Modyfikowalny widok macierzy (tylko Access::CopyOnWrite)
+         *
+         * Pozwala np. wywołać GaussSolveInPlace lub luFactorInPlace bezpośrednio
+         * na danych z pliku. Zmienione strony są prywatną kopią procesu.
+         */
+        MatrixView mutableDense();
+
+        Span<const double> vector() const;
+        Span<const float> vectorFloat() const;
+
+        SparseMatrixView sparse() const;
+
+        /**
+         * @brief Zleca wczytanie całego pliku w tle
+         */
+        void prefetch() const { file.prefetch(0, file.size()); }
+    };
+
+    /**
+     * @brief Strumieniowy zapis macierzy gęstej wiersz po wierszu
+     *
+     * Nagłówek zapisywany jest od razu, a każdy wiersz trafia do pliku bez
+     * buforowania całej macierzy, więc można zapisywać macierze większe niż RAM.
+     * Dla ScalarType::Float32 wiersze są konwertowane podczas zapisu.
+     */
+    class MatrixFileWriter {
+    private:
+        std::ofstream out;
+        MatrixFileHeader header{};
+        std::size_t written = 0;
+        std::vector<char> rowBuffer;
+
+    public:
+        /**
+         * @throw runtime_error gdy pliku nie można utworzyć
+         * @throw invalid_argument dla nieprawidłowego wyrównania
+         */
+        MatrixFileWriter(const std::string& path, std::size_t rows, std::size_t cols,
+                         ScalarType scalar = ScalarType::Float64, std::size_t alignment = MATRIX_ALIGNMENT);
+        ~MatrixFileWriter();
+
+        /**
+         * @brief Dopisuje kolejny wiersz (cols elementów)
+         */
+        void writeRow(Span<const double> row);
+
+        /**
+         * @brief Dopisuje wszystkie wiersze bloku (kolumn musi być cols)
+         */
+        void writeRows(ConstMatrixView block);
+
+        std::size_t rowsWritten() const { return written; }
+
+        /**
+         * @brief Kończy zapis
+         * @throw runtime_error gdy zapisano mniej wierszy niż zadeklarowano lub zapis się nie powiódł
+         */
+        void close();
+    };
+
+    void writeMatrixFile(const std::string& path, ConstMatrixView A, ScalarType scalar = ScalarType::Float64);
+    void writeVectorFile(const std::string& path, Span<const double> v, ScalarType scalar = ScalarType::Float64);
+    void writeMatrixFile(const std::string& path, const SparseMatrix& A);
+
+} // namespace numlib
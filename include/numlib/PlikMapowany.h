@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace numlib {
+
+    /**
+     * @brief Plik odwzorowany w pamięć (mmap), zwalniany w destruktorze
+     *
+     * Strony pliku wczytywane są przez system przy pierwszym dostępie, a
+     * zmienione strony zapisywane z powrotem do pliku, więc dane mogą być
+     * większe niż pamięć RAM. Wymaga systemu zgodnego z POSIX.
+     */
+    class MappedFile {
+    public:
+        enum class Mode {
+            ReadOnly,       // istniejący plik, tylko odczyt
+            ReadWrite,      // istniejący plik, odczyt i zapis
+            CopyOnWrite,    // istniejący plik, zmiany widoczne tylko w pamięci procesu
+            Create          // nowy plik o zadanym rozmiarze (istniejący jest nadpisywany)
+        };
+
+    private:
+        void* base = nullptr;
+        std::size_t length = 0;
+        int fd = -1;
+
+        void release();
+
+    public:
+        MappedFile() = default;
+
+        /**
+         * @brief Otwiera i odwzorowuje plik
+         * @param size rozmiar w bajtach (tylko dla Mode::Create)
+         * @throw runtime_error gdy pliku nie można otworzyć lub odwzorować
+         */
+        MappedFile(const std::string& path, Mode mode, std::size_t size = 0);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        void* data() const { return base; }
+        std::size_t size() const { return length; }
+        bool isOpen() const { return base != nullptr || fd >= 0; }
+
+        /**
+         * @brief Zleca asynchroniczne wczytanie fragmentu pliku (madvise WILLNEED)
+         *
+         * Funkcja nie czeka na odczyt - strony są sprowadzane w tle, zanim
+         * program do nich sięgnie.
+         */
+        void prefetch(std::size_t offset, std::size_t bytes) const;
+
+        /**
+         * @brief Zapisuje zmienione strony do pliku i czeka na zakończenie zapisu
+         */
+        void flush() const;
+    };
+
+} // namespace numlib
@@ -3,11 +3,258 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <memory>
+#include "Macierz.h"
 
 using namespace std;
 
 namespace numlib {
 	void printMatrix(vector<vector<double>>&Mat, vector<double>&B);
 
+	// Adapter zgodny ze starym interfejsem - kopiuje dane do Matrix i wywołuje GaussSolve
 	vector<double> Gauss(vector<vector<double>>&Mat, vector<double>&B);
+
+	// Eliminacja Gaussa z wyborem elementu głównego bez wypisywania na ekran.
+	// Nadpisuje A czynnikami rozkładu LU, a b rozwiązaniem x.
+	// Rzuca runtime_error dla macierzy osobliwej.
+	void GaussSolveInPlace(MatrixView A, Span<double> b);
+
+	// Jak GaussSolveInPlace, ale nie modyfikuje argumentów
+	vector<double> GaussSolve(ConstMatrixView A, const vector<double>& b);
+
+	/**
+	 * @brief Rozkład PA = LU z częściowym wyborem elementu głównego
+	 *
+	 * Rozkład liczony jest blokowo: panel o szerokości blockSize kolumn jest
+	 * rozkładany kolumna po kolumnie, a reszta macierzy aktualizowana jednym
+	 * przebiegiem na panel. Po rozkładzie każde rozwiązanie kosztuje O(n^2).
+	 *
+	 * Panel rozkładany jest w jednym wątku, a aktualizacja reszty macierzy
+	 * dzielona na kafelki wykonywane na puli wątków (patrz setNumThreads
+	 * w Watki.h). Wynik nie zależy od liczby wątków.
+	 */
+	class LU {
+	private:
+		Matrix lu;          // L (pod przekątną, jedynki na przekątnej pominięte) i U
+		vector<int> piv;    // piv[k] - wiersz zamieniony z wierszem k w kroku k
+
+	public:
+		static constexpr int DEFAULT_BLOCK_SIZE = 64;
+
+		/**
+		 * @brief Rozkłada macierz kwadratową A
+		 * @param A macierz układu (nie jest modyfikowana)
+		 * @param blockSize szerokość panelu
+		 */
+		explicit LU(ConstMatrixView A, int blockSize = DEFAULT_BLOCK_SIZE);
+
+		/**
+		 * @brief Rozkłada macierz przejmując jej bufor (bez kopiowania)
+		 */
+		explicit LU(Matrix&& A, int blockSize = DEFAULT_BLOCK_SIZE);
+
+		size_t size() const { return lu.rows(); }
+		const Matrix& factors() const { return lu; }
+		const vector<int>& pivots() const { return piv; }
+
+		/**
+		 * @brief Rozwiązuje Ax = b, nadpisując b rozwiązaniem
+		 */
+		void solveInPlace(Span<double> b) const;
+
+		/**
+		 * @brief Rozwiązuje AX = B dla wielu prawych stron (kolumny B), nadpisując B
+		 */
+		void solveInPlace(MatrixView B) const;
+
+		vector<double> solve(const vector<double>& b) const;
+		Matrix solve(ConstMatrixView B) const;
+	};
+
+	// Blokowy rozkład LU w miejscu (wynik jak w LU::factors()). Rzuca runtime_error
+	// dla macierzy osobliwej.
+	void luFactorInPlace(MatrixView A, vector<int>& piv, int blockSize = LU::DEFAULT_BLOCK_SIZE);
+
+	/**
+	 * @brief Rozkład Cholesky'ego A = L L^T macierzy symetrycznej dodatnio określonej
+	 *
+	 * Liczony blokowo jak LU (blok przekątny, panel L21, aktualizacja
+	 * A22 -= L21 L21^T tylko w dolnym trójkącie), bez wyboru elementu głównego.
+	 * Wykorzystywany jest wyłącznie dolny trójkąt A. Wymaga około połowy
+	 * operacji rozkładu LU.
+	 */
+	class Cholesky {
+	private:
+		Matrix l;   // czynnik L (górny trójkąt wyzerowany)
+
+	public:
+		/**
+		 * @brief Rozkłada macierz A
+		 * @throw runtime_error jeśli A nie jest dodatnio określona
+		 */
+		explicit Cholesky(ConstMatrixView A, int blockSize = LU::DEFAULT_BLOCK_SIZE);
+
+		size_t size() const { return l.rows(); }
+		const Matrix& factor() const { return l; }
+
+		void solveInPlace(Span<double> b) const;
+		void solveInPlace(MatrixView B) const;
+
+		vector<double> solve(const vector<double>& b) const;
+		Matrix solve(ConstMatrixView B) const;
+
+		/**
+		 * @brief Zamienia czynnik na rozkład A + v v^T w czasie O(n^2)
+		 *
+		 * Wiersze L przetwarzane są kolejno: wiersz i przechodzi przez obroty
+		 * wyznaczone w wierszach 0..i-1 (jak w LINPACK dchud, ale w kolejności
+		 * wierszowej), więc L czytana jest sekwencyjnie.
+		 */
+		void update(Span<const double> v);
+
+		/**
+		 * @brief A + V V^T dla V o wymiarach n x k, w O(k n^2) i jednym przejściu przez L
+		 */
+		void update(ConstMatrixView V);
+
+		/**
+		 * @brief Zamienia czynnik na rozkład A - v v^T w czasie O(n^2)
+		 * @throw runtime_error jeśli A - v v^T nie jest dodatnio określona (czynnik bez zmian)
+		 */
+		void downdate(Span<const double> v);
+		void downdate(ConstMatrixView V);
+	};
+
+	// Blokowy rozkład Cholesky'ego w miejscu: dolny trójkąt A zastępowany jest
+	// czynnikiem L, górny nie jest zmieniany. Rzuca runtime_error, jeśli A nie
+	// jest dodatnio określona.
+	void choleskyFactorInPlace(MatrixView A, int blockSize = LU::DEFAULT_BLOCK_SIZE);
+
+	/**
+	 * @brief Wynik rozwiązania z iteracyjnym poprawianiem
+	 */
+	struct RefinementResult {
+		vector<double> x;   // rozwiązanie
+		int iterations;     // liczba wykonanych kroków poprawiania
+		double residual;    // końcowy błąd wsteczny ||b - Ax|| / (||A|| ||x||) w normie maksimum
+		bool fallback;      // true, jeśli wynik pochodzi z rozkładu w podwójnej precyzji
+	};
+
+	/**
+	 * @brief Rozkład LU w pojedynczej precyzji z iteracyjnym poprawianiem w podwójnej
+	 *
+	 * Macierz rozkładana jest w float tym samym algorytmem blokowym co LU, co
+	 * wymaga połowy przepustowości pamięci i mieści dwa razy więcej elementów
+	 * w rejestrze. Rozwiązanie poprawiane jest krokami r = b - Ax (double),
+	 * LU d = r (float), x += d, aż błąd wsteczny spadnie do poziomu
+	 * sqrt(n) * epsilon podwójnej precyzji.
+	 *
+	 * Jeśli rozkład w float się nie powiedzie albo poprawianie stoi w miejscu
+	 * (residuum maleje mniej niż dwukrotnie na krok), układ rozwiązywany jest
+	 * rozkładem LU w double. Rozkład ten liczony jest raz i używany dla kolejnych
+	 * prawych stron. Obiekt przechowuje kopię A potrzebną do liczenia residuów.
+	 */
+	class MixedLU {
+	private:
+		Matrix a;                   // kopia A w podwójnej precyzji
+		MatrixF lu;                 // czynniki L i U w pojedynczej precyzji
+		vector<int> piv;
+		double normA = 0.0;         // ||A|| w normie wierszowej
+		bool single = false;        // czy rozkład w float się powiódł
+		int block;                  // szerokość panelu dla obu rozkładów
+		unique_ptr<LU> fallbackLU;  // rozkład w double, tworzony przy pierwszej potrzebie
+
+		void solveSingle(vector<float>& b) const;
+
+	public:
+		static constexpr int DEFAULT_MAX_ITERATIONS = 30;
+
+		/**
+		 * @brief Rozkłada macierz kwadratową A w pojedynczej precyzji
+		 */
+		explicit MixedLU(ConstMatrixView A, int blockSize = LU::DEFAULT_BLOCK_SIZE);
+
+		size_t size() const { return a.rows(); }
+
+		// false, gdy rozkład w float się nie powiódł (np. elementy poza zakresem float)
+		bool usesSinglePrecision() const { return single; }
+
+		/**
+		 * @brief Rozwiązuje Ax = b z poprawianiem iteracyjnym
+		 * @param maxIterations limit kroków, po którego przekroczeniu używany jest rozkład w double
+		 * @throw runtime_error dla macierzy osobliwej
+		 */
+		RefinementResult solve(const vector<double>& b, int maxIterations = DEFAULT_MAX_ITERATIONS);
+	};
+
+	// Jednorazowe rozwiązanie układu przez MixedLU
+	RefinementResult MixedPrecisionSolve(ConstMatrixView A, const vector<double>& b);
+
+	/**
+	 * @brief Rozkład LU z poprawkami niskiego rzędu (wzór Shermana-Morrisona-Woodbury'ego)
+	 *
+	 * Obiekt reprezentuje macierz A = A0 + U V^T, gdzie A0 rozłożona jest
+	 * przez LU, a U i V (n x r) to poprawki zgromadzone od ostatniego rozkładu.
+	 * Rozwiązanie liczone jest jako
+	 *   x = y - Z C^-1 V^T y,  y = A0^-1 b,  Z = A0^-1 U,  C = I + V^T Z,
+	 * więc poprawka rzędu k kosztuje O(k n^2) (k rozwiązań z A0), a każde
+	 * rozwiązanie O(n^2 + r n). Gdy r przekroczyłoby maxRank, macierz
+	 * rozkładana jest od nowa - koszt O(n^3) rozkłada się na maxRank poprawek,
+	 * a błędy zaokrągleń wzoru nie narastają bez końca. Obiekt przechowuje
+	 * aktualną macierz A.
+	 */
+	class WoodburyLU {
+	private:
+		Matrix a;                   // aktualna macierz A0 + U V^T
+		LU base;                    // rozkład A0
+		Matrix z, v;                // n x maxRank: kolumny A0^-1 U i V (używane pierwsze r)
+		Matrix cap;                 // C = I + V^T Z (maxRank x maxRank, używany blok r x r)
+		Matrix capLU;               // rozkład LU bloku r x r macierzy C
+		vector<int> capPiv;
+		int r = 0;
+		int maxRank;
+
+		void rebuild(Matrix&& updated);
+
+	public:
+		static constexpr int DEFAULT_MAX_RANK = 32;
+
+		/**
+		 * @throw invalid_argument dla macierzy niekwadratowej lub ujemnego maxRank
+		 * @throw runtime_error dla macierzy osobliwej
+		 */
+		explicit WoodburyLU(ConstMatrixView A, int maxRank = DEFAULT_MAX_RANK);
+
+		size_t size() const { return a.rows(); }
+		int rank() const { return r; }
+		const Matrix& matrix() const { return a; }
+
+		/**
+		 * @brief A += U V^T (U, V: n x k)
+		 * @throw runtime_error gdy nowa macierz jest osobliwa (obiekt bez zmian)
+		 */
+		void update(ConstMatrixView U, ConstMatrixView V);
+
+		// A += u v^T
+		void update(Span<const double> u, Span<const double> v);
+
+		// Wiersz i macierzy A zwiększany o delta (poprawka e_i delta^T)
+		void updateRow(size_t i, Span<const double> delta);
+
+		// Kolumna j macierzy A zwiększana o delta (poprawka delta e_j^T)
+		void updateColumn(size_t j, Span<const double> delta);
+
+		// Rozkłada aktualną macierz od nowa (r = 0)
+		void refactor();
+
+		void solveInPlace(Span<double> b) const;
+		vector<double> solve(const vector<double>& b) const;
+	};
+
+	// Sprawdza, czy |A(i,j) - A(j,i)| <= tolerance * max(|A(i,j)|, |A(j,i)|, 1)
+	bool isSymmetric(ConstMatrixView A, double tolerance = 1e-12);
+
+	// Rozwiązuje Ax = b rozkładem Cholesky'ego, jeśli A jest symetryczna
+	// i dodatnio określona, a w przeciwnym razie rozkładem LU
+	vector<double> SolveSPD(ConstMatrixView A, const vector<double>& b);
 }
\ No newline at end of file
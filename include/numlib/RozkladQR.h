@@ -0,0 +1,105 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Macierz.h"
+
+namespace numlib {
+
+    /**
+     * @brief Rozkład QR macierzy m x n (m >= n) odbiciami Householdera
+     *
+     * Q = H_0 H_1 ... H_{n-1}, gdzie H_k = I - tau_k v_k v_k^T. Wektory v_k (bez
+     * jedynki na przekątnej) przechowywane są pod przekątną, a R nad nią.
+     *
+     * Bez wyboru kolumn rozkład liczony jest blokowo: panel blockSize kolumn
+     * rozkładany jest kolumna po kolumnie, a reszta macierzy aktualizowana
+     * jednym przekształceniem blokowym Q_panel = I - V T V^T (zwarta postać WY),
+     * czyli dwoma aktualizacjami rzędu blockSize. Wszystkie przebiegi czytają
+     * macierz wiersz po wierszu, a wiersze dzielone są na paski przetwarzane na
+     * puli wątków, więc rozkład dobrze korzysta z cache także dla bardzo
+     * wysokich macierzy (np. 10^6 x 50). Wynik nie zależy od liczby wątków.
+     *
+     * Z wyborem kolumn (columnPivoting = true) w kroku k wybierana jest kolumna
+     * o największej normie pozostałej części (algorytm Businger-Golub), dzięki
+     * czemu |R(k, k)| maleją, a rank() wyznacza rząd numeryczny. Ten wariant
+     * rozkłada kolumny pojedynczo; bloki WY służą tylko do stosowania Q.
+     */
+    class QR {
+    private:
+        Matrix qr;                  // wektory Householdera i R
+        std::vector<double> tau;
+        Matrix t;                   // czynniki T kolejnych bloków: wiersze k..k+nb-1, kolumny 0..nb-1
+        std::vector<int> perm;      // perm[j] - kolumna A na pozycji j
+        int block;
+        bool pivoting;
+
+        void factorBlocked();
+        void factorPivoted();
+        void buildT(std::size_t k, std::size_t nb);
+
+    public:
+        static constexpr int DEFAULT_BLOCK_SIZE = 32;
+
+        /**
+         * @brief Rozkłada macierz A (nie jest modyfikowana)
+         * @throw invalid_argument gdy A ma mniej wierszy niż kolumn
+         */
+        explicit QR(ConstMatrixView A, bool columnPivoting = false, int blockSize = DEFAULT_BLOCK_SIZE);
+
+        /**
+         * @brief Rozkłada macierz przejmując jej bufor (bez kopiowania)
+         */
+        explicit QR(Matrix&& A, bool columnPivoting = false, int blockSize = DEFAULT_BLOCK_SIZE);
+
+        std::size_t rows() const { return qr.rows(); }
+        std::size_t cols() const { return qr.cols(); }
+        const Matrix& factors() const { return qr; }
+        const std::vector<double>& reflectorScales() const { return tau; }
+
+        /**
+         * @brief Permutacja kolumn: kolumna j macierzy AP to kolumna perm[j] macierzy A
+         *
+         * Bez wyboru kolumn jest to permutacja identycznościowa.
+         */
+        const std::vector<int>& permutation() const { return perm; }
+
+        /**
+         * @brief Zwraca czynnik R (n x n, trójkątny górny)
+         */
+        Matrix R() const;
+
+        /**
+         * @brief Rząd numeryczny: liczba k, dla których |R(k, k)| > tolerance * |R(0, 0)|
+         * @param tolerance wartość ujemna oznacza max(m, n) * epsilon maszynowy
+         */
+        int rank(double tolerance = -1.0) const;
+
+        /**
+         * @brief b := Q^T b (b ma m elementów)
+         */
+        void applyQT(Span<double> b) const;
+
+        /**
+         * @brief b := Q b (b ma m elementów)
+         */
+        void applyQ(Span<double> b) const;
+
+        /**
+         * @brief Rozwiązanie zadania najmniejszych kwadratów min ||Ax - b||
+         *
+         * Dla macierzy kwadratowej jest to rozwiązanie układu Ax = b. Jeśli rozkład
+         * liczono z wyborem kolumn, a A ma rząd numeryczny r < n, zwracane jest
+         * rozwiązanie bazowe (n - r składowych równych zero).
+         *
+         * @throw runtime_error gdy R jest osobliwa (bez wyboru kolumn)
+         */
+        std::vector<double> solve(const std::vector<double>& b) const;
+    };
+
+    /**
+     * @brief Rozwiązuje zadanie najmniejszych kwadratów min ||Ax - b|| rozkładem QR
+     */
+    std::vector<double> LeastSquaresQR(ConstMatrixView A, const std::vector<double>& b,
+                                       bool columnPivoting = false);
+
+} // namespace numlib
@@ -0,0 +1,204 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Macierz.h"
+#include "MacierzRzadka.h"
+
+namespace numlib {
+
+    /**
+     * @brief Permutacja zmniejszająca wypełnienie czynników rozkładu
+     */
+    enum class FillOrdering {
+        Natural,    // bez permutacji
+        AMD,        // przybliżony minimalny stopień - zwykle najmniejsze wypełnienie
+        RCM         // odwrócony Cuthill-McKee - minimalizuje szerokość pasma
+    };
+
+    /**
+     * @brief Przybliżony minimalny stopień (AMD) dla wzorca A + A^T
+     *
+     * Eliminacja symulowana jest na grafie ilorazowym: wyeliminowana zmienna
+     * staje się elementem (kliką swoich sąsiadów), więc graf nigdy nie jest
+     * większy niż wzorzec A. Zamiast dokładnego stopnia używane jest jego
+     * górne oszacowanie |A_i| + |L_p \ i| + suma |L_e \ L_p| (Amestoy, Davis,
+     * Duff), liczone w czasie proporcjonalnym do rozmiaru list. Elementy
+     * zawarte w nowym elemencie są pochłaniane.
+     *
+     * @return perm, gdzie perm[k] to oryginalny indeks k-tej niewiadomej
+     * @throw invalid_argument dla macierzy niekwadratowej
+     */
+    std::vector<int> approximateMinimumDegree(const SparseMatrix& A);
+
+    /**
+     * @brief Odwrócony Cuthill-McKee dla wzorca A + A^T
+     *
+     * Przeszukiwanie wszerz od wierzchołka pseudoperyferyjnego (George-Liu)
+     * w każdej spójnej składowej, sąsiedzi dokładani w kolejności rosnącego
+     * stopnia; kolejność na końcu jest odwracana.
+     *
+     * @return perm, gdzie perm[k] to oryginalny indeks k-tej niewiadomej
+     * @throw invalid_argument dla macierzy niekwadratowej
+     */
+    std::vector<int> reverseCuthillMcKee(const SparseMatrix& A);
+
+    /**
+     * @brief Analiza symboliczna rozkładu rzadkiego (wspólna dla Cholesky'ego i LU)
+     *
+     * Dla wzorca A + A^T wyznacza permutację, drzewo eliminacji (w porządku
+     * postorder, co nie zmienia wypełnienia), liczby niezerowych w kolumnach L
+     * i podział na supernody - ciągi kolumn o tej samej strukturze poniżej
+     * bloku przekątnego. Wąskie sąsiednie supernody łączone są kosztem
+     * niewielkiej liczby jawnych zer w panelach. Supernod s obejmuje kolumny
+     * supernodeStarts()[s] .. supernodeStarts()[s+1]-1, a supernodeRows(s)
+     * to posortowane wiersze L poniżej jego bloku przekątnego (numeracja po
+     * permutacji).
+     *
+     * Analiza zależy tylko od wzorca, więc jeden obiekt może służyć do
+     * rozkładu wielu macierzy o tym samym wzorcu (SparseCholesky::factorize,
+     * SparseLU::factorize).
+     */
+    class SparseSymbolic {
+    private:
+        std::size_t n = 0;
+        FillOrdering method = FillOrdering::AMD;
+        std::vector<int> perm;                  // perm[k] - oryginalny indeks k-tej niewiadomej
+        std::vector<int> inverse;               // inverse[perm[k]] = k
+        std::vector<int> superStart;
+        std::vector<int> superOf;               // supernod każdej kolumny
+        std::vector<std::size_t> rowStart;      // wiersze supernodu s: rows[rowStart[s] .. rowStart[s+1]-1]
+        std::vector<int> rows;
+        std::vector<std::size_t> patternPtr;    // wzorzec A, dla którego wykonano analizę
+        std::vector<int> patternIdx;
+        std::size_t lnz = 0;
+
+    public:
+        /**
+         * @throw invalid_argument dla macierzy niekwadratowej
+         */
+        explicit SparseSymbolic(const SparseMatrix& A, FillOrdering ordering = FillOrdering::AMD);
+
+        std::size_t size() const { return n; }
+        FillOrdering ordering() const { return method; }
+        const std::vector<int>& permutation() const { return perm; }
+        const std::vector<int>& inversePermutation() const { return inverse; }
+
+        std::size_t supernodeCount() const { return superStart.size() - 1; }
+        const std::vector<int>& supernodeStarts() const { return superStart; }
+        int supernodeOf(std::size_t column) const { return superOf[column]; }
+        Span<const int> supernodeRows(std::size_t s) const {
+            return Span<const int>(rows.data() + rowStart[s], rowStart[s + 1] - rowStart[s]);
+        }
+
+        /**
+         * @brief Liczba elementów L przechowywanych w panelach (z przekątną i jawnymi zerami)
+         */
+        std::size_t factorNonzeros() const { return lnz; }
+
+        /**
+         * @brief Czy A ma dokładnie ten sam wzorzec co macierz analizowana
+         */
+        bool matches(const SparseMatrix& A) const;
+    };
+
+    /**
+     * @brief Rzadki supernodalny rozkład Cholesky'ego P A P^T = L L^T
+     *
+     * Każdy supernod przechowywany jest jako gęsty panel (blok przekątny
+     * i wiersze poniżej), rozkładany gęstymi jądrami: Cholesky bloku
+     * przekątnego i trsm dla części poniżej. Aktualizacja B B^T liczona jest
+     * przez gemm blokami - osobno dla kolumn każdego supernodu-przodka -
+     * i od razu rozrzucana do jego panelu. Duże panele liczone są więc
+     * z wydajnością gemm (także na puli wątków), małe prostymi pętlami.
+     *
+     * Wykorzystywany jest tylko dolny trójkąt A po permutacji - A musi być
+     * symetryczna. Położenie każdego niezerowego A w panelach wyznaczane jest
+     * raz, więc factorize dla nowych wartości tego samego wzorca kosztuje
+     * tylko rozkład numeryczny.
+     */
+    class SparseCholesky {
+    private:
+        SparseSymbolic symbolic;
+        std::vector<std::size_t> panelOffset;   // panel supernodu s: (ns + nr) x ns, wierszami
+        std::vector<std::size_t> target;        // położenie każdego niezerowego A w values
+        std::vector<double> values;
+        std::vector<double> work;               // blok aktualizacji dla jednego przodka
+
+    public:
+        /**
+         * @throw invalid_argument dla macierzy niekwadratowej
+         * @throw runtime_error jeśli A nie jest dodatnio określona
+         */
+        explicit SparseCholesky(const SparseMatrix& A, FillOrdering ordering = FillOrdering::AMD);
+        SparseCholesky(const SparseSymbolic& analysis, const SparseMatrix& A);
+
+        /**
+         * @brief Rozkłada nową macierz o wzorcu z analizy
+         * @throw invalid_argument gdy wzorzec A jest inny
+         * @throw runtime_error jeśli A nie jest dodatnio określona
+         */
+        void factorize(const SparseMatrix& A);
+
+        std::size_t size() const { return symbolic.size(); }
+        const SparseSymbolic& analysis() const { return symbolic; }
+
+        void solveInPlace(Span<double> b) const;
+        std::vector<double> solve(const std::vector<double>& b) const;
+    };
+
+    /**
+     * @brief Rzadki supernodalny rozkład LU
+     *
+     * Struktura L i U^T jest strukturą rozkładu Cholesky'ego wzorca A + A^T,
+     * więc używana jest ta sama analiza. Panel supernodu zawiera blok
+     * przekątny (L i U), wiersze L poniżej oraz kolumny U na prawo od niego.
+     * Blok przekątny rozkładany jest przez luFactorInPlace z częściowym
+     * wyborem elementu głównego, ograniczonym do wierszy supernodu (tak jak
+     * w solverach z wyborem w obrębie supernodów) - zamiany nie naruszają
+     * struktury. Dobrze działa dla macierzy z niezerową przekątną, np.
+     * dominujących przekątniowo; przy zbyt małym elemencie głównym
+     * w supernodzie rzucany jest runtime_error.
+     *
+     * Ograniczony wybór bywa mniej stabilny niż pełny, dlatego solve
+     * poprawia rozwiązanie iteracyjnie (r = b - Ax, LU d = r, x += d), aż
+     * błąd wsteczny ||r|| / (||A|| ||x||) spadnie do sqrt(n) * epsilon,
+     * najwyżej MAX_REFINEMENT razy. Obiekt przechowuje w tym celu kopię A.
+     */
+    class SparseLU {
+    private:
+        SparseSymbolic symbolic;
+        std::vector<std::size_t> panelOffset;   // jak w SparseCholesky
+        std::vector<std::size_t> upperOffset;   // część U supernodu s: ns x nr, wierszami
+        std::vector<std::size_t> target;
+        std::vector<double> values;
+        std::vector<int> pivots;                // zamiany wierszy w obrębie supernodów (indeksy lokalne)
+        std::vector<double> work;
+        SparseMatrix a;                         // kopia A do liczenia residuów
+        double normA = 0.0;                     // ||A|| w normie wierszowej
+
+        void substitute(Span<double> b) const;
+
+    public:
+        static constexpr int MAX_REFINEMENT = 3;
+
+        /**
+         * @throw invalid_argument dla macierzy niekwadratowej
+         * @throw runtime_error gdy element główny w supernodzie jest zbyt mały
+         */
+        explicit SparseLU(const SparseMatrix& A, FillOrdering ordering = FillOrdering::AMD);
+        SparseLU(const SparseSymbolic& analysis, const SparseMatrix& A);
+
+        /**
+         * @brief Rozkłada nową macierz o wzorcu z analizy
+         * @throw invalid_argument gdy wzorzec A jest inny
+         */
+        void factorize(const SparseMatrix& A);
+
+        std::size_t size() const { return symbolic.size(); }
+        const SparseSymbolic& analysis() const { return symbolic; }
+
+        void solveInPlace(Span<double> b) const;
+        std::vector<double> solve(const std::vector<double>& b) const;
+    };
+
+} // namespace numlib
@@ -0,0 +1,119 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Macierz.h"
+
+namespace numlib {
+
+    /**
+     * @brief Rozwiązuje układ trójdiagonalny algorytmem Thomasa w czasie O(n)
+     *
+     * Wiersz i układu ma postać lower[i-1] x[i-1] + diag[i] x[i] + upper[i] x[i+1] = rhs[i].
+     * Algorytm nie wybiera elementu głównego, więc wymaga np. dominującej przekątnej
+     * lub macierzy dodatnio określonej.
+     *
+     * @param lower poddiagonala (n-1 elementów)
+     * @param diag przekątna (n elementów)
+     * @param upper naddiagonala (n-1 elementów)
+     * @param rhs prawa strona (n elementów)
+     * @return wektor rozwiązań
+     * @throw runtime_error przy zerowym elemencie głównym
+     */
+    std::vector<double> Thomas(const std::vector<double>& lower, const std::vector<double>& diag,
+                               const std::vector<double>& upper, const std::vector<double>& rhs);
+
+    /**
+     * @brief Wersja algorytmu Thomasa bez alokacji: rozwiązanie nadpisuje rhs
+     * @param work bufor roboczy o długości co najmniej n
+     */
+    void ThomasInPlace(Span<const double> lower, Span<const double> diag, Span<const double> upper,
+                       Span<double> rhs, Span<double> work);
+
+    /**
+     * @brief Rozwiązuje jednocześnie batch układów trójdiagonalnych rozmiaru n
+     *
+     * Dane są przeplecione: element i układu s leży pod indeksem i * batch + s
+     * (lower i upper mają (n-1) * batch elementów, diag i rhs - n * batch).
+     * Najbardziej wewnętrzna pętla przebiega po układach, więc kompilator
+     * wektoryzuje ją, a kolejne paczki układów trafiają do puli wątków.
+     * Rozwiązania nadpisują rhs.
+     */
+    void ThomasBatched(std::size_t n, std::size_t batch,
+                       Span<const double> lower, Span<const double> diag, Span<const double> upper,
+                       Span<double> rhs);
+
+    /**
+     * @brief Macierz pasmowa w zwartym zapisie wierszowym
+     *
+     * Dla każdego wiersza i przechowywane są kolumny i-kl .. i+ku+kl, czyli
+     * 2*kl + ku + 1 wartości. Dodatkowe kl kolumn nad pasmem jest zerowe i
+     * służy na wypełnienie powstające przy zamianie wierszy w rozkładzie LU.
+     * Pamięć: O(n * (2*kl + ku + 1)).
+     */
+    class BandMatrix {
+    private:
+        std::size_t n, kl, ku, ld;
+        std::vector<double> data;
+
+        friend class BandLU;
+
+    public:
+        /**
+         * @brief Tworzy zerową macierz n x n o kl poddiagonalach i ku naddiagonalach
+         */
+        BandMatrix(std::size_t size, std::size_t lowerBandwidth, std::size_t upperBandwidth);
+
+        std::size_t size() const { return n; }
+        std::size_t lowerBandwidth() const { return kl; }
+        std::size_t upperBandwidth() const { return ku; }
+
+        /**
+         * @brief Czy element (i, j) należy do pasma
+         */
+        bool inBand(std::size_t i, std::size_t j) const {
+            return i < n && j < n && j + kl >= i && j <= i + ku;
+        }
+
+        /**
+         * @brief Dostęp do elementu pasma (bez sprawdzania zakresu)
+         */
+        double& operator()(std::size_t i, std::size_t j) { return data[i * ld + (j + kl - i)]; }
+
+        /**
+         * @brief Wartość elementu; poza pasmem zwraca 0
+         */
+        double operator()(std::size_t i, std::size_t j) const {
+            return inBand(i, j) ? data[i * ld + (j + kl - i)] : 0.0;
+        }
+
+        /**
+         * @brief Zwraca iloczyn A x
+         */
+        std::vector<double> multiply(const std::vector<double>& x) const;
+    };
+
+    /**
+     * @brief Rozkład LU macierzy pasmowej z częściowym wyborem elementu głównego
+     *
+     * Czas rozkładu O(n * kl * (kl + ku)), rozwiązania O(n * (2*kl + ku)).
+     * Czynniki przechowywane są w tym samym zwartym zapisie co macierz.
+     */
+    class BandLU {
+    private:
+        BandMatrix lu;
+        std::vector<std::size_t> piv;
+
+    public:
+        /**
+         * @brief Rozkłada macierz (przekazaną przez wartość - można ją przenieść)
+         * @throw runtime_error dla macierzy osobliwej
+         */
+        explicit BandLU(BandMatrix A);
+
+        std::size_t size() const { return lu.size(); }
+
+        void solveInPlace(Span<double> b) const;
+        std::vector<double> solve(const std::vector<double>& b) const;
+    };
+
+} // namespace numlib
@@ -0,0 +1,104 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "Macierz.h"
+
+namespace numlib {
+
+    /**
+     * @brief Rozwiązuje układ Toeplitza T x = rhs rekurencją Levinsona-Trencha w czasie O(n^2)
+     *
+     * T(i, j) = t_{i-j} jest zadana pierwszą kolumną (column[k] = T(k, 0))
+     * i pierwszym wierszem (row[k] = T(0, k)), column[0] == row[0]. Dla
+     * kolejnych wiodących podmacierzy T_k aktualizowane są wektory f, b
+     * (T_k f = e_1, T_k b = e_k) i rozwiązanie - macierz nie jest nigdy
+     * tworzona, pamięć to O(n). Metoda wymaga nieosobliwości wszystkich
+     * wiodących podmacierzy (nie wybiera elementu głównego).
+     *
+     * @throw invalid_argument przy niezgodnych długościach lub column[0] != row[0]
+     * @throw runtime_error gdy wiodąca podmacierz jest osobliwa
+     */
+    std::vector<double> ToeplitzSolve(const std::vector<double>& column, const std::vector<double>& row,
+                                      const std::vector<double>& rhs);
+
+    /**
+     * @brief Układ z symetryczną dodatnio określoną macierzą Toeplitza T(i, j) = r_{|i-j|}
+     *
+     * Algorytm Levinsona (Golub, Van Loan 4.7.2) - około 4 n^2 działań,
+     * połowa kosztu wersji niesymetrycznej. Typowe zastosowanie to macierz
+     * autokorelacji sygnału.
+     *
+     * @param r pierwszy wiersz (n elementów)
+     * @throw invalid_argument przy niezgodnych długościach
+     * @throw runtime_error jeśli T nie jest dodatnio określona
+     */
+    std::vector<double> SymmetricToeplitzSolve(const std::vector<double>& r, const std::vector<double>& rhs);
+
+    /**
+     * @brief Wynik rekurencji Levinsona-Durbina
+     *
+     * coefficients[k-1] = a_k modelu autoregresyjnego x_t = sum a_k x_{t-k} + e_t,
+     * reflection[k-1] to współczynnik odbicia (PARCOR) rzędu k, czyli a_k
+     * modelu rzędu k, a error - wariancja błędu predykcji r_0 prod(1 - reflection^2).
+     */
+    struct LevinsonDurbinResult {
+        std::vector<double> coefficients;
+        std::vector<double> reflection;
+        double error;
+    };
+
+    /**
+     * @brief Równania Yule'a-Walkera T(r_0..r_{p-1}) a = (r_1..r_p) algorytmem Durbina w O(p^2)
+     *
+     * @param autocorrelation r_0 .. r_p (co najmniej order + 1 elementów)
+     * @throw invalid_argument gdy brakuje wartości autokorelacji
+     * @throw runtime_error gdy macierz autokorelacji nie jest dodatnio określona
+     */
+    LevinsonDurbinResult LevinsonDurbin(const std::vector<double>& autocorrelation, std::size_t order);
+
+    /**
+     * @brief Odwrotność symetrycznej dodatnio określonej macierzy Toeplitza algorytmem Trencha
+     *
+     * Po jednym rozwiązaniu Durbina pierwszy wiersz odwrotności jest znany,
+     * a pozostałe elementy wyznacza rekurencja wzdłuż przekątnych; wystarczy
+     * policzyć ćwiartkę elementów, resztę daje symetria i persymetria.
+     * Koszt O(n^2) zamiast O(n^3).
+     *
+     * @throw runtime_error jeśli T nie jest dodatnio określona
+     */
+    Matrix SymmetricToeplitzInverse(const std::vector<double>& r);
+
+    /**
+     * @brief Współczynniki wielomianu interpolacyjnego w bazie potęgowej - układ Vandermonde'a
+     *
+     * Rozwiązuje sum_j a_j x_i^j = values[i] algorytmem Björcka-Pereyry
+     * w czasie O(n^2) i pamięci O(n): pierwszy etap to ilorazy różnicowe
+     * (DividedDiff), drugi - zamiana postaci Newtona na potęgową
+     * (NewtonToMonomial). Wyniki są zwykle dokładniejsze niż z eliminacji
+     * Gaussa na jawnej macierzy, szczególnie dla węzłów uporządkowanych
+     * rosnąco.
+     *
+     * @param nodes węzły x_i (te same co dla DividedDiff), parami różne
+     * @return a_0 .. a_{n-1}
+     * @throw invalid_argument przy niezgodnych długościach
+     * @throw runtime_error gdy węzły się powtarzają
+     */
+    std::vector<double> VandermondeSolve(const std::vector<double>& nodes, const std::vector<double>& values);
+
+    /**
+     * @brief Układ transponowany sum_i w_i x_i^j = rhs[j], j = 0..n-1 (Björck-Pereyra)
+     *
+     * Np. wagi kwadratury o zadanych węzłach z momentów rhs[j] = całka x^j.
+     *
+     * @throw invalid_argument przy niezgodnych długościach
+     * @throw runtime_error gdy węzły się powtarzają
+     */
+    std::vector<double> VandermondeTransposeSolve(const std::vector<double>& nodes, const std::vector<double>& rhs);
+
+    /**
+     * @brief Zamienia współczynniki postaci Newtona (np. z DividedDiff) na współczynniki potęgowe w O(n^2)
+     * @throw invalid_argument przy niezgodnych długościach
+     */
+    std::vector<double> NewtonToMonomial(const std::vector<double>& nodes, const std::vector<double>& coeffs);
+
+} // namespace numlib
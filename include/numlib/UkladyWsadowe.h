@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include "Macierz.h"
+
+namespace numlib {
+
+    /**
+     * @brief Największy rozmiar układu obsługiwany przez SolveSmallBatched
+     */
+    constexpr int MAX_SMALL_SYSTEM = 16;
+
+    /**
+     * @brief Rozwiązuje jednocześnie batch niezależnych układów N x N (eliminacja Gaussa
+     * z częściowym wyborem elementu głównego)
+     *
+     * Dane w układzie struktury tablic (SoA): element (i, j) macierzy układu s leży pod
+     * indeksem (i * N + j) * batch + s, a element i prawej strony pod i * batch + s.
+     * Rozmiar N jest stałą kompilacji, więc pętle po i, j mają znaną liczbę obrotów,
+     * a wektoryzowana jest pętla po kolejnych układach. Wybór elementu głównego
+     * odbywa się niezależnie w każdym układzie (bez rozgałęzień). Paczki układów
+     * trafiają do puli wątków. Rozwiązania nadpisują b. Gdy zostanie rzucony
+     * wyjątek, b jest częściowo nadpisane: część układów jest już rozwiązana,
+     * a pozostałe mają pierwotne prawe strony lub wartości pośrednie.
+     *
+     * Dostępne dla 1 <= N <= MAX_SMALL_SYSTEM.
+     *
+     * @throw invalid_argument przy niezgodnych rozmiarach tablic
+     * @throw runtime_error gdy któryś z układów jest osobliwy (element główny
+     * o module mniejszym niż 1e-10, jak w LU i GaussSolve)
+     */
+    template<int N>
+    void SolveSmallBatched(std::size_t batch, Span<const double> A, Span<double> b);
+
+    /**
+     * @brief Jak wyżej, z rozmiarem układu podanym w czasie wykonania
+     * @throw invalid_argument gdy n nie należy do 1..MAX_SMALL_SYSTEM
+     */
+    void SolveSmallBatched(int n, std::size_t batch, Span<const double> A, Span<double> b);
+
+} // namespace numlib
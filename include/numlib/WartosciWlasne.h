@@ -0,0 +1,143 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Macierz.h"
+
+namespace numlib {
+
+    /**
+     * @brief Wartości własne w kolejności rosnącej i odpowiadające im wektory własne
+     *
+     * Kolumna j macierzy vectors (n x m) to unormowany wektor własny dla
+     * values[j]. Gdy liczone są same wartości, vectors jest pusta.
+     */
+    struct EigenDecomposition {
+        std::vector<double> values;
+        Matrix vectors;
+    };
+
+    /**
+     * @brief Redukcja macierzy symetrycznej do postaci trójdiagonalnej A = Q T Q^T
+     *
+     * Q = H_0 H_1 ... H_{n-2}, gdzie H_k = I - tau_k v_k v_k^T zeruje kolumnę k
+     * poniżej poddiagonali. Wektory v_k przechowywane są pod poddiagonalą.
+     *
+     * Redukcja jest blokowa (jak dsytrd z LAPACK-a): w panelu blockSize kolumn
+     * odbicia wyznaczane są kolumna po kolumnie, a zmiany pozostałej części
+     * macierzy zbierane w macierzach V i W. Po panelu reszta macierzy
+     * aktualizowana jest jednym gemm: A -= V W^T + W V^T. Mnożenie A v
+     * w panelu czyta tylko dolny trójkąt, dzieląc wiersze na paski wykonywane
+     * na puli wątków - ta część jest ograniczona przepustowością pamięci
+     * i zajmuje mniej więcej połowę czasu. Wynik nie zależy od liczby wątków.
+     *
+     * Wykorzystywany jest tylko dolny trójkąt A.
+     */
+    class Tridiagonalization {
+    private:
+        Matrix a;                       // wektory Householdera pod poddiagonalą
+        std::vector<double> d, e, tau;
+        int block;
+
+        void reduce();
+
+    public:
+        static constexpr int DEFAULT_BLOCK_SIZE = 32;
+
+        /**
+         * @throw invalid_argument dla macierzy niekwadratowej lub blockSize <= 0
+         */
+        explicit Tridiagonalization(ConstMatrixView A, int blockSize = DEFAULT_BLOCK_SIZE);
+
+        /**
+         * @brief Redukuje macierz przejmując jej bufor (bez kopiowania)
+         */
+        explicit Tridiagonalization(Matrix&& A, int blockSize = DEFAULT_BLOCK_SIZE);
+
+        std::size_t size() const { return d.size(); }
+
+        /**
+         * @brief Przekątna T (n elementów)
+         */
+        const std::vector<double>& diagonal() const { return d; }
+
+        /**
+         * @brief Poddiagonala T (n - 1 elementów)
+         */
+        const std::vector<double>& offDiagonal() const { return e; }
+
+        /**
+         * @brief Z := Q Z (Z ma n wierszy), odbiciami zebranymi w bloki I - V T V^T
+         */
+        void applyQ(MatrixView Z) const;
+
+        /**
+         * @brief Jawna macierz ortogonalna Q
+         */
+        Matrix Q() const;
+    };
+
+    /**
+     * @brief Wszystkie wartości (i wektory) własne symetrycznej macierzy trójdiagonalnej
+     *
+     * Same wartości liczone są niejawną metodą QL z przesunięciem Wilkinsona
+     * w czasie O(n^2). Wektory własne liczone są metodą "dziel i zwyciężaj"
+     * (Cuppen): macierz dzielona jest na pół poprawką rzędu 1, połówki
+     * rozwiązywane rekurencyjnie (do rozmiaru kilkudziesięciu - metodą QL),
+     * a wyniki łączone przez równanie sekularne
+     * 1 + rho sum z_j^2 / (d_j - lambda) = 0. Składowe o małym z_j i bliskie
+     * wartości d_j są odrzucane (deflacja), pierwiastki równania liczone są
+     * krokami modelu wymiernego z zabezpieczeniem bisekcją, a wektor z jest
+     * odtwarzany z obliczonych wartości (Gu, Eisenstat), co zapewnia
+     * ortogonalność wektorów. Wektory powstają przez gemm, więc koszt
+     * łączenia zależy od liczby nieodrzuconych składowych.
+     *
+     * Podproblemy o rozmiarze do kilkuset rozwiązywane są równolegle na puli
+     * wątków, a większe łączenia korzystają z wielowątkowego gemm. Wynik nie
+     * zależy od liczby wątków.
+     *
+     * @param d przekątna (n elementów)
+     * @param e poddiagonala (n - 1 elementów)
+     * @throw invalid_argument przy niezgodnych długościach
+     * @throw runtime_error gdy metoda QL nie zbiega
+     */
+    EigenDecomposition TridiagonalEigen(const std::vector<double>& d, const std::vector<double>& e,
+                                        bool computeVectors = true);
+
+    /**
+     * @brief Wartości (i wektory) własne macierzy trójdiagonalnej z przedziału (lower, upper]
+     *
+     * Wartości wyznaczane są bisekcją z ciągiem Sturma (każda niezależnie, na
+     * puli wątków), wektory - odwrotną iteracją z rozkładem LU T - lambda I,
+     * ortogonalizowane w obrębie skupisk bliskich wartości. Koszt to
+     * O(n m) dla m wartości, więc dla małej części widma jest to dużo taniej
+     * niż pełny rozkład.
+     */
+    EigenDecomposition TridiagonalEigenRange(const std::vector<double>& d, const std::vector<double>& e,
+                                             double lower, double upper, bool computeVectors = true);
+
+    /**
+     * @brief Rozkład własny macierzy symetrycznej A = V diag(values) V^T
+     *
+     * Tridiagonalization, a następnie TridiagonalEigen; wektory własne T
+     * przekształcane są do wektorów A przez Tridiagonalization::applyQ.
+     * Wykorzystywany jest tylko dolny trójkąt A.
+     *
+     * @throw invalid_argument dla macierzy niekwadratowej
+     */
+    EigenDecomposition SymmetricEigen(ConstMatrixView A, bool computeVectors = true);
+
+    /**
+     * @brief Wartości (i wektory) własne macierzy symetrycznej z przedziału (lower, upper]
+     * @throw invalid_argument dla macierzy niekwadratowej lub lower > upper
+     */
+    EigenDecomposition SymmetricEigenRange(ConstMatrixView A, double lower, double upper,
+                                           bool computeVectors = true);
+
+    /**
+     * @brief Wartości (i wektory) własne o numerach first..last (licząc rosnąco od 0)
+     * @throw invalid_argument dla macierzy niekwadratowej lub nieprawidłowych numerów
+     */
+    EigenDecomposition SymmetricEigenIndex(ConstMatrixView A, std::size_t first, std::size_t last,
+                                           bool computeVectors = true);
+
+} // namespace numlib
@@ -0,0 +1,141 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include "Macierz.h"
+#include "MacierzRzadka.h"
+#include "MetodyKrylowa.h"
+#include "RozkladRzadki.h"
+
+namespace numlib {
+
+    /**
+     * @brief Która część widma jest szukana
+     *
+     * Dla metody Arnoldiego Largest i Smallest dotyczą części rzeczywistej.
+     */
+    enum class EigenTarget {
+        Largest,            // największe wartości
+        Smallest,           // najmniejsze wartości
+        LargestMagnitude    // największe |lambda|
+    };
+
+    /**
+     * @brief Parametry metod Lanczosa i Arnoldiego
+     */
+    struct KrylovEigenOptions {
+        EigenTarget target = EigenTarget::Largest;
+        std::size_t subspace = 0;       // wymiar podprzestrzeni m (0 - max(2 nev + 1, 20), najwyżej n)
+        double tolerance = 1e-10;       // para zbiega, gdy ||A x - theta x|| <= tolerance * max(|theta|, eps^(2/3))
+        int maxRestarts = 500;
+        std::vector<double> start;      // wektor startowy (pusty - pseudolosowy, zawsze ten sam)
+    };
+
+    /**
+     * @brief Wynik metody Lanczosa (wartości rzeczywiste)
+     *
+     * Wartości uporządkowane są od najlepiej pasującej do celu (np. dla
+     * Smallest rosnąco, dla przesunięcia - od najbliższej sigma). Kolumna j
+     * macierzy vectors (n x nev) to unormowany wektor własny dla values[j].
+     */
+    struct SparseEigenResult {
+        std::vector<double> values;
+        Matrix vectors;
+        std::vector<double> residuals;  // oszacowania ||Op x - theta x|| dla operatora Op, na którym liczono
+        int restarts = 0;
+        int operations = 0;             // liczba wywołań operatora
+        bool converged = false;
+    };
+
+    /**
+     * @brief Wynik metody Arnoldiego (wartości zespolone)
+     *
+     * Pary sprzężone zajmują sąsiednie pozycje, najpierw wartość z dodatnią
+     * częścią urojoną. Dla takiej pary w pozycjach j, j+1 kolumny vectors
+     * to część rzeczywista i urojona wektora: x_j = v_j + i v_{j+1},
+     * x_{j+1} = v_j - i v_{j+1} (jak w LAPACK-u), a wektor zespolony ma normę 1.
+     * Jeśli ostatnia z nev wartości ma parę sprzężoną, zwracana jest także
+     * ona (nev + 1 wartości).
+     */
+    struct ArnoldiResult {
+        std::vector<std::complex<double>> values;
+        Matrix vectors;
+        std::vector<double> residuals;
+        int restarts = 0;
+        int operations = 0;
+        bool converged = false;
+    };
+
+    /**
+     * @brief Niejawnie restartowana metoda Lanczosa dla operatora symetrycznego
+     *
+     * Baza Kryłowa długości m budowana jest z pełną reortogonalizacją
+     * (dwukrotny klasyczny Gram-Schmidt), więc wektory pozostają ortogonalne
+     * bez śledzenia utraty ortogonalności. Po zbudowaniu bazy liczony jest
+     * rozkład własny macierzy rzutu m x m (SymmetricEigen), a m - k
+     * niechcianych wartości Ritza służy jako dokładne przesunięcia niejawnego
+     * restartu (Sorensen): k kroków QR z przesunięciem na małej macierzy
+     * i jedna kombinacja liniowa wektorów bazy (gemm) skracają bazę do k
+     * wektorów bez nowych mnożeń przez A. Restarty powtarzane są aż do
+     * zbieżności nev par.
+     *
+     * Pamięć to O(n m): baza przechowywana jest wierszami macierzy (m + 1) x n
+     * i bufor na restart. Iloczyny skalarne i aktualizacje w ortogonalizacji
+     * liczone są paskami na puli wątków z sumowaniem częściowych wyników
+     * w stałej kolejności, restart i wektory Ritza - wielowątkowym gemm.
+     * Wynik nie zależy od liczby wątków (o ile nie zależy od niej operator).
+     *
+     * @param A operator y = A x (A symetryczna)
+     * @param n wymiar
+     * @throw invalid_argument gdy nev == 0, nev >= n lub subspace <= nev
+     */
+    SparseEigenResult Lanczos(const LinearOperator& A, std::size_t n, std::size_t nev,
+                              const KrylovEigenOptions& options = {});
+    SparseEigenResult Lanczos(const SparseMatrix& A, std::size_t nev, const KrylovEigenOptions& options = {});
+
+    /**
+     * @brief Wartości własne macierzy symetrycznej najbliższe sigma (przesunięcie i odwrócenie)
+     *
+     * Metoda Lanczosa dla (A - sigma I)^-1 z celem LargestMagnitude; wartości
+     * theta przekształcane są do lambda = sigma + 1 / theta. Wartości wewnątrz
+     * widma i najmniejsze wartości zbiegają tak szybko jak skrajne.
+     * options.target jest pomijany, a residuals dotyczą operatora odwrotnego.
+     *
+     * @param solve y = (A - sigma I)^-1 x, np. z gotowego rozkładu
+     */
+    SparseEigenResult LanczosShiftInvert(const LinearOperator& solve, std::size_t n, double sigma,
+                                         std::size_t nev, const KrylovEigenOptions& options = {});
+    /**
+     * @param factorization rozkład A - sigma I
+     */
+    SparseEigenResult LanczosShiftInvert(const SparseLU& factorization, double sigma, std::size_t nev,
+                                         const KrylovEigenOptions& options = {});
+    SparseEigenResult LanczosShiftInvert(const SparseCholesky& factorization, double sigma, std::size_t nev,
+                                         const KrylovEigenOptions& options = {});
+
+    /**
+     * @brief Niejawnie restartowana metoda Arnoldiego dla dowolnego operatora
+     *
+     * Jak Lanczos, ale macierz rzutu jest górna Hessenberga: jej wartości
+     * liczone są metodą QR Francisa z podwójnym przesunięciem, a wektory
+     * odwrotną iteracją. Pary sprzężonych przesunięć stosowane są jednym
+     * krokiem z podwójnym przesunięciem w arytmetyce rzeczywistej, a granica
+     * restartu nie rozdziela par sprzężonych.
+     *
+     * @throw invalid_argument gdy nev == 0, nev + 1 >= n lub subspace <= nev + 1
+     * @throw runtime_error gdy metoda QR dla macierzy rzutu nie zbiega
+     */
+    ArnoldiResult Arnoldi(const LinearOperator& A, std::size_t n, std::size_t nev,
+                          const KrylovEigenOptions& options = {});
+    ArnoldiResult Arnoldi(const SparseMatrix& A, std::size_t nev, const KrylovEigenOptions& options = {});
+
+    /**
+     * @brief Wartości własne najbliższe rzeczywistego sigma (przesunięcie i odwrócenie)
+     * @param solve y = (A - sigma I)^-1 x
+     */
+    ArnoldiResult ArnoldiShiftInvert(const LinearOperator& solve, std::size_t n, double sigma,
+                                     std::size_t nev, const KrylovEigenOptions& options = {});
+    ArnoldiResult ArnoldiShiftInvert(const SparseLU& factorization, double sigma, std::size_t nev,
+                                     const KrylovEigenOptions& options = {});
+
+} // namespace numlib
@@ -0,0 +1,27 @@
+#pragma once
+#include <functional>
+
+namespace numlib {
+
+    /**
+     * @brief Ustawia liczbę wątków używanych przez równoległe algorytmy biblioteki
+     * @param n liczba wątków; 0 oznacza liczbę rdzeni zgłaszaną przez system
+     */
+    void setNumThreads(int n);
+
+    /**
+     * @brief Zwraca bieżącą liczbę wątków
+     */
+    int getNumThreads();
+
+    /**
+     * @brief Wykonuje body(i) dla i = 0..count-1 na puli wątków
+     *
+     * Każde zadanie wykonywane jest dokładnie raz przez jeden wątek, więc wynik
+     * nie zależy od liczby wątków, o ile zadania piszą do rozłącznych obszarów.
+     * Wywołanie zagnieżdżone (z wnętrza zadania) wykonuje się sekwencyjnie.
+     * Pierwszy wyjątek rzucony przez zadanie jest przekazywany do wywołującego.
+     */
+    void parallelFor(int count, const std::function<void(int)>& body);
+
+} // namespace numlib
@@ -3,6 +3,11 @@
 #include <algorithm>
 #include <stdexcept>
 #include <numeric>
+#include <limits>
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/RozkladQR.h"
+#include "../include/numlib/WartosciWlasne.h"
 
 namespace numlib {
 
@@ -158,12 +163,10 @@ namespace numlib {
                 throw std::runtime_error("Macierz jest osobliwa");
             }
 
-            // Eliminacja
+            // Eliminacja - aktualizacja wiersza tym samym jądrem AXPY co w LU
             for (int k = i + 1; k < n; ++k) {
                 double factor = matrix[k][i] / matrix[i][i];
-                for (int j = i; j < n; ++j) {
-                    matrix[k][j] -= factor * matrix[i][j];
-                }
+                simd::axpy(n - i, -factor, &matrix[i][i], &matrix[k][i]);
                 rhs[k] -= factor * rhs[i];
             }
         }
@@ -171,10 +174,7 @@ namespace numlib {
         // Podstawianie wsteczne
         std::vector<double> solution(n);
         for (int i = n - 1; i >= 0; --i) {
-            solution[i] = rhs[i];
-            for (int j = i + 1; j < n; ++j) {
-                solution[i] -= matrix[i][j] * solution[j];
-            }
+            solution[i] = rhs[i] - simd::dot(n - i - 1, matrix[i].data() + i + 1, solution.data() + i + 1);
             solution[i] /= matrix[i][i];
         }
 
@@ -213,10 +213,49 @@ namespace numlib {
                 rhs[i] = computeRightHandSide(i);
             }
 
-            // Rozwiązanie układu równań
-            auto solution = solveLinearSystem(gram_matrix, rhs);
-            coefficients = solution[0];
+            // Macierz Grama jest symetryczna i dodatnio określona - najpierw
+            // rozkład Cholesky'ego, a eliminacja Gaussa tylko gdy się nie powiedzie
+            // (np. dla prawie liniowo zależnych funkcji bazowych)
+            try {
+                Cholesky chol(Matrix::fromRows(gram_matrix));
+                coefficients = chol.solve(rhs);
+            } catch (const std::runtime_error&) {
+                auto solution = solveLinearSystem(gram_matrix, rhs);
+                coefficients = solution[0];
+            }
+
+            return true;
+
+        } catch (const std::exception& e) {
+            coefficients.clear();
+            return false;
+        }
+    }
+
+    bool ContinuousLeastSquares::approximateDiscrete() {
+        if (basis_functions.empty()) {
+            throw std::runtime_error("Brak funkcji bazowych");
+        }
+
+        if (data_points.size() < basis_functions.size()) {
+            throw std::runtime_error("Za mało punktów danych");
+        }
+
+        std::size_t m = data_points.size();
+        std::size_t n = basis_functions.size();
+
+        try {
+            // Macierz układu nadokreślonego: wiersz i to wartości funkcji bazowych w x_i
+            Matrix design(m, n);
+            std::vector<double> values(m);
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    design(i, j) = (*basis_functions[j])(data_points[i].x);
+                }
+                values[i] = data_points[i].y;
+            }
 
+            coefficients = QR(std::move(design), true).solve(values);
             return true;
 
         } catch (const std::exception& e) {
@@ -253,6 +292,24 @@ namespace numlib {
         return std::sqrt(sum_squared_error / data_points.size());
     }
 
+    double ContinuousLeastSquares::gramConditionNumber() const {
+        if (basis_functions.empty()) {
+            throw std::runtime_error("Brak funkcji bazowych");
+        }
+        int n = basis_functions.size();
+        Matrix gram(n, n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j <= i; ++j) {
+                gram(i, j) = computeGramMatrix(i, j);
+            }
+        }
+        std::vector<double> values = SymmetricEigen(gram, false).values;
+        if (values.front() <= 0.0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return values.back() / values.front();
+    }
+
     void ContinuousLeastSquares::clear() {
         basis_functions.clear();
         coefficients.clear();
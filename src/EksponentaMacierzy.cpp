@@ -0,0 +1,356 @@
+#include "../include/numlib/EksponentaMacierzy.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        // Największe ||A||_1, dla których aproksymacja Padé stopnia 3, 5, 7, 9, 13 ma błąd <= 2^-53 (Higham 2005)
+        const double THETA[] = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+                                2.097847961257068, 5.371920351148152};
+        const int DEGREES[] = {3, 5, 7, 9};
+        const double PADE_3[] = {120.0, 60.0, 12.0, 1.0};
+        const double PADE_5[] = {30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0};
+        const double PADE_7[] = {17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0};
+        const double PADE_9[] = {17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0,
+                                 2162160.0, 110880.0, 3960.0, 90.0, 1.0};
+        const double PADE_13[] = {64764752532480000.0, 32382376266240000.0, 7771770303897600.0,
+                                  1187353796428800.0, 129060195264000.0, 10559470521600.0,
+                                  670442572800.0, 33522128640.0, 1323241920.0, 40840800.0,
+                                  960960.0, 16380.0, 182.0, 1.0};
+
+        // Parametry doboru kroku z Expokit
+        const double STEP_SAFETY = 0.9;
+        const double ERROR_SAFETY = 1.2;
+        const int MAX_REJECTIONS = 10;
+
+        double oneNorm(ConstMatrixView A) {
+            double norm = 0.0;
+            for (std::size_t j = 0; j < A.cols(); j++) {
+                double sum = 0.0;
+                for (std::size_t i = 0; i < A.rows(); i++) sum += std::abs(A(i, j));
+                // !(sum <= norm) przepuszcza NaN, którego std::max by nie zauważył
+                if (!(sum <= norm)) norm = sum;
+            }
+            return norm;
+        }
+
+        // Y += a X
+        void addScaled(Matrix& Y, double a, ConstMatrixView X) {
+            for (std::size_t i = 0; i < Y.rows(); i++) {
+                simd::axpy(Y.cols(), a, X.row(i), Y.row(i));
+            }
+        }
+
+        // (V - U)^-1 (V + U)
+        Matrix padeQuotient(const Matrix& U, const Matrix& V) {
+            Matrix P = Matrix::copyOf(V.view()), Q = Matrix::copyOf(V.view());
+            addScaled(P, 1.0, U);
+            addScaled(Q, -1.0, U);
+            LU lu(std::move(Q));
+            lu.solveInPlace(P.view());
+            return P;
+        }
+
+        // Aproksymacja Padé stopnia m <= 9: U = A sum b_{2k+1} A^{2k}, V = sum b_{2k} A^{2k}
+        Matrix padeLow(ConstMatrixView A, int m) {
+            const double* b = m == 3 ? PADE_3 : m == 5 ? PADE_5 : m == 7 ? PADE_7 : PADE_9;
+            std::size_t n = A.rows();
+            Matrix A2 = multiply(A, A);
+            Matrix power = Matrix::identity(n);
+            Matrix odd(n, n), V(n, n);
+            for (int k = 0; 2 * k <= m; k++) {
+                if (k > 0) power = multiply(power, A2);
+                addScaled(V, b[2 * k], power);
+                addScaled(odd, b[2 * k + 1], power);
+            }
+            return padeQuotient(multiply(A, odd), V);
+        }
+
+        // Stopień 13: U = A [A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I], V analogicznie
+        Matrix pade13(ConstMatrixView A) {
+            const double* b = PADE_13;
+            std::size_t n = A.rows();
+            Matrix A2 = multiply(A, A), A4 = multiply(A2, A2), A6 = multiply(A2, A4);
+            Matrix I = Matrix::identity(n);
+
+            Matrix inner(n, n), odd(n, n);
+            addScaled(inner, b[13], A6);
+            addScaled(inner, b[11], A4);
+            addScaled(inner, b[9], A2);
+            gemm(Op::None, Op::None, 1.0, A6, inner, 0.0, odd.view());
+            addScaled(odd, b[7], A6);
+            addScaled(odd, b[5], A4);
+            addScaled(odd, b[3], A2);
+            addScaled(odd, b[1], I);
+
+            Matrix V(n, n);
+            inner = Matrix(n, n);
+            addScaled(inner, b[12], A6);
+            addScaled(inner, b[10], A4);
+            addScaled(inner, b[8], A2);
+            gemm(Op::None, Op::None, 1.0, A6, inner, 0.0, V.view());
+            addScaled(V, b[6], A6);
+            addScaled(V, b[4], A4);
+            addScaled(V, b[2], A2);
+            addScaled(V, b[0], I);
+            return padeQuotient(multiply(A, odd), V);
+        }
+
+        double norm2(const std::vector<double>& x) {
+            return std::sqrt(simd::dot(x.size(), x.data(), x.data()));
+        }
+
+        /*
+            expv (Sidje, Expokit) dla niemalejących chwil times >= 0 i znaku
+            czasu sign. anorm - ||A|| lub 0, jeśli nieznana (wtedy szacowana
+            z macierzy Hessenberga pierwszej bazy). Wiersz k wyniku to
+            e^{sign times[k] A} v.
+        */
+        Matrix krylovExponential(const LinearOperator& A, const std::vector<double>& v,
+                                 const std::vector<double>& times, double sign, double anorm,
+                                 double tolerance, int subspace) {
+            if (!(tolerance > 0.0) || subspace < 1) {
+                throw std::invalid_argument("Nieprawidłowe parametry metody Kryłowa");
+            }
+            for (std::size_t k = 0; k < times.size(); k++) {
+                if (!(times[k] >= 0.0) || (k > 0 && times[k] < times[k - 1])) {
+                    throw std::invalid_argument("Chwile muszą być nieujemne i niemalejące");
+                }
+            }
+            std::size_t n = v.size(), count = times.size();
+            Matrix out(count, n);
+            if (n == 0 || count == 0) return out;
+
+            std::size_t m = std::min<std::size_t>(subspace, n);
+            Matrix basis(m + 1, n), H(m + 2, m + 2);
+            std::vector<double> w = v, x(n), p(n);
+            double beta = norm2(w);
+            double tolAbs = tolerance * beta;
+            double tEnd = times.back(), tNow = 0.0, tNew = 0.0;
+            const double pi = std::acos(-1.0);
+            double fact = std::pow((m + 1) / std::exp(1.0), static_cast<double>(m + 1)) * std::sqrt(2.0 * pi * (m + 1));
+            bool stepKnown = false;
+            std::size_t next = 0;
+
+            auto emit = [&](const std::vector<double>& y) {
+                while (next < count && times[next] <= tNow) {
+                    std::copy(y.begin(), y.end(), out.row(next));
+                    next++;
+                }
+            };
+            // beta V(0:mx) F(0:mx, 0)
+            auto combine = [&](const Matrix& F, std::size_t mx, double* y) {
+                std::fill(y, y + n, 0.0);
+                for (std::size_t i = 0; i < mx; i++) simd::axpy(n, beta * F(i, 0), basis.row(i), y);
+            };
+
+            emit(w);
+            while (tNow < tEnd && beta > 0.0) {
+                // Baza Arnoldiego z bieżącego wektora (zmodyfikowany Gram-Schmidt)
+                double* v0 = basis.row(0);
+                for (std::size_t i = 0; i < n; i++) v0[i] = w[i] / beta;
+                H = Matrix(m + 2, m + 2);
+                std::size_t mb = m;
+                int k1 = 2;
+                for (std::size_t j = 0; j < m; j++) {
+                    std::copy(basis.row(j), basis.row(j) + n, x.begin());
+                    A(x, p);
+                    if (p.size() != n) {
+                        throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+                    }
+                    double hn = 0.0;
+                    for (std::size_t i = 0; i <= j; i++) {
+                        double h = simd::dot(n, basis.row(i), p.data());
+                        simd::axpy(n, -h, basis.row(i), p.data());
+                        H(i, j) = h;
+                        hn += h * h;
+                    }
+                    double s = norm2(p);
+                    if (s <= 1e-12 * std::sqrt(hn) || s == 0.0) {
+                        // Podprzestrzeń niezmiennicza - rozwiązanie dokładne dla dowolnego kroku
+                        k1 = 0;
+                        mb = j + 1;
+                        break;
+                    }
+                    H(j + 1, j) = s;
+                    double* vj = basis.row(j + 1);
+                    for (std::size_t i = 0; i < n; i++) vj[i] = p[i] / s;
+                }
+                double avnorm = 0.0;
+                if (k1 != 0) {
+                    H(m + 1, m) = 1.0;
+                    std::copy(basis.row(m), basis.row(m) + n, x.begin());
+                    A(x, p);
+                    avnorm = norm2(p);
+                }
+
+                if (!stepKnown) {
+                    if (anorm <= 0.0) {
+                        for (std::size_t i = 0; i < mb; i++) {
+                            double row = 0.0;
+                            for (std::size_t j = 0; j < mb; j++) row += std::abs(H(i, j));
+                            anorm = std::max(anorm, row);
+                        }
+                    }
+                    tNew = anorm > 0.0 ? std::pow(fact * tolerance / (4.0 * anorm), 1.0 / m) / anorm : tEnd;
+                    stepKnown = true;
+                }
+                double tStep = k1 == 0 ? tEnd - tNow : std::min(tEnd - tNow, tNew);
+
+                // Krok z oszacowaniem błędu; przy odrzuceniu baza jest używana ponownie
+                Matrix F;
+                double error = 0.0, xm = 1.0 / m;
+                std::size_t mx = mb + k1;
+                for (int reject = 0;; reject++) {
+                    Matrix S = Matrix::copyOf(H.block(0, 0, mx, mx));
+                    for (std::size_t i = 0; i < mx; i++) {
+                        for (std::size_t j = 0; j < mx; j++) S(i, j) *= sign * tStep;
+                    }
+                    F = expm(S);
+                    if (k1 == 0) break;
+                    double phi1 = std::abs(beta * F(m, 0)), phi2 = std::abs(beta * F(m + 1, 0) * avnorm);
+                    if (phi1 > 10.0 * phi2) {
+                        error = phi2;
+                    } else if (phi1 > phi2) {
+                        error = phi1 * phi2 / (phi1 - phi2);
+                    } else {
+                        error = phi1;
+                        xm = m > 1 ? 1.0 / (m - 1) : 1.0;
+                    }
+                    if (error <= ERROR_SAFETY * tStep * tolAbs) break;
+                    if (reject == MAX_REJECTIONS) {
+                        throw std::runtime_error("Krok metody Kryłowa nie osiąga zadanej dokładności");
+                    }
+                    tStep = STEP_SAFETY * tStep * std::pow(tStep * tolAbs / error, xm);
+                }
+                std::size_t used = mb + std::max(0, k1 - 1);
+
+                // Chwile wewnątrz kroku - z tej samej bazy
+                while (next < count && times[next] < tNow + tStep) {
+                    Matrix S = Matrix::copyOf(H.block(0, 0, mx, mx));
+                    double tau = times[next] - tNow;
+                    for (std::size_t i = 0; i < mx; i++) {
+                        for (std::size_t j = 0; j < mx; j++) S(i, j) *= sign * tau;
+                    }
+                    combine(expm(S), used, out.row(next));
+                    next++;
+                }
+
+                combine(F, used, w.data());
+                beta = norm2(w);
+                tNow = tStep >= tEnd - tNow ? tEnd : tNow + tStep;
+                emit(w);
+                tNew = error > 0.0 ? STEP_SAFETY * tStep * std::pow(tStep * tolAbs / error, xm) : tEnd - tNow;
+            }
+            // Po zerowym wektorze pozostałe wyniki są zerowe (out jest wyzerowana)
+            return out;
+        }
+
+        double infNorm(const SparseMatrix& A) {
+            double norm = 0.0;
+            const std::vector<std::size_t>& ptr = A.rowPointers();
+            const std::vector<double>& values = A.values();
+            for (std::size_t i = 0; i < A.rows(); i++) {
+                double sum = 0.0;
+                for (std::size_t p = ptr[i]; p < ptr[i + 1]; p++) sum += std::abs(values[p]);
+                norm = std::max(norm, sum);
+            }
+            return norm;
+        }
+
+        LinearOperator wrap(const SparseMatrix& A, const std::vector<double>& v) {
+            if (A.rows() != A.cols()) {
+                throw std::invalid_argument("Macierz musi być kwadratowa");
+            }
+            if (A.rows() != v.size()) {
+                throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+            }
+            return [&A](const std::vector<double>& x, std::vector<double>& y) {
+                A.multiply(Span<const double>(x), Span<double>(y));
+            };
+        }
+    }
+
+    Matrix expm(ConstMatrixView A) {
+        if (A.rows() != A.cols()) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        double norm = oneNorm(A);
+        if (!std::isfinite(norm)) {
+            throw std::invalid_argument("Macierz zawiera wartości nieskończone lub NaN");
+        }
+        for (int k = 0; k < 4; k++) {
+            if (norm <= THETA[k]) return padeLow(A, DEGREES[k]);
+        }
+        int s = std::max(0, static_cast<int>(std::ceil(std::log2(norm / THETA[4]))));
+        Matrix scaled = Matrix::copyOf(A);
+        double factor = std::ldexp(1.0, -s);
+        for (std::size_t i = 0; i < scaled.rows(); i++) {
+            for (std::size_t j = 0; j < scaled.cols(); j++) scaled(i, j) *= factor;
+        }
+        Matrix X = pade13(scaled);
+        for (int k = 0; k < s; k++) X = multiply(X, X);
+        return X;
+    }
+
+    std::vector<double> expmMultiply(const LinearOperator& A, const std::vector<double>& v, double t,
+                                     double tolerance, int subspace) {
+        Matrix out = krylovExponential(A, v, {std::abs(t)}, t < 0.0 ? -1.0 : 1.0, 0.0, tolerance, subspace);
+        return std::vector<double>(out.row(0), out.row(0) + v.size());
+    }
+
+    std::vector<double> expmMultiply(const SparseMatrix& A, const std::vector<double>& v, double t,
+                                     double tolerance, int subspace) {
+        Matrix out = krylovExponential(wrap(A, v), v, {std::abs(t)}, t < 0.0 ? -1.0 : 1.0, infNorm(A),
+                                       tolerance, subspace);
+        return std::vector<double>(out.row(0), out.row(0) + v.size());
+    }
+
+    Matrix expmMultiply(const LinearOperator& A, const std::vector<double>& v, const std::vector<double>& times,
+                        double tolerance, int subspace) {
+        return krylovExponential(A, v, times, 1.0, 0.0, tolerance, subspace);
+    }
+
+    Matrix expmMultiply(const SparseMatrix& A, const std::vector<double>& v, const std::vector<double>& times,
+                        double tolerance, int subspace) {
+        return krylovExponential(wrap(A, v), v, times, 1.0, infNorm(A), tolerance, subspace);
+    }
+
+    std::pair<std::vector<double>, Matrix> LinearODE(ConstMatrixView A, const std::vector<double>& y0,
+                                                     double t0, double h, int n) {
+        if (n <= 0) {
+            throw std::invalid_argument("Liczba kroków musi być dodatnia");
+        }
+        if (h <= 0) {
+            throw std::invalid_argument("Krok musi być dodatni");
+        }
+        if (A.rows() != A.cols()) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (y0.size() != A.rows()) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        std::size_t dim = y0.size();
+        Matrix hA = Matrix::copyOf(A);
+        for (std::size_t i = 0; i < dim; i++) {
+            for (std::size_t j = 0; j < dim; j++) hA(i, j) *= h;
+        }
+        Matrix E = expm(hA);
+
+        std::vector<double> t(n + 1);
+        Matrix Y(n + 1, dim);
+        std::copy(y0.begin(), y0.end(), Y.row(0));
+        t[0] = t0;
+        for (int k = 0; k < n; k++) {
+            for (std::size_t i = 0; i < dim; i++) Y(k + 1, i) = simd::dot(dim, E.row(i), Y.row(k));
+            t[k + 1] = t0 + (k + 1) * h;
+        }
+        return {t, Y};
+    }
+
+} // namespace numlib
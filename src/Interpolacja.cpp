@@ -1,6 +1,29 @@
 #include "../include/numlib/Interpolacja.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace numlib {
+    namespace {
+        // Paczki punktw niezalene od liczby wtkw - wynik zawsze ten sam
+        template <typename Body>
+        void inChunks(size_t m, const Body& body) {
+            const size_t CHUNK = 4096;
+            int chunks = static_cast<int>((m + CHUNK - 1) / CHUNK);
+            auto task = [&](int t) {
+                size_t p0 = t * CHUNK;
+                body(p0, min(m, p0 + CHUNK) - p0);
+            };
+            if (chunks > 1) {
+                parallelFor(chunks, task);
+            } else if (chunks == 1) {
+                task(0);
+            }
+        }
+    }
+
     vector<double> DividedDiff(const vector<double>& XIN, const vector<double>& FXIN) {
         int n = XIN.size();
         vector<double> coeffs = FXIN;  // Inicjalizacja wspczynnikw wartociami funkcji
@@ -30,4 +53,145 @@ namespace numlib {
         }
         return result;
     }
+
+    void NewtonEvaluate(const vector<double>& XIN, const vector<double>& coeffs,
+                        Span<const double> x, Span<double> out) {
+        if (XIN.size() != coeffs.size() || x.size() != out.size()) {
+            throw invalid_argument("Nieprawidowe wymiary wektora");
+        }
+        inChunks(x.size(), [&](size_t p0, size_t count) {
+            simd::newtonHorner(XIN.size(), XIN.data(), coeffs.data(), count, x.data() + p0, out.data() + p0);
+        });
+    }
+
+    vector<double> NewtonEvaluate(const vector<double>& XIN, const vector<double>& coeffs, const vector<double>& x) {
+        vector<double> out(x.size());
+        NewtonEvaluate(XIN, coeffs, x, out);
+        return out;
+    }
+
+    void NewtonInterpolator::addNode(double x, double fx) {
+        bool full = capacity > 0 && xs.size() == capacity;
+        size_t kept = full ? xs.size() - 1 : xs.size();
+        for (size_t k = 0; k < kept; k++) {
+            if (xs[k] == x) {
+                throw invalid_argument("Wzy interpolacji musz by parami rne");
+            }
+        }
+        if (full) {
+            removeOldest();
+        }
+
+        // Nowy wze staje si pierwszym: c'_0 = f(x), c'_k = (c_{k-1} - c'_{k-1}) / (x_{k-1} - x)
+        xs.insert(xs.begin(), x);
+        diagonal.insert(diagonal.begin(), fx);
+        for (size_t k = 1; k < xs.size(); k++) {
+            diagonal[k] = (diagonal[k] - diagonal[k - 1]) / (xs[k] - x);
+        }
+    }
+
+    void NewtonInterpolator::removeOldest() {
+        if (xs.empty()) {
+            throw runtime_error("Brak wzw interpolacji");
+        }
+        // Najstarszy wze wystpuje tylko w skadniku najwyszego rzdu
+        xs.pop_back();
+        diagonal.pop_back();
+    }
+
+    void NewtonInterpolator::clear() {
+        xs.clear();
+        diagonal.clear();
+    }
+
+    double NewtonInterpolator::operator()(double x) const {
+        size_t n = xs.size();
+        if (n == 0) return 0.0;
+        double r = diagonal[n - 1];
+        for (size_t i = n - 1; i-- > 0;) r = r * (x - xs[i]) + diagonal[i];
+        return r;
+    }
+
+    void NewtonInterpolator::evaluate(Span<const double> x, Span<double> out) const {
+        NewtonEvaluate(xs, diagonal, x, out);
+    }
+
+    vector<double> NewtonInterpolator::evaluate(const vector<double>& x) const {
+        return NewtonEvaluate(xs, diagonal, x);
+    }
+
+    BarycentricInterpolator::BarycentricInterpolator(const vector<double>& nodes, const vector<double>& values)
+        : xs(nodes), w(nodes.size()), fs(values) {
+        size_t n = nodes.size();
+        if (n == 0 || values.size() != n) {
+            throw invalid_argument("Nieprawidowe wymiary wektora");
+        }
+        // Czynniki (x_j - x_k) skalowane przez 4 / (b - a), by iloczyny nie wychodziy poza zakres double
+        auto range = minmax_element(nodes.begin(), nodes.end());
+        double scale = n > 1 ? 4.0 / (*range.second - *range.first) : 1.0;
+        for (size_t j = 0; j < n; j++) {
+            double product = 1.0;
+            for (size_t k = 0; k < n; k++) {
+                if (k == j) continue;
+                double d = nodes[j] - nodes[k];
+                if (d == 0.0) {
+                    throw invalid_argument("Wzy interpolacji musz by parami rne");
+                }
+                product *= scale * d;
+            }
+            w[j] = 1.0 / product;
+        }
+    }
+
+    BarycentricInterpolator BarycentricInterpolator::chebyshev(size_t n, double a, double b, ChebyshevKind kind) {
+        if (n == 0 || (kind == ChebyshevKind::Second && n == 1) || !(a < b)) {
+            throw invalid_argument("Nieprawidowe parametry wzw Czebyszewa");
+        }
+        const double pi = 3.14159265358979323846;
+        vector<double> nodes(n), weights(n);
+        double mid = 0.5 * (a + b), half = 0.5 * (b - a);
+        for (size_t j = 0; j < n; j++) {
+            double sign = j % 2 == 0 ? 1.0 : -1.0;
+            double angle;
+            if (kind == ChebyshevKind::First) {
+                // x_j = cos((2j + 1) pi / 2n), w_j = (-1)^j sin((2j + 1) pi / 2n)
+                angle = (2.0 * j + 1.0) * pi / (2.0 * n);
+                weights[j] = sign * sin(angle);
+            } else {
+                // x_j = cos(j pi / (n - 1)), w_j = (-1)^j, poowa na kocach
+                angle = j * pi / (n - 1);
+                weights[j] = (j == 0 || j == n - 1) ? 0.5 * sign : sign;
+            }
+            nodes[j] = mid + half * cos(angle);
+        }
+        return BarycentricInterpolator(move(nodes), move(weights), vector<double>(n, 0.0));
+    }
+
+    void BarycentricInterpolator::setValues(const vector<double>& values) {
+        if (values.size() != xs.size()) {
+            throw invalid_argument("Nieprawidowe wymiary wektora");
+        }
+        fs = values;
+    }
+
+    double BarycentricInterpolator::operator()(double x) const {
+        double y;
+        simd::barycentric(xs.size(), xs.data(), w.data(), fs.data(), 1, &x, &y);
+        return y;
+    }
+
+    void BarycentricInterpolator::evaluate(Span<const double> x, Span<double> out) const {
+        if (x.size() != out.size()) {
+            throw invalid_argument("Nieprawidowe wymiary wektora");
+        }
+        inChunks(x.size(), [&](size_t p0, size_t count) {
+            simd::barycentric(xs.size(), xs.data(), w.data(), fs.data(), count, x.data() + p0, out.data() + p0);
+        });
+    }
+
+    vector<double> BarycentricInterpolator::evaluate(const vector<double>& x) const {
+        vector<double> out(x.size());
+        evaluate(x, out);
+        return out;
+    }
 }
@@ -0,0 +1,825 @@
+#include "../include/numlib/JadraSIMD.h"
+#include "SIMDWewnetrzne.h"
+#include <atomic>
+
+namespace numlib {
+namespace simd {
+
+    namespace {
+
+        struct KernelTable {
+            void (*axpy)(std::size_t, double, const double*, double*);
+            double (*dot)(std::size_t, const double*, const double*);
+            void (*newtonHorner)(std::size_t, const double*, const double*, std::size_t, const double*, double*);
+            void (*barycentric)(std::size_t, const double*, const double*, const double*,
+                                std::size_t, const double*, double*);
+            void (*rankUpdate)(std::size_t, std::size_t, std::size_t,
+                               const double*, std::size_t, const double*, std::size_t,
+                               double*, std::size_t);
+            void (*axpyF)(std::size_t, float, const float*, float*);
+            void (*rankUpdateF)(std::size_t, std::size_t, std::size_t,
+                                const float*, std::size_t, const float*, std::size_t,
+                                float*, std::size_t);
+        };
+
+        // ---------------------------------------------------------------
+        // Wersja skalarna (zawsze dostępna)
+        // ---------------------------------------------------------------
+
+        void axpyScalar(std::size_t n, double a, const double* x, double* y) {
+            for (std::size_t i = 0; i < n; ++i) y[i] += a * x[i];
+        }
+
+        double dotScalar(std::size_t n, const double* x, const double* y) {
+            double s0 = 0.0, s1 = 0.0;
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                s0 += x[i] * y[i];
+                s1 += x[i + 1] * y[i + 1];
+            }
+            if (i < n) s0 += x[i] * y[i];
+            return s0 + s1;
+        }
+
+        void rankUpdateScalar(std::size_t m, std::size_t n, std::size_t k,
+                              const double* L, std::size_t ldl, const double* U, std::size_t ldu,
+                              double* C, std::size_t ldc) {
+            for (std::size_t i = 0; i < m; ++i) {
+                double* c = C + i * ldc;
+                const double* l = L + i * ldl;
+                for (std::size_t p = 0; p < k; ++p) {
+                    const double a = l[p];
+                    const double* u = U + p * ldu;
+                    for (std::size_t j = 0; j < n; ++j) c[j] -= a * u[j];
+                }
+            }
+        }
+
+        // Schemat Hornera dla postaci Newtona w jednym punkcie
+        inline double newtonPoint(std::size_t n, const double* nodes, const double* coeffs, double x) {
+            double r = coeffs[n - 1];
+            for (std::size_t i = n - 1; i-- > 0;) r = r * (x - nodes[i]) + coeffs[i];
+            return r;
+        }
+
+        void newtonHornerScalar(std::size_t n, const double* nodes, const double* coeffs,
+                                std::size_t m, const double* x, double* y) {
+            for (std::size_t p = 0; p < m; ++p) y[p] = newtonPoint(n, nodes, coeffs, x[p]);
+        }
+
+        // Druga postać barycentryczna w jednym punkcie; trafienie w węzeł daje f_j
+        inline double barycentricPoint(std::size_t n, const double* nodes, const double* weights,
+                                       const double* values, double x) {
+            double num = 0.0, den = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+                double d = x - nodes[j];
+                if (d == 0.0) return values[j];
+                double t = weights[j] / d;
+                num += t * values[j];
+                den += t;
+            }
+            return num / den;
+        }
+
+        void barycentricScalar(std::size_t n, const double* nodes, const double* weights, const double* values,
+                               std::size_t m, const double* x, double* y) {
+            for (std::size_t p = 0; p < m; ++p) y[p] = barycentricPoint(n, nodes, weights, values, x[p]);
+        }
+
+        // Wersje float dla poziomu skalarnego i SSE2 - prostą pętlę kompilator
+        // wektoryzuje sam (SSE2 jest bazowym zestawem instrukcji x86-64)
+        void axpyScalarF(std::size_t n, float a, const float* x, float* y) {
+            for (std::size_t i = 0; i < n; ++i) y[i] += a * x[i];
+        }
+
+        void rankUpdateScalarF(std::size_t m, std::size_t n, std::size_t k,
+                               const float* L, std::size_t ldl, const float* U, std::size_t ldu,
+                               float* C, std::size_t ldc) {
+            for (std::size_t i = 0; i < m; ++i) {
+                float* c = C + i * ldc;
+                const float* l = L + i * ldl;
+                for (std::size_t p = 0; p < k; ++p) {
+                    const float a = l[p];
+                    const float* u = U + p * ldu;
+                    for (std::size_t j = 0; j < n; ++j) c[j] -= a * u[j];
+                }
+            }
+        }
+
+#if NUMLIB_SIMD_X86
+        // ---------------------------------------------------------------
+        // SSE2 (2 x double)
+        // ---------------------------------------------------------------
+
+        NUMLIB_TARGET("sse2")
+        void axpySSE2(std::size_t n, double a, const double* x, double* y) {
+            __m128d va = _mm_set1_pd(a);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128d y0 = _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(va, _mm_loadu_pd(x + i)));
+                __m128d y1 = _mm_add_pd(_mm_loadu_pd(y + i + 2), _mm_mul_pd(va, _mm_loadu_pd(x + i + 2)));
+                _mm_storeu_pd(y + i, y0);
+                _mm_storeu_pd(y + i + 2, y1);
+            }
+            for (; i < n; ++i) y[i] += a * x[i];
+        }
+
+        NUMLIB_TARGET("sse2")
+        double dotSSE2(std::size_t n, const double* x, const double* y) {
+            __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i)));
+                s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_loadu_pd(x + i + 2), _mm_loadu_pd(y + i + 2)));
+            }
+            s0 = _mm_add_pd(s0, s1);
+            double tmp[2];
+            _mm_storeu_pd(tmp, s0);
+            double s = tmp[0] + tmp[1];
+            for (; i < n; ++i) s += x[i] * y[i];
+            return s;
+        }
+
+        NUMLIB_TARGET("sse2")
+        void rankUpdateSSE2(std::size_t m, std::size_t n, std::size_t k,
+                            const double* L, std::size_t ldl, const double* U, std::size_t ldu,
+                            double* C, std::size_t ldc) {
+            for (std::size_t i = 0; i < m; ++i) {
+                double* c = C + i * ldc;
+                const double* l = L + i * ldl;
+                std::size_t p = 0;
+                for (; p + 2 <= k; p += 2) {
+                    const double* u0 = U + p * ldu;
+                    const double* u1 = u0 + ldu;
+                    __m128d a0 = _mm_set1_pd(l[p]), a1 = _mm_set1_pd(l[p + 1]);
+                    std::size_t j = 0;
+                    for (; j + 2 <= n; j += 2) {
+                        __m128d t = _mm_add_pd(_mm_mul_pd(a0, _mm_loadu_pd(u0 + j)),
+                                               _mm_mul_pd(a1, _mm_loadu_pd(u1 + j)));
+                        _mm_storeu_pd(c + j, _mm_sub_pd(_mm_loadu_pd(c + j), t));
+                    }
+                    for (; j < n; ++j) c[j] -= l[p] * u0[j] + l[p + 1] * u1[j];
+                }
+                for (; p < k; ++p) {
+                    axpySSE2(n, -l[p], U + p * ldu, c);
+                }
+            }
+        }
+
+        // Łańcuch zależności r = r * (x - x_i) + c_i jest sekwencyjny, więc
+        // kilka niezależnych rejestrów punktów ukrywa opóźnienie mnożenia
+        NUMLIB_TARGET("sse2")
+        void newtonHornerSSE2(std::size_t n, const double* nodes, const double* coeffs,
+                              std::size_t m, const double* x, double* y) {
+            std::size_t p = 0;
+            for (; p + 4 <= m; p += 4) {
+                __m128d x0 = _mm_loadu_pd(x + p), x1 = _mm_loadu_pd(x + p + 2);
+                __m128d r0 = _mm_set1_pd(coeffs[n - 1]), r1 = r0;
+                for (std::size_t i = n - 1; i-- > 0;) {
+                    __m128d xi = _mm_set1_pd(nodes[i]), ci = _mm_set1_pd(coeffs[i]);
+                    r0 = _mm_add_pd(_mm_mul_pd(r0, _mm_sub_pd(x0, xi)), ci);
+                    r1 = _mm_add_pd(_mm_mul_pd(r1, _mm_sub_pd(x1, xi)), ci);
+                }
+                _mm_storeu_pd(y + p, r0);
+                _mm_storeu_pd(y + p + 2, r1);
+            }
+            for (; p < m; ++p) y[p] = newtonPoint(n, nodes, coeffs, x[p]);
+        }
+
+        // Punkty pokrywające się z węzłem zapamiętywane są maską: różnica
+        // zastępowana jest jedynką (bez nieskończoności), a wynik wartością f_j.
+        // Węzły brane są parami - jedno dzielenie 1 / (d_j d_k) zamiast dwóch,
+        // bo przepustowość dzielenia ogranicza tu szybkość.
+        NUMLIB_TARGET("sse2")
+        inline __m128d blendSSE2(__m128d a, __m128d b, __m128d mask) {
+            return _mm_or_pd(_mm_and_pd(mask, b), _mm_andnot_pd(mask, a));
+        }
+
+        template <int K>
+        NUMLIB_TARGET("sse2")
+        inline void barycentricBlockSSE2(std::size_t n, const double* nodes, const double* weights,
+                                         const double* values, const double* x, double* y) {
+            const __m128d zero = _mm_setzero_pd(), one = _mm_set1_pd(1.0);
+            __m128d xv[K], num[K], den[K], hv[K], hit[K];
+            for (int k = 0; k < K; ++k) {
+                xv[k] = _mm_loadu_pd(x + 2 * k);
+                num[k] = den[k] = hv[k] = hit[k] = zero;
+            }
+            std::size_t j = 0;
+            for (; j + 2 <= n; j += 2) {
+                __m128d xa = _mm_set1_pd(nodes[j]), xb = _mm_set1_pd(nodes[j + 1]);
+                __m128d wa = _mm_set1_pd(weights[j]), wb = _mm_set1_pd(weights[j + 1]);
+                __m128d fa = _mm_set1_pd(values[j]), fb = _mm_set1_pd(values[j + 1]);
+                for (int k = 0; k < K; ++k) {
+                    __m128d da = _mm_sub_pd(xv[k], xa), db = _mm_sub_pd(xv[k], xb);
+                    __m128d ha = _mm_cmpeq_pd(da, zero), hb = _mm_cmpeq_pd(db, zero);
+                    hv[k] = blendSSE2(blendSSE2(hv[k], fa, ha), fb, hb);
+                    hit[k] = _mm_or_pd(hit[k], _mm_or_pd(ha, hb));
+                    da = blendSSE2(da, one, ha);
+                    db = blendSSE2(db, one, hb);
+                    __m128d r = _mm_div_pd(one, _mm_mul_pd(da, db));
+                    __m128d ta = _mm_mul_pd(_mm_mul_pd(wa, db), r), tb = _mm_mul_pd(_mm_mul_pd(wb, da), r);
+                    den[k] = _mm_add_pd(den[k], _mm_add_pd(ta, tb));
+                    num[k] = _mm_add_pd(num[k], _mm_add_pd(_mm_mul_pd(ta, fa), _mm_mul_pd(tb, fb)));
+                }
+            }
+            if (j < n) {
+                __m128d xa = _mm_set1_pd(nodes[j]), wa = _mm_set1_pd(weights[j]), fa = _mm_set1_pd(values[j]);
+                for (int k = 0; k < K; ++k) {
+                    __m128d da = _mm_sub_pd(xv[k], xa);
+                    __m128d ha = _mm_cmpeq_pd(da, zero);
+                    hv[k] = blendSSE2(hv[k], fa, ha);
+                    hit[k] = _mm_or_pd(hit[k], ha);
+                    __m128d t = _mm_div_pd(wa, blendSSE2(da, one, ha));
+                    den[k] = _mm_add_pd(den[k], t);
+                    num[k] = _mm_add_pd(num[k], _mm_mul_pd(t, fa));
+                }
+            }
+            for (int k = 0; k < K; ++k) {
+                _mm_storeu_pd(y + 2 * k, blendSSE2(_mm_div_pd(num[k], den[k]), hv[k], hit[k]));
+            }
+        }
+
+        NUMLIB_TARGET("sse2")
+        void barycentricSSE2(std::size_t n, const double* nodes, const double* weights, const double* values,
+                             std::size_t m, const double* x, double* y) {
+            std::size_t p = 0;
+            for (; p + 4 <= m; p += 4) barycentricBlockSSE2<2>(n, nodes, weights, values, x + p, y + p);
+            for (; p + 2 <= m; p += 2) barycentricBlockSSE2<1>(n, nodes, weights, values, x + p, y + p);
+            for (; p < m; ++p) y[p] = barycentricPoint(n, nodes, weights, values, x[p]);
+        }
+
+        // ---------------------------------------------------------------
+        // AVX2 + FMA (4 x double)
+        // ---------------------------------------------------------------
+
+        NUMLIB_TARGET("avx2,fma")
+        void axpyAVX2(std::size_t n, double a, const double* x, double* y) {
+            __m256d va = _mm256_set1_pd(a);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256d y0 = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+                __m256d y1 = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4));
+                _mm256_storeu_pd(y + i, y0);
+                _mm256_storeu_pd(y + i + 4, y1);
+            }
+            for (; i < n; ++i) y[i] += a * x[i];
+        }
+
+        NUMLIB_TARGET("avx2,fma")
+        double dotAVX2(std::size_t n, const double* x, const double* y) {
+            __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+            __m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), s0);
+                s1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), s1);
+                s2 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 8), _mm256_loadu_pd(y + i + 8), s2);
+                s3 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 12), _mm256_loadu_pd(y + i + 12), s3);
+            }
+            for (; i + 4 <= n; i += 4) {
+                s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), s0);
+            }
+            s0 = _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3));
+            __m128d h = _mm_add_pd(_mm256_castpd256_pd128(s0), _mm256_extractf128_pd(s0, 1));
+            h = _mm_add_sd(h, _mm_unpackhi_pd(h, h));
+            double s = _mm_cvtsd_f64(h);
+            for (; i < n; ++i) s += x[i] * y[i];
+            return s;
+        }
+
+        NUMLIB_TARGET("avx2,fma")
+        void rankUpdateAVX2(std::size_t m, std::size_t n, std::size_t k,
+                            const double* L, std::size_t ldl, const double* U, std::size_t ldu,
+                            double* C, std::size_t ldc) {
+            for (std::size_t i = 0; i < m; ++i) {
+                double* c = C + i * ldc;
+                const double* l = L + i * ldl;
+                std::size_t p = 0;
+                // Cztery wiersze U na jeden odczyt/zapis C
+                for (; p + 4 <= k; p += 4) {
+                    const double* u0 = U + p * ldu;
+                    const double* u1 = u0 + ldu;
+                    const double* u2 = u1 + ldu;
+                    const double* u3 = u2 + ldu;
+                    __m256d a0 = _mm256_set1_pd(l[p]), a1 = _mm256_set1_pd(l[p + 1]);
+                    __m256d a2 = _mm256_set1_pd(l[p + 2]), a3 = _mm256_set1_pd(l[p + 3]);
+                    std::size_t j = 0;
+                    for (; j + 4 <= n; j += 4) {
+                        __m256d v = _mm256_loadu_pd(c + j);
+                        v = _mm256_fnmadd_pd(a0, _mm256_loadu_pd(u0 + j), v);
+                        v = _mm256_fnmadd_pd(a1, _mm256_loadu_pd(u1 + j), v);
+                        v = _mm256_fnmadd_pd(a2, _mm256_loadu_pd(u2 + j), v);
+                        v = _mm256_fnmadd_pd(a3, _mm256_loadu_pd(u3 + j), v);
+                        _mm256_storeu_pd(c + j, v);
+                    }
+                    for (; j < n; ++j) {
+                        c[j] -= l[p] * u0[j];
+                        c[j] -= l[p + 1] * u1[j];
+                        c[j] -= l[p + 2] * u2[j];
+                        c[j] -= l[p + 3] * u3[j];
+                    }
+                }
+                for (; p < k; ++p) {
+                    axpyAVX2(n, -l[p], U + p * ldu, c);
+                }
+            }
+        }
+
+        NUMLIB_TARGET("avx2,fma")
+        void newtonHornerAVX2(std::size_t n, const double* nodes, const double* coeffs,
+                              std::size_t m, const double* x, double* y) {
+            std::size_t p = 0;
+            for (; p + 16 <= m; p += 16) {
+                __m256d x0 = _mm256_loadu_pd(x + p), x1 = _mm256_loadu_pd(x + p + 4);
+                __m256d x2 = _mm256_loadu_pd(x + p + 8), x3 = _mm256_loadu_pd(x + p + 12);
+                __m256d r0 = _mm256_set1_pd(coeffs[n - 1]), r1 = r0, r2 = r0, r3 = r0;
+                for (std::size_t i = n - 1; i-- > 0;) {
+                    __m256d xi = _mm256_set1_pd(nodes[i]), ci = _mm256_set1_pd(coeffs[i]);
+                    r0 = _mm256_fmadd_pd(r0, _mm256_sub_pd(x0, xi), ci);
+                    r1 = _mm256_fmadd_pd(r1, _mm256_sub_pd(x1, xi), ci);
+                    r2 = _mm256_fmadd_pd(r2, _mm256_sub_pd(x2, xi), ci);
+                    r3 = _mm256_fmadd_pd(r3, _mm256_sub_pd(x3, xi), ci);
+                }
+                _mm256_storeu_pd(y + p, r0);
+                _mm256_storeu_pd(y + p + 4, r1);
+                _mm256_storeu_pd(y + p + 8, r2);
+                _mm256_storeu_pd(y + p + 12, r3);
+            }
+            for (; p + 4 <= m; p += 4) {
+                __m256d x0 = _mm256_loadu_pd(x + p);
+                __m256d r0 = _mm256_set1_pd(coeffs[n - 1]);
+                for (std::size_t i = n - 1; i-- > 0;) {
+                    r0 = _mm256_fmadd_pd(r0, _mm256_sub_pd(x0, _mm256_set1_pd(nodes[i])), _mm256_set1_pd(coeffs[i]));
+                }
+                _mm256_storeu_pd(y + p, r0);
+            }
+            for (; p < m; ++p) y[p] = newtonPoint(n, nodes, coeffs, x[p]);
+        }
+
+        template <int K>
+        NUMLIB_TARGET("avx2,fma")
+        inline void barycentricBlockAVX2(std::size_t n, const double* nodes, const double* weights,
+                                         const double* values, const double* x, double* y) {
+            const __m256d zero = _mm256_setzero_pd(), one = _mm256_set1_pd(1.0);
+            __m256d xv[K], num[K], den[K], hv[K], hit[K];
+            for (int k = 0; k < K; ++k) {
+                xv[k] = _mm256_loadu_pd(x + 4 * k);
+                num[k] = den[k] = hv[k] = hit[k] = zero;
+            }
+            std::size_t j = 0;
+            for (; j + 2 <= n; j += 2) {
+                __m256d xa = _mm256_set1_pd(nodes[j]), xb = _mm256_set1_pd(nodes[j + 1]);
+                __m256d wa = _mm256_set1_pd(weights[j]), wb = _mm256_set1_pd(weights[j + 1]);
+                __m256d fa = _mm256_set1_pd(values[j]), fb = _mm256_set1_pd(values[j + 1]);
+                for (int k = 0; k < K; ++k) {
+                    __m256d da = _mm256_sub_pd(xv[k], xa), db = _mm256_sub_pd(xv[k], xb);
+                    __m256d ha = _mm256_cmp_pd(da, zero, _CMP_EQ_OQ), hb = _mm256_cmp_pd(db, zero, _CMP_EQ_OQ);
+                    hv[k] = _mm256_blendv_pd(_mm256_blendv_pd(hv[k], fa, ha), fb, hb);
+                    hit[k] = _mm256_or_pd(hit[k], _mm256_or_pd(ha, hb));
+                    da = _mm256_blendv_pd(da, one, ha);
+                    db = _mm256_blendv_pd(db, one, hb);
+                    __m256d r = _mm256_div_pd(one, _mm256_mul_pd(da, db));
+                    __m256d ta = _mm256_mul_pd(_mm256_mul_pd(wa, db), r), tb = _mm256_mul_pd(_mm256_mul_pd(wb, da), r);
+                    den[k] = _mm256_add_pd(den[k], _mm256_add_pd(ta, tb));
+                    num[k] = _mm256_fmadd_pd(tb, fb, _mm256_fmadd_pd(ta, fa, num[k]));
+                }
+            }
+            if (j < n) {
+                __m256d xa = _mm256_set1_pd(nodes[j]), wa = _mm256_set1_pd(weights[j]), fa = _mm256_set1_pd(values[j]);
+                for (int k = 0; k < K; ++k) {
+                    __m256d da = _mm256_sub_pd(xv[k], xa);
+                    __m256d ha = _mm256_cmp_pd(da, zero, _CMP_EQ_OQ);
+                    hv[k] = _mm256_blendv_pd(hv[k], fa, ha);
+                    hit[k] = _mm256_or_pd(hit[k], ha);
+                    __m256d t = _mm256_div_pd(wa, _mm256_blendv_pd(da, one, ha));
+                    den[k] = _mm256_add_pd(den[k], t);
+                    num[k] = _mm256_fmadd_pd(t, fa, num[k]);
+                }
+            }
+            for (int k = 0; k < K; ++k) {
+                _mm256_storeu_pd(y + 4 * k, _mm256_blendv_pd(_mm256_div_pd(num[k], den[k]), hv[k], hit[k]));
+            }
+        }
+
+        NUMLIB_TARGET("avx2,fma")
+        void barycentricAVX2(std::size_t n, const double* nodes, const double* weights, const double* values,
+                             std::size_t m, const double* x, double* y) {
+            std::size_t p = 0;
+            for (; p + 8 <= m; p += 8) barycentricBlockAVX2<2>(n, nodes, weights, values, x + p, y + p);
+            for (; p + 4 <= m; p += 4) barycentricBlockAVX2<1>(n, nodes, weights, values, x + p, y + p);
+            for (; p < m; ++p) y[p] = barycentricPoint(n, nodes, weights, values, x[p]);
+        }
+
+        NUMLIB_TARGET("avx2,fma")
+        void axpyAVX2F(std::size_t n, float a, const float* x, float* y) {
+            __m256 va = _mm256_set1_ps(a);
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __m256 y0 = _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i));
+                __m256 y1 = _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8));
+                _mm256_storeu_ps(y + i, y0);
+                _mm256_storeu_ps(y + i + 8, y1);
+            }
+            for (; i < n; ++i) y[i] += a * x[i];
+        }
+
+        NUMLIB_TARGET("avx2,fma")
+        void rankUpdateAVX2F(std::size_t m, std::size_t n, std::size_t k,
+                             const float* L, std::size_t ldl, const float* U, std::size_t ldu,
+                             float* C, std::size_t ldc) {
+            for (std::size_t i = 0; i < m; ++i) {
+                float* c = C + i * ldc;
+                const float* l = L + i * ldl;
+                std::size_t p = 0;
+                for (; p + 4 <= k; p += 4) {
+                    const float* u0 = U + p * ldu;
+                    const float* u1 = u0 + ldu;
+                    const float* u2 = u1 + ldu;
+                    const float* u3 = u2 + ldu;
+                    __m256 a0 = _mm256_set1_ps(l[p]), a1 = _mm256_set1_ps(l[p + 1]);
+                    __m256 a2 = _mm256_set1_ps(l[p + 2]), a3 = _mm256_set1_ps(l[p + 3]);
+                    std::size_t j = 0;
+                    for (; j + 8 <= n; j += 8) {
+                        __m256 v = _mm256_loadu_ps(c + j);
+                        v = _mm256_fnmadd_ps(a0, _mm256_loadu_ps(u0 + j), v);
+                        v = _mm256_fnmadd_ps(a1, _mm256_loadu_ps(u1 + j), v);
+                        v = _mm256_fnmadd_ps(a2, _mm256_loadu_ps(u2 + j), v);
+                        v = _mm256_fnmadd_ps(a3, _mm256_loadu_ps(u3 + j), v);
+                        _mm256_storeu_ps(c + j, v);
+                    }
+                    for (; j < n; ++j) {
+                        c[j] -= l[p] * u0[j];
+                        c[j] -= l[p + 1] * u1[j];
+                        c[j] -= l[p + 2] * u2[j];
+                        c[j] -= l[p + 3] * u3[j];
+                    }
+                }
+                for (; p < k; ++p) {
+                    axpyAVX2F(n, -l[p], U + p * ldu, c);
+                }
+            }
+        }
+
+        // ---------------------------------------------------------------
+        // AVX-512F (8 x double), końcówki obsługiwane maskami
+        // ---------------------------------------------------------------
+
+        NUMLIB_TARGET("avx512f")
+        void axpyAVX512(std::size_t n, double a, const double* x, double* y) {
+            __m512d va = _mm512_set1_pd(a);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_pd(y + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+            }
+            if (i < n) {
+                __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+                __m512d v = _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(mask, x + i),
+                                            _mm512_maskz_loadu_pd(mask, y + i));
+                _mm512_mask_storeu_pd(y + i, mask, v);
+            }
+        }
+
+        NUMLIB_TARGET("avx512f")
+        double dotAVX512(std::size_t n, const double* x, const double* y) {
+            __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), s0);
+                s1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8), s1);
+            }
+            for (; i + 8 <= n; i += 8) {
+                s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), s0);
+            }
+            if (i < n) {
+                __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+                s1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, x + i), _mm512_maskz_loadu_pd(mask, y + i), s1);
+            }
+            // Redukcja ręczna: w GCC 12 _mm512_reduce_add_pd, _mm512_extractf64x4_pd
+            // i _mm512_castpd512_pd256 korzystają z _mm256_undefined_pd i dają ostrzeżenie
+            // -Wuninitialized; wersja maskz tego nie robi
+            s0 = _mm512_add_pd(s0, s1);
+            __m256d q = _mm256_add_pd(_mm512_maskz_extractf64x4_pd(0xF, s0, 0), _mm512_maskz_extractf64x4_pd(0xF, s0, 1));
+            __m128d h = _mm_add_pd(_mm256_castpd256_pd128(q), _mm256_extractf128_pd(q, 1));
+            h = _mm_add_sd(h, _mm_unpackhi_pd(h, h));
+            return _mm_cvtsd_f64(h);
+        }
+
+        NUMLIB_TARGET("avx512f")
+        void rankUpdateAVX512(std::size_t m, std::size_t n, std::size_t k,
+                              const double* L, std::size_t ldl, const double* U, std::size_t ldu,
+                              double* C, std::size_t ldc) {
+            std::size_t tail = n % 8;
+            __mmask8 mask = static_cast<__mmask8>((1u << tail) - 1);
+            for (std::size_t i = 0; i < m; ++i) {
+                double* c = C + i * ldc;
+                const double* l = L + i * ldl;
+                std::size_t p = 0;
+                for (; p + 4 <= k; p += 4) {
+                    const double* u0 = U + p * ldu;
+                    const double* u1 = u0 + ldu;
+                    const double* u2 = u1 + ldu;
+                    const double* u3 = u2 + ldu;
+                    __m512d a0 = _mm512_set1_pd(l[p]), a1 = _mm512_set1_pd(l[p + 1]);
+                    __m512d a2 = _mm512_set1_pd(l[p + 2]), a3 = _mm512_set1_pd(l[p + 3]);
+                    std::size_t j = 0;
+                    for (; j + 8 <= n; j += 8) {
+                        __m512d v = _mm512_loadu_pd(c + j);
+                        v = _mm512_fnmadd_pd(a0, _mm512_loadu_pd(u0 + j), v);
+                        v = _mm512_fnmadd_pd(a1, _mm512_loadu_pd(u1 + j), v);
+                        v = _mm512_fnmadd_pd(a2, _mm512_loadu_pd(u2 + j), v);
+                        v = _mm512_fnmadd_pd(a3, _mm512_loadu_pd(u3 + j), v);
+                        _mm512_storeu_pd(c + j, v);
+                    }
+                    if (tail) {
+                        __m512d v = _mm512_maskz_loadu_pd(mask, c + j);
+                        v = _mm512_fnmadd_pd(a0, _mm512_maskz_loadu_pd(mask, u0 + j), v);
+                        v = _mm512_fnmadd_pd(a1, _mm512_maskz_loadu_pd(mask, u1 + j), v);
+                        v = _mm512_fnmadd_pd(a2, _mm512_maskz_loadu_pd(mask, u2 + j), v);
+                        v = _mm512_fnmadd_pd(a3, _mm512_maskz_loadu_pd(mask, u3 + j), v);
+                        _mm512_mask_storeu_pd(c + j, mask, v);
+                    }
+                }
+                for (; p < k; ++p) {
+                    axpyAVX512(n, -l[p], U + p * ldu, c);
+                }
+            }
+        }
+
+        NUMLIB_TARGET("avx512f")
+        void newtonHornerAVX512(std::size_t n, const double* nodes, const double* coeffs,
+                                std::size_t m, const double* x, double* y) {
+            std::size_t p = 0;
+            for (; p + 32 <= m; p += 32) {
+                __m512d x0 = _mm512_loadu_pd(x + p), x1 = _mm512_loadu_pd(x + p + 8);
+                __m512d x2 = _mm512_loadu_pd(x + p + 16), x3 = _mm512_loadu_pd(x + p + 24);
+                __m512d r0 = _mm512_set1_pd(coeffs[n - 1]), r1 = r0, r2 = r0, r3 = r0;
+                for (std::size_t i = n - 1; i-- > 0;) {
+                    __m512d xi = _mm512_set1_pd(nodes[i]), ci = _mm512_set1_pd(coeffs[i]);
+                    r0 = _mm512_fmadd_pd(r0, _mm512_sub_pd(x0, xi), ci);
+                    r1 = _mm512_fmadd_pd(r1, _mm512_sub_pd(x1, xi), ci);
+                    r2 = _mm512_fmadd_pd(r2, _mm512_sub_pd(x2, xi), ci);
+                    r3 = _mm512_fmadd_pd(r3, _mm512_sub_pd(x3, xi), ci);
+                }
+                _mm512_storeu_pd(y + p, r0);
+                _mm512_storeu_pd(y + p + 8, r1);
+                _mm512_storeu_pd(y + p + 16, r2);
+                _mm512_storeu_pd(y + p + 24, r3);
+            }
+            for (; p < m; p += 8) {
+                __mmask8 mask = m - p >= 8 ? static_cast<__mmask8>(0xFF)
+                                           : static_cast<__mmask8>((1u << (m - p)) - 1);
+                __m512d x0 = _mm512_maskz_loadu_pd(mask, x + p);
+                __m512d r0 = _mm512_set1_pd(coeffs[n - 1]);
+                for (std::size_t i = n - 1; i-- > 0;) {
+                    r0 = _mm512_fmadd_pd(r0, _mm512_sub_pd(x0, _mm512_set1_pd(nodes[i])), _mm512_set1_pd(coeffs[i]));
+                }
+                _mm512_mask_storeu_pd(y + p, mask, r0);
+            }
+        }
+
+        // Końcówka (mniej niż 8 punktów) obsługiwana maską ładowania i zapisu
+        template <int K>
+        NUMLIB_TARGET("avx512f")
+        inline void barycentricBlockAVX512(std::size_t n, const double* nodes, const double* weights,
+                                           const double* values, const double* x, double* y, __mmask8 mask) {
+            const __m512d zero = _mm512_setzero_pd(), one = _mm512_set1_pd(1.0);
+            __m512d xv[K], num[K], den[K], hv[K];
+            __mmask8 hit[K];
+            for (int k = 0; k < K; ++k) {
+                xv[k] = K == 1 ? _mm512_maskz_loadu_pd(mask, x) : _mm512_loadu_pd(x + 8 * k);
+                num[k] = den[k] = hv[k] = zero;
+                hit[k] = 0;
+            }
+            std::size_t j = 0;
+            for (; j + 2 <= n; j += 2) {
+                __m512d xa = _mm512_set1_pd(nodes[j]), xb = _mm512_set1_pd(nodes[j + 1]);
+                __m512d wa = _mm512_set1_pd(weights[j]), wb = _mm512_set1_pd(weights[j + 1]);
+                __m512d fa = _mm512_set1_pd(values[j]), fb = _mm512_set1_pd(values[j + 1]);
+                for (int k = 0; k < K; ++k) {
+                    __m512d da = _mm512_sub_pd(xv[k], xa), db = _mm512_sub_pd(xv[k], xb);
+                    __mmask8 ha = _mm512_cmp_pd_mask(da, zero, _CMP_EQ_OQ), hb = _mm512_cmp_pd_mask(db, zero, _CMP_EQ_OQ);
+                    hv[k] = _mm512_mask_blend_pd(hb, _mm512_mask_blend_pd(ha, hv[k], fa), fb);
+                    hit[k] |= ha | hb;
+                    da = _mm512_mask_blend_pd(ha, da, one);
+                    db = _mm512_mask_blend_pd(hb, db, one);
+                    __m512d r = _mm512_div_pd(one, _mm512_mul_pd(da, db));
+                    __m512d ta = _mm512_mul_pd(_mm512_mul_pd(wa, db), r), tb = _mm512_mul_pd(_mm512_mul_pd(wb, da), r);
+                    den[k] = _mm512_add_pd(den[k], _mm512_add_pd(ta, tb));
+                    num[k] = _mm512_fmadd_pd(tb, fb, _mm512_fmadd_pd(ta, fa, num[k]));
+                }
+            }
+            if (j < n) {
+                __m512d xa = _mm512_set1_pd(nodes[j]), wa = _mm512_set1_pd(weights[j]), fa = _mm512_set1_pd(values[j]);
+                for (int k = 0; k < K; ++k) {
+                    __m512d da = _mm512_sub_pd(xv[k], xa);
+                    __mmask8 ha = _mm512_cmp_pd_mask(da, zero, _CMP_EQ_OQ);
+                    hv[k] = _mm512_mask_blend_pd(ha, hv[k], fa);
+                    hit[k] |= ha;
+                    __m512d t = _mm512_div_pd(wa, _mm512_mask_blend_pd(ha, da, one));
+                    den[k] = _mm512_add_pd(den[k], t);
+                    num[k] = _mm512_fmadd_pd(t, fa, num[k]);
+                }
+            }
+            for (int k = 0; k < K; ++k) {
+                __m512d r = _mm512_mask_blend_pd(hit[k], _mm512_div_pd(num[k], den[k]), hv[k]);
+                if (K == 1) {
+                    _mm512_mask_storeu_pd(y, mask, r);
+                } else {
+                    _mm512_storeu_pd(y + 8 * k, r);
+                }
+            }
+        }
+
+        NUMLIB_TARGET("avx512f")
+        void barycentricAVX512(std::size_t n, const double* nodes, const double* weights, const double* values,
+                               std::size_t m, const double* x, double* y) {
+            std::size_t p = 0;
+            for (; p + 16 <= m; p += 16) barycentricBlockAVX512<2>(n, nodes, weights, values, x + p, y + p, 0xFF);
+            for (; p < m; p += 8) {
+                __mmask8 mask = m - p >= 8 ? static_cast<__mmask8>(0xFF)
+                                           : static_cast<__mmask8>((1u << (m - p)) - 1);
+                barycentricBlockAVX512<1>(n, nodes, weights, values, x + p, y + p, mask);
+            }
+        }
+
+        NUMLIB_TARGET("avx512f")
+        void axpyAVX512F(std::size_t n, float a, const float* x, float* y) {
+            __m512 va = _mm512_set1_ps(a);
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+            }
+            if (i < n) {
+                __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+                __m512 v = _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(mask, x + i),
+                                           _mm512_maskz_loadu_ps(mask, y + i));
+                _mm512_mask_storeu_ps(y + i, mask, v);
+            }
+        }
+
+        NUMLIB_TARGET("avx512f")
+        void rankUpdateAVX512F(std::size_t m, std::size_t n, std::size_t k,
+                               const float* L, std::size_t ldl, const float* U, std::size_t ldu,
+                               float* C, std::size_t ldc) {
+            std::size_t tail = n % 16;
+            __mmask16 mask = static_cast<__mmask16>((1u << tail) - 1);
+            for (std::size_t i = 0; i < m; ++i) {
+                float* c = C + i * ldc;
+                const float* l = L + i * ldl;
+                std::size_t p = 0;
+                for (; p + 4 <= k; p += 4) {
+                    const float* u0 = U + p * ldu;
+                    const float* u1 = u0 + ldu;
+                    const float* u2 = u1 + ldu;
+                    const float* u3 = u2 + ldu;
+                    __m512 a0 = _mm512_set1_ps(l[p]), a1 = _mm512_set1_ps(l[p + 1]);
+                    __m512 a2 = _mm512_set1_ps(l[p + 2]), a3 = _mm512_set1_ps(l[p + 3]);
+                    std::size_t j = 0;
+                    for (; j + 16 <= n; j += 16) {
+                        __m512 v = _mm512_loadu_ps(c + j);
+                        v = _mm512_fnmadd_ps(a0, _mm512_loadu_ps(u0 + j), v);
+                        v = _mm512_fnmadd_ps(a1, _mm512_loadu_ps(u1 + j), v);
+                        v = _mm512_fnmadd_ps(a2, _mm512_loadu_ps(u2 + j), v);
+                        v = _mm512_fnmadd_ps(a3, _mm512_loadu_ps(u3 + j), v);
+                        _mm512_storeu_ps(c + j, v);
+                    }
+                    if (tail) {
+                        __m512 v = _mm512_maskz_loadu_ps(mask, c + j);
+                        v = _mm512_fnmadd_ps(a0, _mm512_maskz_loadu_ps(mask, u0 + j), v);
+                        v = _mm512_fnmadd_ps(a1, _mm512_maskz_loadu_ps(mask, u1 + j), v);
+                        v = _mm512_fnmadd_ps(a2, _mm512_maskz_loadu_ps(mask, u2 + j), v);
+                        v = _mm512_fnmadd_ps(a3, _mm512_maskz_loadu_ps(mask, u3 + j), v);
+                        _mm512_mask_storeu_ps(c + j, mask, v);
+                    }
+                }
+                for (; p < k; ++p) {
+                    axpyAVX512F(n, -l[p], U + p * ldu, c);
+                }
+            }
+        }
+#endif
+
+        const KernelTable scalarTable = { axpyScalar, dotScalar, newtonHornerScalar, barycentricScalar, rankUpdateScalar, axpyScalarF, rankUpdateScalarF };
+#if NUMLIB_SIMD_X86
+        const KernelTable sse2Table = { axpySSE2, dotSSE2, newtonHornerSSE2, barycentricSSE2, rankUpdateSSE2, axpyScalarF, rankUpdateScalarF };
+        const KernelTable avx2Table = { axpyAVX2, dotAVX2, newtonHornerAVX2, barycentricAVX2, rankUpdateAVX2, axpyAVX2F, rankUpdateAVX2F };
+        const KernelTable avx512Table = { axpyAVX512, dotAVX512, newtonHornerAVX512, barycentricAVX512, rankUpdateAVX512, axpyAVX512F, rankUpdateAVX512F };
+#endif
+
+        const KernelTable* tableFor(SimdLevel level) {
+#if NUMLIB_SIMD_X86
+            switch (level) {
+                case SimdLevel::AVX512: return &avx512Table;
+                case SimdLevel::AVX2: return &avx2Table;
+                case SimdLevel::SSE2: return &sse2Table;
+                default: break;
+            }
+#else
+            (void)level;
+#endif
+            return &scalarTable;
+        }
+
+        SimdLevel detect() {
+#if NUMLIB_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+            if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+            return SimdLevel::Scalar;
+        }
+
+        struct Dispatch {
+            SimdLevel detected;
+            std::atomic<SimdLevel> level;
+            std::atomic<const KernelTable*> table;
+
+            Dispatch() : detected(detect()), level(detected), table(tableFor(detected)) {}
+        };
+
+        // Wykrywanie odbywa się raz, przy pierwszym wywołaniu dowolnego jądra
+        Dispatch& dispatch() {
+            static Dispatch instance;
+            return instance;
+        }
+
+        const KernelTable& kernels() {
+            return *dispatch().table.load(std::memory_order_relaxed);
+        }
+    }
+
+    void axpy(std::size_t n, double a, const double* x, double* y) {
+        kernels().axpy(n, a, x, y);
+    }
+
+    double dot(std::size_t n, const double* x, const double* y) {
+        return kernels().dot(n, x, y);
+    }
+
+    void newtonHorner(std::size_t n, const double* nodes, const double* coeffs,
+                      std::size_t m, const double* x, double* y) {
+        if (m == 0) return;
+        if (n == 0) {
+            for (std::size_t p = 0; p < m; ++p) y[p] = 0.0;
+            return;
+        }
+        kernels().newtonHorner(n, nodes, coeffs, m, x, y);
+    }
+
+    void barycentric(std::size_t n, const double* nodes, const double* weights, const double* values,
+                     std::size_t m, const double* x, double* y) {
+        if (m == 0) return;
+        kernels().barycentric(n, nodes, weights, values, m, x, y);
+    }
+
+    void rankUpdate(std::size_t m, std::size_t n, std::size_t k,
+                    const double* L, std::size_t ldl,
+                    const double* U, std::size_t ldu,
+                    double* C, std::size_t ldc) {
+        if (m == 0 || n == 0 || k == 0) return;
+        kernels().rankUpdate(m, n, k, L, ldl, U, ldu, C, ldc);
+    }
+
+    void axpy(std::size_t n, float a, const float* x, float* y) {
+        kernels().axpyF(n, a, x, y);
+    }
+
+    void rankUpdate(std::size_t m, std::size_t n, std::size_t k,
+                    const float* L, std::size_t ldl,
+                    const float* U, std::size_t ldu,
+                    float* C, std::size_t ldc) {
+        if (m == 0 || n == 0 || k == 0) return;
+        kernels().rankUpdateF(m, n, k, L, ldl, U, ldu, C, ldc);
+    }
+
+    SimdLevel detectedLevel() {
+        return dispatch().detected;
+    }
+
+    SimdLevel activeLevel() {
+        return dispatch().level.load();
+    }
+
+    bool setLevel(SimdLevel level) {
+        Dispatch& d = dispatch();
+        if (static_cast<int>(level) > static_cast<int>(d.detected)) {
+            return false;
+        }
+        d.level.store(level);
+        d.table.store(tableFor(level));
+        return true;
+    }
+
+    const char* levelName(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::AVX512: return "AVX-512";
+            case SimdLevel::AVX2: return "AVX2+FMA";
+            case SimdLevel::SSE2: return "SSE2";
+            default: return "skalarny";
+        }
+    }
+
+} // namespace simd
+} // namespace numlib
@@ -0,0 +1,248 @@
+#include "../include/numlib/LUPozaPamiecia.h"
+#include "../include/numlib/Watki.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        const double PIVOT_TOLERANCE = 1e-10;
+        const std::size_t PANEL_LEAF = 8;       // szerokość panelu rozkładanego kolumna po kolumnie
+        const std::size_t UPDATE_ROWS = 128;    // wiersze jednego zadania aktualizacji
+
+        // C(r0..r1-1, 0..nc-1) -= L(r0..r1-1, 0..k-1) * U, gdzie wiersz i macierzy L
+        // i C leży pod adresem L + i * ldl (C + i * ldc). Paski wierszy są
+        // niezależne i trafiają do puli wątków.
+        void subtractProduct(std::size_t r0, std::size_t r1, std::size_t k, std::size_t nc,
+                             const double* L, std::size_t ldl, const double* U, std::size_t ldu,
+                             double* C, std::size_t ldc) {
+            if (r1 <= r0 || k == 0 || nc == 0) return;
+            int count = static_cast<int>((r1 - r0 + UPDATE_ROWS - 1) / UPDATE_ROWS);
+            parallelFor(count, [&](int t) {
+                std::size_t i0 = r0 + t * UPDATE_ROWS;
+                std::size_t i1 = std::min(r1, i0 + UPDATE_ROWS);
+                simd::rankUpdate(i1 - i0, nc, k, L + i0 * ldl, ldl, U, ldu, C + i0 * ldc, ldc);
+            });
+        }
+
+        // Rozkład kolumn c0..c0+w-1 panelu kolumna po kolumnie. Zamiany obejmują
+        // całą szerokość panelu, więc trafiają też do kolumn jeszcze nierozłożonych.
+        void factorLeaf(MatrixView A, std::vector<int>& piv, std::size_t c0, std::size_t w) {
+            std::size_t m = A.rows();
+            for (std::size_t c = c0; c < c0 + w; c++) {
+                std::size_t p = c;
+                double best = std::abs(A(c, c));
+                for (std::size_t i = c + 1; i < m; i++) {
+                    if (std::abs(A(i, c)) > best) {
+                        best = std::abs(A(i, c));
+                        p = i;
+                    }
+                }
+                piv[c] = static_cast<int>(p);
+                if (p != c) {
+                    std::swap_ranges(A.row(c), A.row(c) + A.cols(), A.row(p));
+                }
+                if (best < PIVOT_TOLERANCE) {
+                    throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+                }
+
+                const double* pivot = A.row(c);
+                for (std::size_t i = c + 1; i < m; i++) {
+                    double* row = A.row(i);
+                    double factor = row[c] / pivot[c];
+                    row[c] = factor;
+                    simd::axpy(c0 + w - c - 1, -factor, pivot + c + 1, row + c + 1);
+                }
+            }
+        }
+
+        // Rekurencyjny rozkład wysokiego panelu (m x w): lewa połowa, U12 = L11^-1 A12,
+        // A22 -= L21 U12, prawa połowa. Większość pracy wykonuje rankUpdate zamiast
+        // wielu przebiegów kolumna po kolumnie przez cały panel.
+        void factorPanel(MatrixView A, std::vector<int>& piv, std::size_t c0, std::size_t w) {
+            if (w <= PANEL_LEAF) {
+                factorLeaf(A, piv, c0, w);
+                return;
+            }
+            std::size_t w1 = w / 2;
+            std::size_t c1 = c0 + w1;
+            factorPanel(A, piv, c0, w1);
+            for (std::size_t r = c0 + 1; r < c1; r++) {
+                simd::rankUpdate(1, w - w1, r - c0, A.row(r) + c0, A.stride(),
+                                 A.row(c0) + c1, A.stride(), A.row(r) + c1, A.stride());
+            }
+            subtractProduct(c1, A.rows(), w1, w - w1, A.data() + c0, A.stride(),
+                            A.row(c0) + c1, A.stride(), A.data() + c1, A.stride());
+            factorPanel(A, piv, c1, w - w1);
+        }
+
+        // Sprawdzane przed delegacją, żeby nie tworzyć pliku dla złych danych
+        std::size_t squareSize(ConstMatrixView A) {
+            if (A.rows() != A.cols()) {
+                throw std::invalid_argument("Macierz musi być kwadratowa");
+            }
+            return A.rows();
+        }
+    }
+
+    OutOfCoreLU::OutOfCoreLU(const std::string& path, std::size_t size, std::size_t tileSize)
+        : n(size), tile(tileSize) {
+        if (tileSize == 0) {
+            throw std::invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        tiles = (n + tile - 1) / tile;
+        storage = MappedFile(path, MappedFile::Mode::Create, tiles * tiles * tile * tile * sizeof(double));
+    }
+
+    OutOfCoreLU::OutOfCoreLU(const std::string& path, ConstMatrixView A, std::size_t tileSize)
+        : OutOfCoreLU(path, squareSize(A), tileSize) {
+        for (std::size_t i = 0; i < n; i++) {
+            setRow(i, Span<const double>(A.row(i), n));
+        }
+        factorize();
+    }
+
+    // Kolumna blokowa J to macierz (tiles * tile) x tile o wierszach długości tile
+    double* OutOfCoreLU::blockColumn(std::size_t J) const {
+        return static_cast<double*>(storage.data()) + J * tiles * tile * tile;
+    }
+
+    void OutOfCoreLU::prefetchColumn(std::size_t J, std::size_t firstRow) const {
+        if (J >= tiles) return;
+        std::size_t offset = (J * tiles * tile + firstRow) * tile * sizeof(double);
+        storage.prefetch(offset, (n - firstRow) * tile * sizeof(double));
+    }
+
+    MatrixView OutOfCoreLU::tileView(std::size_t I, std::size_t J) {
+        if (I >= tiles || J >= tiles) {
+            throw std::out_of_range("Indeks kafelka poza zakresem");
+        }
+        factored = false;
+        return MatrixView(blockColumn(J) + I * tile * tile,
+                          std::min(tile, n - I * tile), std::min(tile, n - J * tile), tile);
+    }
+
+    void OutOfCoreLU::setRow(std::size_t i, Span<const double> values) {
+        if (i >= n || values.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        for (std::size_t J = 0; J < tiles; J++) {
+            std::size_t j0 = J * tile;
+            std::size_t nb = std::min(tile, n - j0);
+            std::copy(values.data() + j0, values.data() + j0 + nb, blockColumn(J) + i * tile);
+        }
+        factored = false;
+    }
+
+    // Aktualizacja kolumny blokowej J kolumną L z bloku K < J: zamiany wierszy
+    // z kroku K, U(K, J) = L(K, K)^-1 A(K, J), A(K+1.., J) -= L(K+1.., K) U(K, J)
+    void OutOfCoreLU::updatePanel(std::size_t J, std::size_t K) {
+        double* P = blockColumn(J);
+        const double* L = blockColumn(K);
+        std::size_t nb = std::min(tile, n - J * tile);
+        std::size_t k0 = K * tile;
+
+        for (std::size_t c = k0; c < k0 + tile; c++) {
+            if (piv[c] != static_cast<int>(c)) {
+                std::swap_ranges(P + c * tile, P + c * tile + nb, P + piv[c] * tile);
+            }
+        }
+        for (std::size_t r = k0 + 1; r < k0 + tile; r++) {
+            simd::rankUpdate(1, nb, r - k0, L + r * tile, tile, P + k0 * tile, tile, P + r * tile, tile);
+        }
+        subtractProduct(k0 + tile, n, tile, nb, L, tile, P + k0 * tile, tile, P, tile);
+    }
+
+    void OutOfCoreLU::factorize() {
+        if (factored) return;
+        piv.assign(n, 0);
+        std::vector<int> local;
+        prefetchColumn(0, 0);
+        for (std::size_t J = 0; J < tiles; J++) {
+            for (std::size_t K = 0; K < J; K++) {
+                // Kolejna kolumna L (a po ostatniej - następny panel) wczytywana w tle
+                if (K + 1 < J) {
+                    prefetchColumn(K + 1, (K + 1) * tile);
+                } else {
+                    prefetchColumn(J + 1, 0);
+                }
+                updatePanel(J, K);
+            }
+            if (J == 0) prefetchColumn(1, 0);
+
+            std::size_t k0 = J * tile;
+            std::size_t nb = std::min(tile, n - k0);
+            MatrixView panel(blockColumn(J) + k0 * tile, n - k0, nb, tile);
+            local.assign(nb, 0);
+            factorPanel(panel, local, 0, nb);
+            for (std::size_t c = 0; c < nb; c++) {
+                piv[k0 + c] = static_cast<int>(k0) + local[c];
+            }
+        }
+        factored = true;
+    }
+
+    void OutOfCoreLU::solveInPlace(MatrixView B) const {
+        if (!factored) {
+            throw std::runtime_error("Macierz nie została rozłożona");
+        }
+        if (B.rows() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        std::size_t m = B.cols();
+        std::size_t ldb = B.stride();
+
+        // L Y = P B - kolumny blokowe czytane kolejno od lewej
+        for (std::size_t K = 0; K < tiles; K++) {
+            prefetchColumn(K + 1, (K + 1) * tile);
+            const double* L = blockColumn(K);
+            std::size_t k0 = K * tile;
+            std::size_t nb = std::min(tile, n - k0);
+            for (std::size_t c = k0; c < k0 + nb; c++) {
+                if (piv[c] != static_cast<int>(c)) {
+                    std::swap_ranges(B.row(c), B.row(c) + m, B.row(piv[c]));
+                }
+            }
+            for (std::size_t r = k0 + 1; r < k0 + nb; r++) {
+                simd::rankUpdate(1, m, r - k0, L + r * tile, tile, B.row(k0), ldb, B.row(r), ldb);
+            }
+            subtractProduct(k0 + nb, n, nb, m, L, tile, B.row(k0), ldb, B.data(), ldb);
+        }
+
+        // U X = Y - kolumny blokowe czytane od prawej, tylko część nad przekątną
+        for (std::size_t J = tiles; J-- > 0;) {
+            if (J > 0) prefetchColumn(J - 1, 0);
+            const double* U = blockColumn(J);
+            std::size_t k0 = J * tile;
+            std::size_t nb = std::min(tile, n - k0);
+            for (std::size_t r = k0 + nb; r-- > k0;) {
+                const double* u = U + r * tile - k0;
+                if (r + 1 < k0 + nb) {
+                    simd::rankUpdate(1, m, k0 + nb - r - 1, u + r + 1, tile, B.row(r + 1), ldb, B.row(r), ldb);
+                }
+                double* br = B.row(r);
+                for (std::size_t j = 0; j < m; j++) br[j] /= u[r];
+            }
+            subtractProduct(0, k0, nb, m, U, tile, B.row(k0), ldb, B.data(), ldb);
+        }
+    }
+
+    void OutOfCoreLU::solveInPlace(Span<double> b) const {
+        solveInPlace(MatrixView(b.data(), b.size(), 1, 1));
+    }
+
+    std::vector<double> OutOfCoreLU::solve(const std::vector<double>& b) const {
+        std::vector<double> x(b);
+        solveInPlace(Span<double>(x));
+        return x;
+    }
+
+    Matrix OutOfCoreLU::solve(ConstMatrixView B) const {
+        Matrix X = Matrix::copyOf(B);
+        solveInPlace(X.view());
+        return X;
+    }
+
+} // namespace numlib
@@ -0,0 +1,223 @@
+#include "../include/numlib/MacierzRzadka.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        // Sprawdza spójność tablic formatu skompresowanego (CSR lub CSC)
+        void validateCompressed(std::size_t outer, std::size_t inner, const std::vector<std::size_t>& ptr,
+                                const std::vector<int>& idx, const std::vector<double>& vals) {
+            if (ptr.size() != outer + 1 || ptr[0] != 0 || ptr[outer] != idx.size() || idx.size() != vals.size()) {
+                throw std::invalid_argument("Niespójne tablice macierzy rzadkiej");
+            }
+            for (std::size_t i = 0; i < outer; ++i) {
+                if (ptr[i] > ptr[i + 1]) {
+                    throw std::invalid_argument("Niespójne tablice macierzy rzadkiej");
+                }
+                for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                    if (idx[p] < 0 || static_cast<std::size_t>(idx[p]) >= inner ||
+                        (p > ptr[i] && idx[p] <= idx[p - 1])) {
+                        throw std::invalid_argument("Indeksy macierzy rzadkiej muszą być rosnące i w zakresie");
+                    }
+                }
+            }
+        }
+
+        // Transpozycja formatu skompresowanego (CSR -> CSC jest tym samym co CSR(A) -> CSR(A^T))
+        void transposeCompressed(std::size_t outer, std::size_t inner,
+                                 const std::vector<std::size_t>& ptr, const std::vector<int>& idx,
+                                 const std::vector<double>& vals,
+                                 std::vector<std::size_t>& tptr, std::vector<int>& tidx,
+                                 std::vector<double>& tvals) {
+            tptr.assign(inner + 1, 0);
+            for (int j : idx) tptr[j + 1]++;
+            for (std::size_t j = 0; j < inner; ++j) tptr[j + 1] += tptr[j];
+            tidx.resize(idx.size());
+            tvals.resize(vals.size());
+            std::vector<std::size_t> next(tptr.begin(), tptr.end() - 1);
+            for (std::size_t i = 0; i < outer; ++i) {
+                for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                    std::size_t q = next[idx[p]]++;
+                    tidx[q] = static_cast<int>(i);
+                    tvals[q] = vals[p];
+                }
+            }
+        }
+    }
+
+    SparseMatrix::SparseMatrix(std::size_t rows, std::size_t cols, std::vector<std::size_t> rowPointers,
+                               std::vector<int> columnIndices, std::vector<double> values)
+        : nrows(rows), ncols(cols), rowPtr(std::move(rowPointers)),
+          colIdx(std::move(columnIndices)), vals(std::move(values)) {
+        validateCompressed(nrows, ncols, rowPtr, colIdx, vals);
+    }
+
+    double SparseMatrix::at(std::size_t i, std::size_t j) const {
+        if (i >= nrows || j >= ncols) {
+            throw std::out_of_range("Indeks poza macierzą");
+        }
+        auto first = colIdx.begin() + rowPtr[i];
+        auto last = colIdx.begin() + rowPtr[i + 1];
+        auto it = std::lower_bound(first, last, static_cast<int>(j));
+        return (it != last && *it == static_cast<int>(j)) ? vals[it - colIdx.begin()] : 0.0;
+    }
+
+    std::vector<double> SparseMatrix::diagonal() const {
+        std::size_t n = std::min(nrows, ncols);
+        std::vector<double> d(n, 0.0);
+        for (std::size_t i = 0; i < n; ++i) d[i] = at(i, i);
+        return d;
+    }
+
+    SparseMatrix SparseMatrix::copyOf(SparseMatrixView src) {
+        return SparseMatrix(src.rows(), src.cols(),
+                            std::vector<std::size_t>(src.rowPointers().begin(), src.rowPointers().end()),
+                            std::vector<int>(src.columnIndices().begin(), src.columnIndices().end()),
+                            std::vector<double>(src.values().begin(), src.values().end()));
+    }
+
+    void SparseMatrixView::multiply(Span<const double> x, Span<double> y) const {
+        if (x.size() != ncols || y.size() != nrows) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        // Podział wierszy na zadania o zbliżonej liczbie niezerowych
+        const std::size_t NNZ_PER_TASK = 32768;
+        std::size_t total = nnz();
+        int tasks = static_cast<int>(std::max<std::size_t>(1, std::min(nrows, total / NNZ_PER_TASK)));
+        parallelFor(tasks, [&](int t) {
+            std::size_t lo = std::lower_bound(rowPtr.begin(), rowPtr.end() - 1, total * t / tasks) - rowPtr.begin();
+            std::size_t hi = std::lower_bound(rowPtr.begin(), rowPtr.end() - 1, total * (t + 1) / tasks) - rowPtr.begin();
+            if (t == tasks - 1) hi = nrows;
+            for (std::size_t i = lo; i < hi; ++i) {
+                double sum = 0.0;
+                for (std::size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p) {
+                    sum += vals[p] * x[colIdx[p]];
+                }
+                y[i] = sum;
+            }
+        });
+    }
+
+    std::vector<double> SparseMatrixView::multiply(const std::vector<double>& x) const {
+        std::vector<double> y(nrows);
+        multiply(Span<const double>(x), Span<double>(y));
+        return y;
+    }
+
+    void SparseMatrix::multiply(Span<const double> x, Span<double> y) const {
+        view().multiply(x, y);
+    }
+
+    std::vector<double> SparseMatrix::multiply(const std::vector<double>& x) const {
+        std::vector<double> y(nrows);
+        multiply(Span<const double>(x), Span<double>(y));
+        return y;
+    }
+
+    SparseMatrix SparseMatrix::transpose() const {
+        std::vector<std::size_t> tptr;
+        std::vector<int> tidx;
+        std::vector<double> tvals;
+        transposeCompressed(nrows, ncols, rowPtr, colIdx, vals, tptr, tidx, tvals);
+        SparseMatrix t;
+        t.nrows = ncols;
+        t.ncols = nrows;
+        t.rowPtr = std::move(tptr);
+        t.colIdx = std::move(tidx);
+        t.vals = std::move(tvals);
+        return t;
+    }
+
+    SparseMatrixCSC SparseMatrix::toCSC() const {
+        SparseMatrix t = transpose();
+        return SparseMatrixCSC(nrows, ncols, t.rowPtr, t.colIdx, t.vals);
+    }
+
+    SparseMatrixCSC::SparseMatrixCSC(std::size_t rows, std::size_t cols, std::vector<std::size_t> columnPointers,
+                                     std::vector<int> rowIndices, std::vector<double> values)
+        : nrows(rows), ncols(cols), colPtr(std::move(columnPointers)),
+          rowIdx(std::move(rowIndices)), vals(std::move(values)) {
+        validateCompressed(ncols, nrows, colPtr, rowIdx, vals);
+    }
+
+    std::vector<double> SparseMatrixCSC::multiply(const std::vector<double>& x) const {
+        if (x.size() != ncols) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        std::vector<double> y(nrows, 0.0);
+        for (std::size_t j = 0; j < ncols; ++j) {
+            double xj = x[j];
+            for (std::size_t p = colPtr[j]; p < colPtr[j + 1]; ++p) {
+                y[rowIdx[p]] += vals[p] * xj;
+            }
+        }
+        return y;
+    }
+
+    SparseMatrix SparseMatrixCSC::toCSR() const {
+        std::vector<std::size_t> ptr;
+        std::vector<int> idx;
+        std::vector<double> v;
+        transposeCompressed(ncols, nrows, colPtr, rowIdx, vals, ptr, idx, v);
+        return SparseMatrix(nrows, ncols, std::move(ptr), std::move(idx), std::move(v));
+    }
+
+    void CooBuilder::reserve(std::size_t count) {
+        rowIdx.reserve(count);
+        colIdx.reserve(count);
+        vals.reserve(count);
+    }
+
+    void CooBuilder::add(std::size_t i, std::size_t j, double value) {
+        if (i >= nrows || j >= ncols) {
+            throw std::out_of_range("Indeks poza macierzą");
+        }
+        rowIdx.push_back(static_cast<int>(i));
+        colIdx.push_back(static_cast<int>(j));
+        vals.push_back(value);
+    }
+
+    SparseMatrix CooBuilder::build() const {
+        std::size_t count = vals.size();
+
+        // Sortowanie kubełkowe po kolumnach, a następnie stabilnie po wierszach:
+        // w wyniku kolumny w każdym wierszu są uporządkowane
+        std::vector<std::size_t> byCol(count), byRow(count);
+        std::vector<std::size_t> start(ncols + 1, 0);
+        for (std::size_t p = 0; p < count; ++p) start[colIdx[p] + 1]++;
+        for (std::size_t j = 0; j < ncols; ++j) start[j + 1] += start[j];
+        for (std::size_t p = 0; p < count; ++p) byCol[start[colIdx[p]]++] = p;
+
+        std::vector<std::size_t> rstart(nrows + 1, 0);
+        for (std::size_t p = 0; p < count; ++p) rstart[rowIdx[p] + 1]++;
+        for (std::size_t i = 0; i < nrows; ++i) rstart[i + 1] += rstart[i];
+        std::vector<std::size_t> next(rstart.begin(), rstart.end() - 1);
+        for (std::size_t q = 0; q < count; ++q) {
+            std::size_t p = byCol[q];
+            byRow[next[rowIdx[p]]++] = p;
+        }
+
+        // Scalanie powtórzonych pozycji
+        std::vector<std::size_t> ptr(nrows + 1, 0);
+        std::vector<int> idx;
+        std::vector<double> v;
+        idx.reserve(count);
+        v.reserve(count);
+        for (std::size_t i = 0; i < nrows; ++i) {
+            for (std::size_t q = rstart[i]; q < rstart[i + 1]; ++q) {
+                std::size_t p = byRow[q];
+                if (idx.size() > ptr[i] && idx.back() == colIdx[p]) {
+                    v.back() += vals[p];
+                } else {
+                    idx.push_back(colIdx[p]);
+                    v.push_back(vals[p]);
+                }
+            }
+            ptr[i + 1] = idx.size();
+        }
+        return SparseMatrix(nrows, ncols, std::move(ptr), std::move(idx), std::move(v));
+    }
+
+} // namespace numlib
@@ -0,0 +1,407 @@
+#include "../include/numlib/MetodaWielosiatkowa.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        // Najgrubsza siatka do tego rozmiaru rozwiązywana jest rozkładem Cholesky'ego,
+        // większa (gdy siatki nie da się zgrubić) - metodą CG do względnego
+        // residuum COARSE_CG_TOLERANCE (opisane w MetodaWielosiatkowa.h)
+        const std::size_t COARSE_DIRECT_LIMIT = 2000;
+        const double COARSE_CG_TOLERANCE = 1e-12;
+        const std::size_t POINTS_PER_TASK = 4096;
+
+        struct Stencil {
+            double cx, cy, cz, diag;
+        };
+
+        Stencil stencil(const StructuredGrid& g) {
+            Stencil s{};
+            s.cx = g.kx / (g.hx * g.hx);
+            s.cy = g.dimensions >= 2 ? g.ky / (g.hy * g.hy) : 0.0;
+            s.cz = g.dimensions >= 3 ? g.kz / (g.hz * g.hz) : 0.0;
+            s.diag = 2.0 * (s.cx + s.cy + s.cz) + g.c;
+            return s;
+        }
+
+        bool coarsenable(const StructuredGrid& g) {
+            const std::size_t n[3] = { g.nx, g.ny, g.nz };
+            for (int d = 0; d < g.dimensions; ++d) {
+                if (n[d] < 3 || n[d] % 2 == 0) return false;
+            }
+            return true;
+        }
+
+        StructuredGrid coarsen(const StructuredGrid& g) {
+            StructuredGrid c = g;
+            c.nx = (g.nx - 1) / 2;
+            c.hx = 2.0 * g.hx;
+            if (g.dimensions >= 2) {
+                c.ny = (g.ny - 1) / 2;
+                c.hy = 2.0 * g.hy;
+            }
+            if (g.dimensions >= 3) {
+                c.nz = (g.nz - 1) / 2;
+                c.hz = 2.0 * g.hz;
+            }
+            return c;
+        }
+
+        // Wywołuje body(j, k) dla każdej linii siatki (stałe j, k), dzieląc linie na zadania puli wątków
+        template <typename F>
+        void forEachLine(const StructuredGrid& g, F body) {
+            std::size_t lines = g.ny * g.nz;
+            std::size_t perTask = std::max<std::size_t>(1, POINTS_PER_TASK / g.nx);
+            int tasks = static_cast<int>((lines + perTask - 1) / perTask);
+            parallelFor(tasks, [&](int t) {
+                std::size_t first = t * perTask, last = std::min(lines, first + perTask);
+                for (std::size_t line = first; line < last; ++line) body(line % g.ny, line / g.ny);
+            });
+        }
+
+        // Suma sąsiadów punktu i linii (j, k) z wagami schematu
+        struct Neighbors {
+            const double* u;
+            const double* down;
+            const double* up;
+            const double* back;
+            const double* front;
+            std::size_t nx;
+            Stencil s;
+
+            Neighbors(const StructuredGrid& g, const Stencil& st, const double* data, std::size_t j, std::size_t k)
+                : nx(g.nx), s(st) {
+                std::size_t plane = g.nx * g.ny;
+                u = data + g.nx * (j + g.ny * k);
+                down = j > 0 ? u - g.nx : nullptr;
+                up = j + 1 < g.ny ? u + g.nx : nullptr;
+                back = k > 0 ? u - plane : nullptr;
+                front = k + 1 < g.nz ? u + plane : nullptr;
+            }
+
+            double sum(std::size_t i) const {
+                double x = (i > 0 ? u[i - 1] : 0.0) + (i + 1 < nx ? u[i + 1] : 0.0);
+                double y = (down ? down[i] : 0.0) + (up ? up[i] : 0.0);
+                double z = (back ? back[i] : 0.0) + (front ? front[i] : 0.0);
+                return s.cx * x + s.cy * y + s.cz * z;
+            }
+        };
+
+        // r = b - A x
+        void residual(const StructuredGrid& g, const std::vector<double>& x, const std::vector<double>& b,
+                      std::vector<double>& r) {
+            Stencil s = stencil(g);
+            forEachLine(g, [&](std::size_t j, std::size_t k) {
+                Neighbors nb(g, s, x.data(), j, k);
+                std::size_t base = g.nx * (j + g.ny * k);
+                for (std::size_t i = 0; i < g.nx; ++i) {
+                    r[base + i] = b[base + i] - (s.diag * nb.u[i] - nb.sum(i));
+                }
+            });
+        }
+
+        // Półkrok Gaussa-Seidla dla punktów z (i + j + k) % 2 == color; punkty
+        // jednego koloru nie sąsiadują ze sobą, więc linie są niezależne
+        void relaxColor(const StructuredGrid& g, std::vector<double>& x, const std::vector<double>& b, int color) {
+            Stencil s = stencil(g);
+            double inverse = 1.0 / s.diag;
+            forEachLine(g, [&](std::size_t j, std::size_t k) {
+                Neighbors nb(g, s, x.data(), j, k);
+                std::size_t base = g.nx * (j + g.ny * k);
+                double* u = x.data() + base;
+                for (std::size_t i = (j + k + color) % 2; i < g.nx; i += 2) {
+                    u[i] = (b[base + i] + nb.sum(i)) * inverse;
+                }
+            });
+        }
+
+        // Wagi pełnego ważenia: punkt grubszy I odpowiada drobnemu 2I + 1
+        struct Taps {
+            std::size_t index[3];
+            double weight[3];
+            int count;
+        };
+
+        Taps restrictionTaps(bool active, std::size_t I) {
+            if (!active) return { { I, 0, 0 }, { 1.0, 0.0, 0.0 }, 1 };
+            return { { 2 * I, 2 * I + 1, 2 * I + 2 }, { 0.25, 0.5, 0.25 }, 3 };
+        }
+
+        // Interpolacja liniowa: drobny punkt i leży na grubszym (i nieparzyste)
+        // albo w połowie między dwoma grubszymi (brzeg ma wartość 0)
+        Taps prolongationTaps(bool active, std::size_t i, std::size_t coarseCount) {
+            if (!active) return { { i, 0, 0 }, { 1.0, 0.0, 0.0 }, 1 };
+            if (i % 2 == 1) return { { i / 2, 0, 0 }, { 1.0, 0.0, 0.0 }, 1 };
+            Taps t{ { 0, 0, 0 }, { 0.0, 0.0, 0.0 }, 0 };
+            std::size_t right = i / 2;
+            if (right > 0) {
+                t.index[t.count] = right - 1;
+                t.weight[t.count++] = 0.5;
+            }
+            if (right < coarseCount) {
+                t.index[t.count] = right;
+                t.weight[t.count++] = 0.5;
+            }
+            return t;
+        }
+
+        void restrictResidual(const StructuredGrid& fine, const std::vector<double>& r,
+                              const StructuredGrid& coarse, std::vector<double>& b) {
+            forEachLine(coarse, [&](std::size_t J, std::size_t K) {
+                Taps ty = restrictionTaps(coarse.dimensions >= 2, J);
+                Taps tz = restrictionTaps(coarse.dimensions >= 3, K);
+                double* out = b.data() + coarse.nx * (J + coarse.ny * K);
+                for (std::size_t I = 0; I < coarse.nx; ++I) {
+                    std::size_t i = 2 * I + 1;
+                    double sum = 0.0;
+                    for (int c = 0; c < tz.count; ++c) {
+                        for (int a = 0; a < ty.count; ++a) {
+                            const double* line = r.data() + fine.nx * (ty.index[a] + fine.ny * tz.index[c]);
+                            double w = ty.weight[a] * tz.weight[c];
+                            sum += w * (0.25 * line[i - 1] + 0.5 * line[i] + 0.25 * line[i + 1]);
+                        }
+                    }
+                    out[I] = sum;
+                }
+            });
+        }
+
+        void prolongateCorrection(const StructuredGrid& coarse, const std::vector<double>& e,
+                                  const StructuredGrid& fine, std::vector<double>& x) {
+            forEachLine(fine, [&](std::size_t j, std::size_t k) {
+                Taps ty = prolongationTaps(fine.dimensions >= 2, j, coarse.ny);
+                Taps tz = prolongationTaps(fine.dimensions >= 3, k, coarse.nz);
+                double* out = x.data() + fine.nx * (j + fine.ny * k);
+                for (int c = 0; c < tz.count; ++c) {
+                    for (int a = 0; a < ty.count; ++a) {
+                        const double* line = e.data() + coarse.nx * (ty.index[a] + coarse.ny * tz.index[c]);
+                        double w = ty.weight[a] * tz.weight[c];
+                        for (std::size_t i = 0; i < fine.nx; ++i) {
+                            Taps tx = prolongationTaps(true, i, coarse.nx);
+                            double v = 0.0;
+                            for (int p = 0; p < tx.count; ++p) v += tx.weight[p] * line[tx.index[p]];
+                            out[i] += w * v;
+                        }
+                    }
+                }
+            });
+        }
+
+        // Wywołuje add(wiersz, kolumna, wartość) dla wszystkich niezerowych elementów operatora
+        template <typename F>
+        void forEachEntry(const StructuredGrid& g, F add) {
+            Stencil s = stencil(g);
+            std::size_t plane = g.nx * g.ny;
+            for (std::size_t k = 0; k < g.nz; ++k) {
+                for (std::size_t j = 0; j < g.ny; ++j) {
+                    for (std::size_t i = 0; i < g.nx; ++i) {
+                        std::size_t p = i + g.nx * (j + g.ny * k);
+                        if (k > 0) add(p, p - plane, -s.cz);
+                        if (j > 0) add(p, p - g.nx, -s.cy);
+                        if (i > 0) add(p, p - 1, -s.cx);
+                        add(p, p, s.diag);
+                        if (i + 1 < g.nx) add(p, p + 1, -s.cx);
+                        if (j + 1 < g.ny) add(p, p + g.nx, -s.cy);
+                        if (k + 1 < g.nz) add(p, p + plane, -s.cz);
+                    }
+                }
+            }
+        }
+
+        double norm(const std::vector<double>& v) {
+            return std::sqrt(simd::dot(v.size(), v.data(), v.data()));
+        }
+    }
+
+    StructuredGrid StructuredGrid::unitCube(int dimensions, std::size_t n) {
+        StructuredGrid g;
+        g.dimensions = dimensions;
+        double h = 1.0 / (n + 1);
+        g.nx = n;
+        g.hx = g.hy = g.hz = h;
+        if (dimensions >= 2) g.ny = n;
+        if (dimensions >= 3) g.nz = n;
+        return g;
+    }
+
+    Multigrid::Multigrid(const StructuredGrid& grid, const MultigridOptions& opts) : options(opts) {
+        if (grid.dimensions < 1 || grid.dimensions > 3 || grid.size() == 0 ||
+            (grid.dimensions < 2 && grid.ny != 1) || (grid.dimensions < 3 && grid.nz != 1)) {
+            throw std::invalid_argument("Nieprawidłowe wymiary siatki");
+        }
+        if (!(grid.hx > 0.0 && grid.hy > 0.0 && grid.hz > 0.0 && grid.kx > 0.0 && grid.ky > 0.0 &&
+              grid.kz > 0.0 && grid.c >= 0.0)) {
+            throw std::invalid_argument("Nieprawidłowe parametry siatki");
+        }
+        if (options.preSmoothing < 0 || options.postSmoothing < 0) {
+            throw std::invalid_argument("Liczba kroków wygładzania nie może być ujemna");
+        }
+        if (options.jacobiWeight <= 0.0) {
+            options.jacobiWeight = 2.0 * grid.dimensions / (2.0 * grid.dimensions + 1.0);
+        }
+
+        StructuredGrid g = grid;
+        while (true) {
+            Level level;
+            level.grid = g;
+            level.x.assign(g.size(), 0.0);
+            level.b.assign(g.size(), 0.0);
+            level.r.assign(g.size(), 0.0);
+            levels.push_back(std::move(level));
+            if (!coarsenable(g)) break;
+            g = coarsen(g);
+        }
+
+        const StructuredGrid& last = levels.back().grid;
+        if (last.size() <= COARSE_DIRECT_LIMIT) {
+            Matrix A(last.size(), last.size());
+            forEachEntry(last, [&](std::size_t i, std::size_t j, double v) { A(i, j) = v; });
+            coarse = std::make_unique<Cholesky>(A);
+        }
+    }
+
+    Multigrid::~Multigrid() = default;
+
+    void Multigrid::multiply(const std::vector<double>& x, std::vector<double>& y) const {
+        const StructuredGrid& g = levels.front().grid;
+        if (x.size() != g.size()) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        Stencil s = stencil(g);
+        y.resize(g.size());
+        forEachLine(g, [&](std::size_t j, std::size_t k) {
+            Neighbors nb(g, s, x.data(), j, k);
+            double* out = y.data() + g.nx * (j + g.ny * k);
+            for (std::size_t i = 0; i < g.nx; ++i) out[i] = s.diag * nb.u[i] - nb.sum(i);
+        });
+    }
+
+    SparseMatrix Multigrid::matrix() const {
+        const StructuredGrid& g = levels.front().grid;
+        CooBuilder coo(g.size(), g.size());
+        coo.reserve(g.size() * (2 * g.dimensions + 1));
+        forEachEntry(g, [&](std::size_t i, std::size_t j, double v) { coo.add(i, j, v); });
+        return coo.build();
+    }
+
+    void Multigrid::smooth(std::size_t index, int sweeps, bool reverse) const {
+        Level& level = levels[index];
+        for (int s = 0; s < sweeps; ++s) {
+            if (options.smoother == Smoother::RedBlackGaussSeidel) {
+                relaxColor(level.grid, level.x, level.b, reverse ? 1 : 0);
+                relaxColor(level.grid, level.x, level.b, reverse ? 0 : 1);
+            } else {
+                residual(level.grid, level.x, level.b, level.r);
+                double scale = options.jacobiWeight / stencil(level.grid).diag;
+                simd::axpy(level.x.size(), scale, level.r.data(), level.x.data());
+            }
+        }
+    }
+
+    void Multigrid::solveCoarsest() const {
+        Level& level = levels.back();
+        if (coarse) {
+            level.x = level.b;
+            coarse->solveInPlace(Span<double>(level.x));
+            return;
+        }
+        const StructuredGrid& g = level.grid;
+        LinearOperator A = [&g](const std::vector<double>& x, std::vector<double>& y) {
+            std::vector<double> zero(x.size(), 0.0);
+            residual(g, x, zero, y);
+            for (double& v : y) v = -v;
+        };
+        level.x = CG(A, level.b, nullptr, COARSE_CG_TOLERANCE, static_cast<int>(10 * g.size())).x;
+    }
+
+    void Multigrid::cycle(std::size_t index, CycleType type, bool symmetric) const {
+        if (index + 1 == levels.size()) {
+            solveCoarsest();
+            return;
+        }
+        Level& fine = levels[index];
+        Level& next = levels[index + 1];
+        smooth(index, options.preSmoothing, false);
+        residual(fine.grid, fine.x, fine.b, fine.r);
+        restrictResidual(fine.grid, fine.r, next.grid, next.b);
+        std::fill(next.x.begin(), next.x.end(), 0.0);
+        switch (type) {
+            case CycleType::V:
+                cycle(index + 1, CycleType::V, symmetric);
+                break;
+            case CycleType::W:
+                cycle(index + 1, CycleType::W, symmetric);
+                cycle(index + 1, CycleType::W, symmetric);
+                break;
+            case CycleType::F:
+                cycle(index + 1, CycleType::F, symmetric);
+                cycle(index + 1, CycleType::V, symmetric);
+                break;
+        }
+        prolongateCorrection(next.grid, next.x, fine.grid, fine.x);
+        smooth(index, options.postSmoothing, symmetric);
+    }
+
+    void Multigrid::run(const std::vector<double>& b, std::vector<double>& x, bool symmetric) const {
+        Level& top = levels.front();
+        if (b.size() != top.grid.size() || x.size() != top.grid.size()) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        top.b = b;
+        top.x = x;
+        cycle(0, options.cycle, symmetric);
+        x = top.x;
+    }
+
+    void Multigrid::iterate(const std::vector<double>& b, std::vector<double>& x) const {
+        run(b, x, false);
+    }
+
+    void Multigrid::apply(const std::vector<double>& r, std::vector<double>& z) const {
+        z.assign(r.size(), 0.0);
+        run(r, z, true);
+    }
+
+    KrylovResult Multigrid::solve(const std::vector<double>& b, const std::vector<double>& x0) const {
+        std::size_t n = size();
+        if (b.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        if (!x0.empty() && x0.size() != n) {
+            throw std::invalid_argument("Nieprawidłowy rozmiar przybliżenia początkowego");
+        }
+        KrylovResult result;
+        result.x = x0.empty() ? std::vector<double>(n, 0.0) : x0;
+        result.iterations = 0;
+        result.converged = false;
+
+        double bnorm = norm(b);
+        if (bnorm == 0.0) {
+            std::fill(result.x.begin(), result.x.end(), 0.0);
+            result.residual = 0.0;
+            result.converged = true;
+            result.residuals.push_back(0.0);
+            return result;
+        }
+        std::vector<double> r(n);
+        residual(levels.front().grid, result.x, b, r);
+        result.residual = norm(r) / bnorm;
+        result.residuals.push_back(result.residual);
+        result.converged = result.residual < options.tolerance;
+        while (!result.converged && result.iterations < options.maxCycles) {
+            iterate(b, result.x);
+            residual(levels.front().grid, result.x, b, r);
+            result.iterations++;
+            result.residual = norm(r) / bnorm;
+            result.residuals.push_back(result.residual);
+            result.converged = result.residual < options.tolerance;
+        }
+        return result;
+    }
+
+} // namespace numlib
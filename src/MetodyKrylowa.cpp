@@ -0,0 +1,344 @@
+#include "../include/numlib/MetodyKrylowa.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        double dot(const std::vector<double>& a, const std::vector<double>& b) {
+            return simd::dot(a.size(), a.data(), b.data());
+        }
+
+        double norm(const std::vector<double>& a) {
+            return std::sqrt(dot(a, a));
+        }
+
+        // y += alpha * x
+        void axpy(double alpha, const std::vector<double>& x, std::vector<double>& y) {
+            simd::axpy(x.size(), alpha, x.data(), y.data());
+        }
+
+        LinearOperator wrap(const SparseMatrix& A) {
+            if (A.rows() != A.cols()) {
+                throw std::invalid_argument("Macierz musi być kwadratowa");
+            }
+            return [&A](const std::vector<double>& x, std::vector<double>& y) {
+                A.multiply(Span<const double>(x), Span<double>(y));
+            };
+        }
+
+        void applyPreconditioner(const Preconditioner* M, const std::vector<double>& r, std::vector<double>& z) {
+            if (M) {
+                M->apply(r, z);
+            } else {
+                z = r;
+            }
+        }
+
+        // Przygotowuje x, r = b - A x oraz ||b||; zwraca false, gdy b = 0
+        bool initialize(const LinearOperator& A, const std::vector<double>& b, const std::vector<double>& x0,
+                        KrylovResult& result, std::vector<double>& r, double& bnorm) {
+            std::size_t n = b.size();
+            if (!x0.empty() && x0.size() != n) {
+                throw std::invalid_argument("Nieprawidłowy rozmiar przybliżenia początkowego");
+            }
+            result.x = x0.empty() ? std::vector<double>(n, 0.0) : x0;
+            result.iterations = 0;
+            result.converged = false;
+            result.residuals.clear();
+
+            bnorm = norm(b);
+            if (bnorm == 0.0) {
+                std::fill(result.x.begin(), result.x.end(), 0.0);
+                result.residual = 0.0;
+                result.converged = true;
+                result.residuals.push_back(0.0);
+                return false;
+            }
+            r.assign(n, 0.0);
+            A(result.x, r);
+            for (std::size_t i = 0; i < n; ++i) r[i] = b[i] - r[i];
+            result.residual = norm(r) / bnorm;
+            result.residuals.push_back(result.residual);
+            return true;
+        }
+
+        // Zapisuje residuum po kolejnej iteracji; zwraca true przy zbieżności
+        bool record(KrylovResult& result, double relative, double tolerance) {
+            result.iterations++;
+            result.residual = relative;
+            result.residuals.push_back(relative);
+            result.converged = relative < tolerance;
+            return result.converged;
+        }
+    }
+
+    JacobiPreconditioner::JacobiPreconditioner(const SparseMatrix& A) : invDiag(A.diagonal()) {
+        for (double& d : invDiag) {
+            if (d == 0.0) {
+                throw std::runtime_error("Zero na przekątnej - preconditioner Jacobiego niemożliwy");
+            }
+            d = 1.0 / d;
+        }
+    }
+
+    void JacobiPreconditioner::apply(const std::vector<double>& r, std::vector<double>& z) const {
+        z.resize(r.size());
+        for (std::size_t i = 0; i < r.size(); ++i) z[i] = invDiag[i] * r[i];
+    }
+
+    ILU0Preconditioner::ILU0Preconditioner(const SparseMatrix& A) : lu(A) {
+        std::size_t n = A.rows();
+        if (A.cols() != n) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        const auto& ptr = lu.rowPointers();
+        const auto& col = lu.columnIndices();
+        auto& a = lu.values();
+
+        diagPos.assign(n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            bool found = false;
+            for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                if (col[p] == static_cast<int>(i)) {
+                    diagPos[i] = p;
+                    found = true;
+                }
+            }
+            if (!found) {
+                throw std::runtime_error("Brak elementu przekątnej we wzorcu - ILU(0) niemożliwe");
+            }
+        }
+
+        // Wariant IKJ: wiersz i jest eliminowany poprzednimi wierszami, ale
+        // modyfikowane są tylko pozycje istniejące we wzorcu A
+        std::vector<long long> pos(n, -1);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) pos[col[p]] = static_cast<long long>(p);
+
+            for (std::size_t p = ptr[i]; p < diagPos[i]; ++p) {
+                std::size_t k = col[p];
+                a[p] /= a[diagPos[k]];
+                for (std::size_t q = diagPos[k] + 1; q < ptr[k + 1]; ++q) {
+                    long long target = pos[col[q]];
+                    if (target >= 0) a[target] -= a[p] * a[q];
+                }
+            }
+            if (a[diagPos[i]] == 0.0) {
+                throw std::runtime_error("Zerowy element główny w ILU(0)");
+            }
+
+            for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) pos[col[p]] = -1;
+        }
+    }
+
+    void ILU0Preconditioner::apply(const std::vector<double>& r, std::vector<double>& z) const {
+        std::size_t n = diagPos.size();
+        const auto& ptr = lu.rowPointers();
+        const auto& col = lu.columnIndices();
+        const auto& a = lu.values();
+        z.resize(n);
+
+        // L y = r (jedynki na przekątnej L)
+        for (std::size_t i = 0; i < n; ++i) {
+            double sum = r[i];
+            for (std::size_t p = ptr[i]; p < diagPos[i]; ++p) sum -= a[p] * z[col[p]];
+            z[i] = sum;
+        }
+        // U z = y
+        for (std::size_t i = n; i-- > 0;) {
+            double sum = z[i];
+            for (std::size_t p = diagPos[i] + 1; p < ptr[i + 1]; ++p) sum -= a[p] * z[col[p]];
+            z[i] = sum / a[diagPos[i]];
+        }
+    }
+
+    KrylovResult CG(const LinearOperator& A, const std::vector<double>& b, const Preconditioner* M,
+                    double tolerance, int maxIterations, const std::vector<double>& x0) {
+        KrylovResult result;
+        std::vector<double> r;
+        double bnorm;
+        if (!initialize(A, b, x0, result, r, bnorm)) return result;
+        if (result.residual < tolerance) {
+            result.converged = true;
+            return result;
+        }
+
+        std::size_t n = b.size();
+        std::vector<double> z(n), p, Ap(n);
+        applyPreconditioner(M, r, z);
+        p = z;
+        double rz = dot(r, z);
+
+        for (int it = 0; it < maxIterations; ++it) {
+            A(p, Ap);
+            double pAp = dot(p, Ap);
+            if (!(pAp > 0.0)) break;  // macierz (lub preconditioner) nie jest dodatnio określona
+            double alpha = rz / pAp;
+            axpy(alpha, p, result.x);
+            axpy(-alpha, Ap, r);
+
+            if (record(result, norm(r) / bnorm, tolerance)) break;
+
+            applyPreconditioner(M, r, z);
+            double rzNew = dot(r, z);
+            double beta = rzNew / rz;
+            rz = rzNew;
+            for (std::size_t i = 0; i < n; ++i) p[i] = z[i] + beta * p[i];
+        }
+        return result;
+    }
+
+    KrylovResult CG(const SparseMatrix& A, const std::vector<double>& b, const Preconditioner* M,
+                    double tolerance, int maxIterations, const std::vector<double>& x0) {
+        return CG(wrap(A), b, M, tolerance, maxIterations, x0);
+    }
+
+    KrylovResult BiCGSTAB(const LinearOperator& A, const std::vector<double>& b, const Preconditioner* M,
+                          double tolerance, int maxIterations, const std::vector<double>& x0) {
+        KrylovResult result;
+        std::vector<double> r;
+        double bnorm;
+        if (!initialize(A, b, x0, result, r, bnorm)) return result;
+        if (result.residual < tolerance) {
+            result.converged = true;
+            return result;
+        }
+
+        std::size_t n = b.size();
+        std::vector<double> rhat(r), p(n, 0.0), v(n, 0.0), phat(n), s(n), shat(n), t(n);
+        double rho = 1.0, alpha = 1.0, omega = 1.0;
+
+        for (int it = 0; it < maxIterations; ++it) {
+            double rhoNew = dot(rhat, r);
+            if (rhoNew == 0.0 || omega == 0.0) break;  // załamanie metody
+            double beta = (rhoNew / rho) * (alpha / omega);
+            rho = rhoNew;
+            for (std::size_t i = 0; i < n; ++i) p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+            applyPreconditioner(M, p, phat);
+            A(phat, v);
+            double rv = dot(rhat, v);
+            if (rv == 0.0) break;
+            alpha = rho / rv;
+
+            for (std::size_t i = 0; i < n; ++i) s[i] = r[i] - alpha * v[i];
+            double snorm = norm(s) / bnorm;
+            if (snorm < tolerance) {
+                axpy(alpha, phat, result.x);
+                r = s;
+                record(result, snorm, tolerance);
+                break;
+            }
+
+            applyPreconditioner(M, s, shat);
+            A(shat, t);
+            double tt = dot(t, t);
+            omega = tt > 0.0 ? dot(t, s) / tt : 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                result.x[i] += alpha * phat[i] + omega * shat[i];
+                r[i] = s[i] - omega * t[i];
+            }
+            if (record(result, norm(r) / bnorm, tolerance)) break;
+        }
+        return result;
+    }
+
+    KrylovResult BiCGSTAB(const SparseMatrix& A, const std::vector<double>& b, const Preconditioner* M,
+                          double tolerance, int maxIterations, const std::vector<double>& x0) {
+        return BiCGSTAB(wrap(A), b, M, tolerance, maxIterations, x0);
+    }
+
+    KrylovResult GMRES(const LinearOperator& A, const std::vector<double>& b, int restart,
+                       const Preconditioner* M, double tolerance, int maxIterations,
+                       const std::vector<double>& x0) {
+        if (restart <= 0) {
+            throw std::invalid_argument("Parametr restartu musi być dodatni");
+        }
+        KrylovResult result;
+        std::vector<double> r;
+        double bnorm;
+        if (!initialize(A, b, x0, result, r, bnorm)) return result;
+        if (result.residual < tolerance) {
+            result.converged = true;
+            return result;
+        }
+
+        std::size_t n = b.size();
+        int m = restart;
+        std::vector<std::vector<double>> V(m + 1, std::vector<double>(n));
+        std::vector<std::vector<double>> Z(m, std::vector<double>(n));
+        std::vector<std::vector<double>> H(m + 1, std::vector<double>(m, 0.0));
+        std::vector<double> cs(m), sn(m), g(m + 1), w(n);
+        bool firstCycle = true;
+
+        while (result.iterations < maxIterations && !result.converged) {
+            if (!firstCycle) {
+                A(result.x, r);
+                for (std::size_t i = 0; i < n; ++i) r[i] = b[i] - r[i];
+            }
+            firstCycle = false;
+            double beta = norm(r);
+            if (beta == 0.0) {
+                result.converged = true;
+                break;
+            }
+            for (std::size_t i = 0; i < n; ++i) V[0][i] = r[i] / beta;
+            std::fill(g.begin(), g.end(), 0.0);
+            g[0] = beta;
+
+            int k = 0;
+            while (k < m && result.iterations < maxIterations) {
+                applyPreconditioner(M, V[k], Z[k]);
+                A(Z[k], w);
+                // Zmodyfikowana ortogonalizacja Grama-Schmidta
+                for (int i = 0; i <= k; ++i) {
+                    H[i][k] = dot(w, V[i]);
+                    axpy(-H[i][k], V[i], w);
+                }
+                H[k + 1][k] = norm(w);
+                // Zerowa norma oznacza, że podprzestrzeń Kryłowa zawiera dokładne rozwiązanie
+                bool happyBreakdown = H[k + 1][k] == 0.0;
+                if (!happyBreakdown) {
+                    for (std::size_t i = 0; i < n; ++i) V[k + 1][i] = w[i] / H[k + 1][k];
+                }
+
+                // Obroty Givensa sprowadzają H do postaci trójkątnej
+                for (int i = 0; i < k; ++i) {
+                    double tmp = cs[i] * H[i][k] + sn[i] * H[i + 1][k];
+                    H[i + 1][k] = -sn[i] * H[i][k] + cs[i] * H[i + 1][k];
+                    H[i][k] = tmp;
+                }
+                double denom = std::hypot(H[k][k], H[k + 1][k]);
+                cs[k] = denom > 0.0 ? H[k][k] / denom : 1.0;
+                sn[k] = denom > 0.0 ? H[k + 1][k] / denom : 0.0;
+                H[k][k] = denom;
+                H[k + 1][k] = 0.0;
+                g[k + 1] = -sn[k] * g[k];
+                g[k] = cs[k] * g[k];
+
+                ++k;
+                if (record(result, std::abs(g[k]) / bnorm, tolerance) || happyBreakdown) break;
+            }
+
+            // Rozwiązanie układu trójkątnego H y = g i aktualizacja x
+            std::vector<double> y(k);
+            for (int i = k - 1; i >= 0; --i) {
+                double sum = g[i];
+                for (int j = i + 1; j < k; ++j) sum -= H[i][j] * y[j];
+                y[i] = H[i][i] != 0.0 ? sum / H[i][i] : 0.0;
+            }
+            for (int i = 0; i < k; ++i) axpy(y[i], Z[i], result.x);
+        }
+        return result;
+    }
+
+    KrylovResult GMRES(const SparseMatrix& A, const std::vector<double>& b, int restart,
+                       const Preconditioner* M, double tolerance, int maxIterations,
+                       const std::vector<double>& x0) {
+        return GMRES(wrap(A), b, restart, M, tolerance, maxIterations, x0);
+    }
+
+} // namespace numlib
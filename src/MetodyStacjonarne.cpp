@@ -0,0 +1,339 @@
+#include "../include/numlib/MetodyStacjonarne.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace numlib {
+
+    namespace {
+        const std::size_t ROWS_PER_TASK = 512;
+
+        // Szacowanie omega: maksymalna liczba kroków Gaussa-Seidla i względna zmiana
+        // oszacowania rho, przy której uznajemy je za ustalone
+        const int OMEGA_ESTIMATE_STEPS = 100;
+        const double OMEGA_ESTIMATE_CHANGE = 1e-5;
+
+        // Powyżej tylu pozadiagonalnych niezer na wiersz (średnio) kolorów jest
+        // prawie tyle co wierszy i zamiast kolorowania używana jest kolejność naturalna
+        const std::size_t MULTICOLOR_MAX_ROW_NONZEROS = 32;
+
+        struct SparseRows {
+            const SparseMatrix& A;
+
+            std::size_t size() const { return A.rows(); }
+
+            double rowDot(std::size_t i, const double* x) const {
+                const auto& ptr = A.rowPointers();
+                const auto& col = A.columnIndices();
+                const auto& val = A.values();
+                double sum = 0.0;
+                for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) sum += val[p] * x[col[p]];
+                return sum;
+            }
+
+            template <typename F>
+            void forEachNonzero(std::size_t i, F f) const {
+                const auto& ptr = A.rowPointers();
+                const auto& col = A.columnIndices();
+                const auto& val = A.values();
+                for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                    if (val[p] != 0.0) f(static_cast<std::size_t>(col[p]), val[p]);
+                }
+            }
+        };
+
+        struct DenseRows {
+            ConstMatrixView A;
+
+            std::size_t size() const { return A.rows(); }
+
+            double rowDot(std::size_t i, const double* x) const {
+                return simd::dot(A.cols(), A.row(i), x);
+            }
+
+            template <typename F>
+            void forEachNonzero(std::size_t i, F f) const {
+                const double* a = A.row(i);
+                for (std::size_t j = 0; j < A.cols(); ++j) {
+                    if (a[j] != 0.0) f(j, a[j]);
+                }
+            }
+        };
+
+        // Kolorowanie zachłanne w naturalnej kolejności wierszy. Sąsiedzi to
+        // wzorzec A + A^T, aby wiersze jednego koloru nie czytały się nawzajem.
+        // Sąsiadów z własnego wiersza czyta się wprost z R, a tych z kolumny
+        // (j < i, a_ji != 0) z listy earlier zbudowanej dwoma przebiegami jak
+        // CSR - bez sortowania par i z pamięcią O(nnz).
+        template <typename Rows>
+        int colorRows(const Rows& R, std::vector<int>& color) {
+            std::size_t n = R.size();
+            std::vector<std::size_t> start(n + 1, 0);
+            for (std::size_t i = 0; i < n; ++i) {
+                R.forEachNonzero(i, [&](std::size_t j, double) {
+                    if (j > i) start[j + 1]++;
+                });
+            }
+            for (std::size_t i = 0; i < n; ++i) start[i + 1] += start[i];
+            std::vector<int> earlier(start[n]);
+            std::vector<std::size_t> next(start.begin(), start.end() - 1);
+            for (std::size_t i = 0; i < n; ++i) {
+                R.forEachNonzero(i, [&](std::size_t j, double) {
+                    if (j > i) earlier[next[j]++] = static_cast<int>(i);
+                });
+            }
+
+            color.assign(n, -1);
+            std::vector<std::size_t> usedBy;  // usedBy[c] == i + 1: kolor c zajęty przez sąsiada wiersza i
+            int colors = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                R.forEachNonzero(i, [&](std::size_t j, double) {
+                    if (j < i) usedBy[color[j]] = i + 1;
+                });
+                for (std::size_t p = start[i]; p < start[i + 1]; ++p) usedBy[color[earlier[p]]] = i + 1;
+                int c = 0;
+                while (c < colors && usedBy[c] == i + 1) c++;
+                if (c == colors) {
+                    colors++;
+                    usedBy.push_back(0);
+                }
+                color[i] = c;
+            }
+            return colors;
+        }
+
+        // Granica ciągu ilorazów poprawek przyspieszona procesem Aitkena (delta^2).
+        // Iloraz rośnie monotonicznie do rho, więc wynik nie jest mniejszy niż ostatni iloraz.
+        double extrapolate(const std::vector<double>& ratios) {
+            std::size_t k = ratios.size();
+            double last = ratios[k - 1];
+            if (k < 3) return last;
+            double d1 = ratios[k - 1] - ratios[k - 2], d0 = ratios[k - 2] - ratios[k - 3];
+            double denominator = d1 - d0;
+            if (denominator >= 0.0 || d1 <= 0.0) return last;
+            return std::min(std::max(last - d1 * d1 / denominator, last), 1.0 - 1e-12);
+        }
+
+        double norm(const std::vector<double>& v) {
+            return std::sqrt(simd::dot(v.size(), v.data(), v.data()));
+        }
+
+        // Kolejność przeglądania wierszy: kolor c to order[start[c]..start[c+1])
+        struct SweepPlan {
+            std::vector<int> order;
+            std::vector<std::size_t> start;
+            bool parallel;
+
+            int colors() const { return static_cast<int>(start.size()) - 1; }
+        };
+
+        template <typename Rows>
+        SweepPlan makePlan(const Rows& R, Ordering ordering) {
+            std::size_t n = R.size();
+            SweepPlan plan;
+            plan.order.resize(n);
+            if (ordering == Ordering::Multicolor) {
+                std::size_t offDiagonal = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    R.forEachNonzero(i, [&](std::size_t j, double) {
+                        if (j != i) offDiagonal++;
+                    });
+                }
+                if (offDiagonal > MULTICOLOR_MAX_ROW_NONZEROS * n) ordering = Ordering::Natural;
+            }
+            if (ordering == Ordering::Natural) {
+                for (std::size_t i = 0; i < n; ++i) plan.order[i] = static_cast<int>(i);
+                plan.start = { 0, n };
+                plan.parallel = false;
+                return plan;
+            }
+            std::vector<int> color;
+            int colors = colorRows(R, color);
+            plan.start.assign(colors + 1, 0);
+            for (int c : color) plan.start[c + 1]++;
+            for (int c = 0; c < colors; ++c) plan.start[c + 1] += plan.start[c];
+            std::vector<std::size_t> next(plan.start.begin(), plan.start.end() - 1);
+            for (std::size_t i = 0; i < n; ++i) plan.order[next[color[i]]++] = static_cast<int>(i);
+            plan.parallel = true;
+            return plan;
+        }
+
+        template <typename Rows>
+        class StationaryIteration {
+        private:
+            const Rows& R;
+            const std::vector<double>& b;
+            std::vector<double> invDiag;
+            SweepPlan plan;
+
+        public:
+            StationaryIteration(const Rows& rows, const std::vector<double>& rhs, Ordering ordering)
+                : R(rows), b(rhs), invDiag(rows.size(), 0.0) {
+                for (std::size_t i = 0; i < R.size(); ++i) {
+                    R.forEachNonzero(i, [&](std::size_t j, double a) {
+                        if (j == i) invDiag[i] = 1.0 / a;
+                    });
+                    if (invDiag[i] == 0.0) {
+                        throw std::runtime_error("Zero na przekątnej - metoda stacjonarna niemożliwa");
+                    }
+                }
+                plan = makePlan(R, ordering);
+            }
+
+            int colors() const { return plan.colors(); }
+
+            // Jeden półkrok Gaussa-Seidla / SOR dla wierszy order[first..last)
+            void relax(std::vector<double>& x, std::size_t first, std::size_t last, bool forward, double omega) const {
+                for (std::size_t s = first; s < last; ++s) {
+                    std::size_t i = plan.order[forward ? s : first + last - 1 - s];
+                    x[i] += omega * (b[i] - R.rowDot(i, x.data())) * invDiag[i];
+                }
+            }
+
+            void sweep(std::vector<double>& x, bool forward, double omega) const {
+                int colors = plan.colors();
+                for (int k = 0; k < colors; ++k) {
+                    int c = forward ? k : colors - 1 - k;
+                    std::size_t first = plan.start[c], last = plan.start[c + 1];
+                    if (!plan.parallel) {
+                        relax(x, first, last, forward, omega);
+                        continue;
+                    }
+                    // Wiersze jednego koloru są niezależne - kolejność zadań nie ma znaczenia
+                    int tasks = static_cast<int>((last - first + ROWS_PER_TASK - 1) / ROWS_PER_TASK);
+                    parallelFor(tasks, [&](int t) {
+                        std::size_t from = first + t * ROWS_PER_TASK;
+                        relax(x, from, std::min(last, from + ROWS_PER_TASK), true, omega);
+                    });
+                }
+            }
+
+            void jacobi(const std::vector<double>& x, std::vector<double>& next, double omega) const {
+                std::size_t n = R.size();
+                int tasks = static_cast<int>((n + ROWS_PER_TASK - 1) / ROWS_PER_TASK);
+                parallelFor(tasks, [&](int t) {
+                    std::size_t from = t * ROWS_PER_TASK, to = std::min(n, from + ROWS_PER_TASK);
+                    for (std::size_t i = from; i < to; ++i) {
+                        next[i] = x[i] + omega * (b[i] - R.rowDot(i, x.data())) * invDiag[i];
+                    }
+                });
+            }
+
+            // ||b - A x|| / bnorm; residua wierszy liczone równolegle, suma sekwencyjnie
+            double residual(const std::vector<double>& x, std::vector<double>& r, double bnorm) const {
+                std::size_t n = R.size();
+                int tasks = static_cast<int>((n + ROWS_PER_TASK - 1) / ROWS_PER_TASK);
+                parallelFor(tasks, [&](int t) {
+                    std::size_t from = t * ROWS_PER_TASK, to = std::min(n, from + ROWS_PER_TASK);
+                    for (std::size_t i = from; i < to; ++i) r[i] = b[i] - R.rowDot(i, x.data());
+                });
+                return norm(r) / bnorm;
+            }
+        };
+
+        template <typename Rows>
+        StationaryResult solveStationary(const Rows& R, const std::vector<double>& b,
+                                         const StationaryOptions& options, const std::vector<double>& x0) {
+            std::size_t n = R.size();
+            if (b.size() != n) {
+                throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+            }
+            if (!x0.empty() && x0.size() != n) {
+                throw std::invalid_argument("Nieprawidłowy rozmiar przybliżenia początkowego");
+            }
+            bool jacobi = options.method == StationaryMethod::Jacobi;
+            bool symmetric = options.method == StationaryMethod::SSOR;
+            bool relaxed = options.method == StationaryMethod::SOR || symmetric;
+            // Przy dwóch kolorach półkrok wsteczny SSOR powtórzyłby ostatni kolor
+            // (efektywnie omega (2 - omega)), dlatego SSOR idzie zawsze po kolei
+            Ordering ordering = jacobi || symmetric ? Ordering::Natural : options.ordering;
+            StationaryIteration<Rows> iteration(R, b, ordering);
+
+            StationaryResult result;
+            result.x = x0.empty() ? std::vector<double>(n, 0.0) : x0;
+            result.iterations = 0;
+            result.converged = false;
+            result.colors = jacobi ? 1 : iteration.colors();
+            result.omega = relaxed || jacobi ? options.omega : 1.0;
+            bool estimating = relaxed && options.omega <= 0.0;
+            if (result.omega <= 0.0) result.omega = 1.0;
+
+            double bnorm = norm(b);
+            if (bnorm == 0.0) {
+                std::fill(result.x.begin(), result.x.end(), 0.0);
+                result.residual = 0.0;
+                result.converged = true;
+                result.residuals.push_back(0.0);
+                return result;
+            }
+            std::vector<double> r(n), work(n);
+            result.residual = iteration.residual(result.x, r, bnorm);
+            result.residuals.push_back(result.residual);
+            result.converged = result.residual < options.tolerance;
+
+            double previousDelta = 0.0, previousEstimate = 0.0;
+            std::vector<double> ratios;
+            while (!result.converged && result.iterations < options.maxIterations) {
+                if (jacobi) {
+                    iteration.jacobi(result.x, work, result.omega);
+                    std::swap(result.x, work);
+                } else if (estimating) {
+                    // Krok Gaussa-Seidla z pomiarem poprawki
+                    work = result.x;
+                    iteration.sweep(result.x, true, 1.0);
+                    for (std::size_t i = 0; i < n; ++i) work[i] = result.x[i] - work[i];
+                    double delta = norm(work);
+                    if (previousDelta > 0.0) {
+                        ratios.push_back(delta / previousDelta);
+                        double estimate = extrapolate(ratios);
+                        bool settled = std::abs(estimate - previousEstimate) < OMEGA_ESTIMATE_CHANGE * estimate;
+                        if (settled || result.iterations + 1 >= OMEGA_ESTIMATE_STEPS) {
+                            estimating = false;
+                            if (estimate < 1.0) {
+                                result.omega = symmetric ? 2.0 / (1.0 + std::sqrt(2.0 * (1.0 - std::sqrt(estimate))))
+                                                         : 2.0 / (1.0 + std::sqrt(1.0 - estimate));
+                            }
+                        }
+                        previousEstimate = estimate;
+                    }
+                    previousDelta = delta;
+                } else {
+                    iteration.sweep(result.x, true, result.omega);
+                    if (symmetric) iteration.sweep(result.x, false, result.omega);
+                }
+                result.iterations++;
+                result.residual = iteration.residual(result.x, r, bnorm);
+                result.residuals.push_back(result.residual);
+                result.converged = result.residual < options.tolerance;
+            }
+            return result;
+        }
+    }
+
+    StationaryResult StationarySolve(const SparseMatrix& A, const std::vector<double>& b,
+                                     const StationaryOptions& options, const std::vector<double>& x0) {
+        if (A.rows() != A.cols()) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        return solveStationary(SparseRows{ A }, b, options, x0);
+    }
+
+    StationaryResult StationarySolve(ConstMatrixView A, const std::vector<double>& b,
+                                     const StationaryOptions& options, const std::vector<double>& x0) {
+        if (A.rows() != A.cols()) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        return solveStationary(DenseRows{ A }, b, options, x0);
+    }
+
+    int greedyColoring(const SparseMatrix& A, std::vector<int>& color) {
+        if (A.rows() != A.cols()) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        return colorRows(SparseRows{ A }, color);
+    }
+
+} // namespace numlib
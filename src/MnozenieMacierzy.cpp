@@ -0,0 +1,437 @@
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include "SIMDWewnetrzne.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace numlib {
+
+    namespace {
+        using Buffer = std::vector<double, AlignedAllocator<double>>;
+
+        // Rozmiary bloków: pasek A (mr x KC) mieści się w L1, blok B (KC x NC) w L2.
+        // MC i NC są wielokrotnościami mr i nr wszystkich jąder. Spakowane op(A)
+        // zajmuje m x KC liczb i pakowane jest raz na pasek KC.
+        const std::size_t KC = 256;
+        const std::size_t MC = 96;
+        const std::size_t NC = 480;
+        const std::size_t MAX_MR = 8;
+        const std::size_t MAX_NR = 24;
+
+        const std::size_t SYRK_BLOCK = 192;
+        const std::size_t TRSM_BLOCK = 128;
+        const std::size_t TRSM_COLS = 256;  // kolumny B rozwiązywane przez jedno zadanie
+        const std::size_t TRSM_ROWS = 64;
+
+        // Element (i, j) macierzy op(X) leży pod adresem data + i * rs + j * cs
+        struct Operand {
+            const double* data;
+            std::size_t rs, cs;
+
+            Operand(ConstMatrixView X, Op op)
+                : data(X.data()), rs(op == Op::None ? X.stride() : 1), cs(op == Op::None ? 1 : X.stride()) {}
+
+            const double* at(std::size_t i, std::size_t j) const { return data + i * rs + j * cs; }
+            double operator()(std::size_t i, std::size_t j) const { return *at(i, j); }
+        };
+
+        // C[mr x nr] += a * b, gdzie a to pasek [kc][mr], a b - pasek [kc][nr]
+        typedef void (*MicroKernel)(std::size_t kc, const double* a, const double* b, double* c, std::size_t ldc);
+
+        struct GemmKernel {
+            std::size_t mr, nr;
+            MicroKernel kernel;
+        };
+
+        template <std::size_t MR, std::size_t NR>
+        void kernelGeneric(std::size_t kc, const double* a, const double* b, double* c, std::size_t ldc) {
+            double acc[MR][NR] = {};
+            for (std::size_t p = 0; p < kc; ++p) {
+                for (std::size_t i = 0; i < MR; ++i) {
+                    const double ai = a[i];
+                    for (std::size_t j = 0; j < NR; ++j) acc[i][j] += ai * b[j];
+                }
+                a += MR;
+                b += NR;
+            }
+            for (std::size_t i = 0; i < MR; ++i) {
+                for (std::size_t j = 0; j < NR; ++j) c[i * ldc + j] += acc[i][j];
+            }
+        }
+
+#if NUMLIB_SIMD_X86
+        // 6 x 8: 12 akumulatorów, 2 rejestry na wiersz paska B i 1 na element A
+        NUMLIB_TARGET("avx2,fma")
+        void kernelAVX2(std::size_t kc, const double* a, const double* b, double* c, std::size_t ldc) {
+            __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+            __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+            __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+            __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+            __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+            __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+            for (std::size_t r = 0; r < 6; ++r) {
+                _mm_prefetch(reinterpret_cast<const char*>(c + r * ldc), _MM_HINT_T0);
+                _mm_prefetch(reinterpret_cast<const char*>(c + r * ldc + 7), _MM_HINT_T0);
+            }
+            for (std::size_t p = 0; p < kc; ++p) {
+                __m256d b0 = _mm256_load_pd(b), b1 = _mm256_load_pd(b + 4);
+                __m256d ai;
+                ai = _mm256_broadcast_sd(a);
+                c00 = _mm256_fmadd_pd(ai, b0, c00); c01 = _mm256_fmadd_pd(ai, b1, c01);
+                ai = _mm256_broadcast_sd(a + 1);
+                c10 = _mm256_fmadd_pd(ai, b0, c10); c11 = _mm256_fmadd_pd(ai, b1, c11);
+                ai = _mm256_broadcast_sd(a + 2);
+                c20 = _mm256_fmadd_pd(ai, b0, c20); c21 = _mm256_fmadd_pd(ai, b1, c21);
+                ai = _mm256_broadcast_sd(a + 3);
+                c30 = _mm256_fmadd_pd(ai, b0, c30); c31 = _mm256_fmadd_pd(ai, b1, c31);
+                ai = _mm256_broadcast_sd(a + 4);
+                c40 = _mm256_fmadd_pd(ai, b0, c40); c41 = _mm256_fmadd_pd(ai, b1, c41);
+                ai = _mm256_broadcast_sd(a + 5);
+                c50 = _mm256_fmadd_pd(ai, b0, c50); c51 = _mm256_fmadd_pd(ai, b1, c51);
+                a += 6;
+                b += 8;
+            }
+#define NUMLIB_STORE_ROW(r, x0, x1) { \
+                double* cr = c + (r) * ldc; \
+                _mm256_storeu_pd(cr, _mm256_add_pd(_mm256_loadu_pd(cr), x0)); \
+                _mm256_storeu_pd(cr + 4, _mm256_add_pd(_mm256_loadu_pd(cr + 4), x1)); }
+            NUMLIB_STORE_ROW(0, c00, c01)
+            NUMLIB_STORE_ROW(1, c10, c11)
+            NUMLIB_STORE_ROW(2, c20, c21)
+            NUMLIB_STORE_ROW(3, c30, c31)
+            NUMLIB_STORE_ROW(4, c40, c41)
+            NUMLIB_STORE_ROW(5, c50, c51)
+#undef NUMLIB_STORE_ROW
+        }
+
+        // 8 x 24: 24 akumulatory, 3 rejestry na wiersz paska B i 1 na element A
+        NUMLIB_TARGET("avx512f")
+        void kernelAVX512(std::size_t kc, const double* a, const double* b, double* c, std::size_t ldc) {
+#define NUMLIB_ZERO_ROW(r) __m512d c##r##0 = _mm512_setzero_pd(), c##r##1 = _mm512_setzero_pd(), \
+                                   c##r##2 = _mm512_setzero_pd();
+            NUMLIB_ZERO_ROW(0) NUMLIB_ZERO_ROW(1) NUMLIB_ZERO_ROW(2) NUMLIB_ZERO_ROW(3)
+            NUMLIB_ZERO_ROW(4) NUMLIB_ZERO_ROW(5) NUMLIB_ZERO_ROW(6) NUMLIB_ZERO_ROW(7)
+#undef NUMLIB_ZERO_ROW
+            // Kafelek C czytany jest dopiero po pętli - ściągamy go do L1 w jej trakcie
+            for (std::size_t r = 0; r < 8; ++r) {
+                _mm_prefetch(reinterpret_cast<const char*>(c + r * ldc), _MM_HINT_T0);
+                _mm_prefetch(reinterpret_cast<const char*>(c + r * ldc + 23), _MM_HINT_T0);
+            }
+            for (std::size_t p = 0; p < kc; ++p) {
+                __m512d b0 = _mm512_load_pd(b), b1 = _mm512_load_pd(b + 8), b2 = _mm512_load_pd(b + 16);
+#define NUMLIB_FMA_ROW(r) { \
+                    __m512d ai = _mm512_set1_pd(a[r]); \
+                    c##r##0 = _mm512_fmadd_pd(ai, b0, c##r##0); \
+                    c##r##1 = _mm512_fmadd_pd(ai, b1, c##r##1); \
+                    c##r##2 = _mm512_fmadd_pd(ai, b2, c##r##2); }
+                NUMLIB_FMA_ROW(0) NUMLIB_FMA_ROW(1) NUMLIB_FMA_ROW(2) NUMLIB_FMA_ROW(3)
+                NUMLIB_FMA_ROW(4) NUMLIB_FMA_ROW(5) NUMLIB_FMA_ROW(6) NUMLIB_FMA_ROW(7)
+#undef NUMLIB_FMA_ROW
+                a += 8;
+                b += 24;
+            }
+#define NUMLIB_STORE_ROW(r) { \
+                double* cr = c + (r) * ldc; \
+                _mm512_storeu_pd(cr, _mm512_add_pd(_mm512_loadu_pd(cr), c##r##0)); \
+                _mm512_storeu_pd(cr + 8, _mm512_add_pd(_mm512_loadu_pd(cr + 8), c##r##1)); \
+                _mm512_storeu_pd(cr + 16, _mm512_add_pd(_mm512_loadu_pd(cr + 16), c##r##2)); }
+            NUMLIB_STORE_ROW(0) NUMLIB_STORE_ROW(1) NUMLIB_STORE_ROW(2) NUMLIB_STORE_ROW(3)
+            NUMLIB_STORE_ROW(4) NUMLIB_STORE_ROW(5) NUMLIB_STORE_ROW(6) NUMLIB_STORE_ROW(7)
+#undef NUMLIB_STORE_ROW
+        }
+#endif
+
+        const GemmKernel& selectKernel() {
+            static const GemmKernel generic = { 4, 8, kernelGeneric<4, 8> };
+#if NUMLIB_SIMD_X86
+            static const GemmKernel avx2 = { 6, 8, kernelAVX2 };
+            static const GemmKernel avx512 = { 8, 24, kernelAVX512 };
+            switch (simd::activeLevel()) {
+                case SimdLevel::AVX512: return avx512;
+                case SimdLevel::AVX2: return avx2;
+                default: break;
+            }
+#endif
+            return generic;
+        }
+
+        // Pasek op(A) o rows <= MR wierszach: zapis idzie sekwencyjnie, odczyt
+        // równolegle z MR wierszy źródła (stałe MR pozwala rozwinąć pętlę)
+        template <std::size_t MR>
+        void packPanelA(const Operand& A, std::size_t i0, std::size_t rows, std::size_t p0, std::size_t kc,
+                        double alpha, double* out) {
+            if (rows < MR) {
+                for (std::size_t p = 0; p < kc; ++p) {
+                    for (std::size_t r = 0; r < MR; ++r) out[p * MR + r] = r < rows ? alpha * A(i0 + r, p0 + p) : 0.0;
+                }
+                return;
+            }
+            const double* src[MR];
+            for (std::size_t r = 0; r < MR; ++r) src[r] = A.at(i0 + r, p0);
+            for (std::size_t p = 0; p < kc; ++p) {
+                std::size_t offset = p * A.cs;
+                for (std::size_t r = 0; r < MR; ++r) out[p * MR + r] = alpha * src[r][offset];
+            }
+        }
+
+        // Pakuje blok op(A)(i0.., p0..) o wymiarach mc x kc w paski po mr wierszy
+        // pomnożone przez alpha; wiersze poza blokiem są zerowe
+        void packA(const Operand& A, std::size_t i0, std::size_t mc, std::size_t p0, std::size_t kc,
+                   std::size_t mr, double alpha, double* out) {
+            for (std::size_t ir = 0; ir < mc; ir += mr) {
+                std::size_t rows = std::min(mr, mc - ir);
+                switch (mr) {
+                    case 8: packPanelA<8>(A, i0 + ir, rows, p0, kc, alpha, out); break;
+                    case 6: packPanelA<6>(A, i0 + ir, rows, p0, kc, alpha, out); break;
+                    default: packPanelA<4>(A, i0 + ir, rows, p0, kc, alpha, out); break;
+                }
+                out += kc * mr;
+            }
+        }
+
+        // Pakuje pasek op(B)(p0.., j0..) o wymiarach kc x cols (cols <= nr), dopełniony zerami
+        void packB(const Operand& B, std::size_t p0, std::size_t kc, std::size_t j0, std::size_t cols,
+                   std::size_t nr, double* out) {
+            for (std::size_t p = 0; p < kc; ++p) {
+                const double* src = B.at(p0 + p, j0);
+                double* dst = out + p * nr;
+                if (B.cs == 1) {
+                    std::copy(src, src + cols, dst);
+                } else {
+                    for (std::size_t j = 0; j < cols; ++j) dst[j] = src[j * B.cs];
+                }
+                std::fill(dst + cols, dst + nr, 0.0);
+            }
+        }
+
+        // C(0..mc, 0..nc) += Ap * Bp; niepełne kafelki liczone są w buforze
+        void macroKernel(const GemmKernel& K, std::size_t mc, std::size_t nc, std::size_t kc,
+                         const double* Ap, const double* Bp, double* C, std::size_t ldc) {
+            alignas(64) double tile[MAX_MR * MAX_NR];
+            for (std::size_t ir = 0; ir < mc; ir += K.mr) {
+                std::size_t rows = std::min(K.mr, mc - ir);
+                const double* a = Ap + (ir / K.mr) * kc * K.mr;
+                for (std::size_t jr = 0; jr < nc; jr += K.nr) {
+                    std::size_t cols = std::min(K.nr, nc - jr);
+                    const double* b = Bp + (jr / K.nr) * kc * K.nr;
+                    double* c = C + ir * ldc + jr;
+                    if (rows == K.mr && cols == K.nr) {
+                        K.kernel(kc, a, b, c, ldc);
+                        continue;
+                    }
+                    std::fill(tile, tile + K.mr * K.nr, 0.0);
+                    K.kernel(kc, a, b, tile, K.nr);
+                    for (std::size_t i = 0; i < rows; ++i) {
+                        for (std::size_t j = 0; j < cols; ++j) c[i * ldc + j] += tile[i * K.nr + j];
+                    }
+                }
+            }
+        }
+
+        void scale(MatrixView C, double beta) {
+            if (beta == 1.0) return;
+            for (std::size_t i = 0; i < C.rows(); ++i) {
+                double* c = C.row(i);
+                if (beta == 0.0) {
+                    std::fill(c, c + C.cols(), 0.0);
+                } else {
+                    for (std::size_t j = 0; j < C.cols(); ++j) c[j] *= beta;
+                }
+            }
+        }
+
+        std::size_t opRows(ConstMatrixView X, Op op) { return op == Op::None ? X.rows() : X.cols(); }
+        std::size_t opCols(ConstMatrixView X, Op op) { return op == Op::None ? X.cols() : X.rows(); }
+
+        // Fragment op(X)(r0..r0+nr, c0..c0+nc) w postaci widoku przechowywanej macierzy
+        ConstMatrixView opBlock(ConstMatrixView X, Op op, std::size_t r0, std::size_t c0,
+                                std::size_t nr, std::size_t nc) {
+            return op == Op::None ? X.block(r0, c0, nr, nc) : X.block(c0, r0, nc, nr);
+        }
+
+        Op flip(Op op) { return op == Op::None ? Op::Transpose : Op::None; }
+    }
+
+    void gemm(Op opA, Op opB, double alpha, ConstMatrixView A, ConstMatrixView B,
+              double beta, MatrixView C) {
+        std::size_t m = opRows(A, opA), k = opCols(A, opA), n = opCols(B, opB);
+        if (opRows(B, opB) != k || C.rows() != m || C.cols() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        scale(C, beta);
+        if (m == 0 || n == 0 || k == 0 || alpha == 0.0) return;
+
+        const GemmKernel& K = selectKernel();
+        Operand a(A, opA), b(B, opB);
+        std::size_t rowBlocks = (m + MC - 1) / MC;
+        std::size_t threads = static_cast<std::size_t>(getNumThreads());
+        // Cały pasek op(A)(:, pc..) pakowany jest raz i służy wszystkim blokom
+        // kolumn jc; blok ic zaczyna się w packedA od ic * kc
+        Buffer packedA(rowBlocks * MC * std::min(KC, k));
+        Buffer packedB(KC * NC);
+
+        for (std::size_t pc = 0; pc < k; pc += KC) {
+            std::size_t kc = std::min(KC, k - pc);
+            parallelFor(static_cast<int>(rowBlocks), [&](int t) {
+                std::size_t ic = t * MC;
+                packA(a, ic, std::min(MC, m - ic), pc, kc, K.mr, alpha, packedA.data() + ic * kc);
+            });
+            for (std::size_t jc = 0; jc < n; jc += NC) {
+                std::size_t nc = std::min(NC, n - jc);
+                std::size_t panels = (nc + K.nr - 1) / K.nr;
+                parallelFor(static_cast<int>(panels), [&](int t) {
+                    std::size_t j0 = t * K.nr;
+                    packB(b, pc, kc, jc + j0, std::min(K.nr, nc - j0), K.nr, packedB.data() + t * kc * K.nr);
+                });
+
+                // Przy małej liczbie bloków wierszy dzielimy dodatkowo paski B,
+                // aby zająć wszystkie wątki; nie zmienia to kolejności działań
+                std::size_t parts = rowBlocks >= threads ? 1
+                                  : std::min(panels, (threads + rowBlocks - 1) / rowBlocks);
+                parallelFor(static_cast<int>(rowBlocks * parts), [&](int t) {
+                    std::size_t ic = (t / parts) * MC;
+                    std::size_t mc = std::min(MC, m - ic);
+                    std::size_t part = t % parts;
+                    std::size_t first = panels * part / parts, last = panels * (part + 1) / parts;
+                    if (first == last) return;
+                    std::size_t j0 = first * K.nr;
+                    std::size_t cols = std::min(nc, last * K.nr) - j0;
+                    macroKernel(K, mc, cols, kc, packedA.data() + ic * kc, packedB.data() + first * kc * K.nr,
+                                C.row(ic) + jc + j0, C.stride());
+                });
+            }
+        }
+    }
+
+    Matrix multiply(ConstMatrixView A, ConstMatrixView B) {
+        Matrix C(A.rows(), B.cols());
+        gemm(Op::None, Op::None, 1.0, A, B, 0.0, C.view());
+        return C;
+    }
+
+    void syrk(Triangle uplo, Op op, double alpha, ConstMatrixView A, double beta, MatrixView C) {
+        std::size_t n = opRows(A, op), k = opCols(A, op);
+        if (C.rows() != n || C.cols() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        Matrix diagonal;
+        for (std::size_t i0 = 0; i0 < n; i0 += SYRK_BLOCK) {
+            std::size_t ni = std::min(SYRK_BLOCK, n - i0);
+            ConstMatrixView Ai = opBlock(A, op, i0, 0, ni, k);
+
+            // Blok przekątny liczony w całości do bufora, kopiowany tylko trójkąt
+            diagonal = Matrix(ni, ni);
+            gemm(op, flip(op), alpha, Ai, Ai, 0.0, diagonal.view());
+            for (std::size_t i = 0; i < ni; ++i) {
+                std::size_t j0 = uplo == Triangle::Lower ? 0 : i;
+                std::size_t j1 = uplo == Triangle::Lower ? i + 1 : ni;
+                double* c = C.row(i0 + i) + i0;
+                for (std::size_t j = j0; j < j1; ++j) {
+                    c[j] = (beta == 0.0 ? 0.0 : beta * c[j]) + diagonal(i, j);
+                }
+            }
+
+            if (uplo == Triangle::Lower && i0 > 0) {
+                gemm(op, flip(op), alpha, Ai, opBlock(A, op, 0, 0, i0, k), beta, C.block(i0, 0, ni, i0));
+            }
+            std::size_t i1 = i0 + ni;
+            if (uplo == Triangle::Upper && i1 < n) {
+                gemm(op, flip(op), alpha, Ai, opBlock(A, op, i1, 0, n - i1, k), beta, C.block(i0, i1, ni, n - i1));
+            }
+        }
+    }
+
+    namespace {
+        // Rozwiązanie z blokiem przekątnym M(k0..k1, k0..k1) macierzy M = op(T), T po lewej.
+        // Kolumny B są niezależne, więc paski kolumn trafiają do puli wątków.
+        void solveLeftBlock(const Operand& M, bool lower, bool unit, MatrixView B, std::size_t k0, std::size_t k1) {
+            std::size_t m = B.cols();
+            parallelFor(static_cast<int>((m + TRSM_COLS - 1) / TRSM_COLS), [&](int t) {
+                std::size_t j0 = t * TRSM_COLS;
+                std::size_t cols = std::min(TRSM_COLS, m - j0);
+                for (std::size_t s = k0; s < k1; ++s) {
+                    std::size_t i = lower ? s : k0 + k1 - 1 - s;
+                    double* bi = B.row(i) + j0;
+                    std::size_t from = lower ? k0 : i + 1;
+                    std::size_t to = lower ? i : k1;
+                    for (std::size_t j = from; j < to; ++j) {
+                        simd::axpy(cols, -M(i, j), B.row(j) + j0, bi);
+                    }
+                    if (!unit) {
+                        double d = 1.0 / M(i, i);
+                        for (std::size_t c = 0; c < cols; ++c) bi[c] *= d;
+                    }
+                }
+            });
+        }
+
+        // To samo dla T po prawej: każdy wiersz X spełnia x M = b niezależnie od pozostałych
+        void solveRightBlock(const Operand& M, bool lower, bool unit, MatrixView B, std::size_t k0, std::size_t k1) {
+            std::size_t m = B.rows();
+            parallelFor(static_cast<int>((m + TRSM_ROWS - 1) / TRSM_ROWS), [&](int t) {
+                std::size_t r0 = t * TRSM_ROWS;
+                std::size_t r1 = std::min(m, r0 + TRSM_ROWS);
+                for (std::size_t r = r0; r < r1; ++r) {
+                    double* x = B.row(r);
+                    for (std::size_t s = k0; s < k1; ++s) {
+                        std::size_t j = lower ? k0 + k1 - 1 - s : s;
+                        std::size_t from = lower ? j + 1 : k0;
+                        std::size_t to = lower ? k1 : j;
+                        double sum = x[j];
+                        for (std::size_t i = from; i < to; ++i) sum -= x[i] * M(i, j);
+                        x[j] = unit ? sum : sum / M(j, j);
+                    }
+                }
+            });
+        }
+    }
+
+    void trsm(Side side, Triangle uplo, Op op, Diagonal diag, double alpha,
+              ConstMatrixView T, MatrixView B) {
+        std::size_t nt = side == Side::Left ? B.rows() : B.cols();
+        if (T.rows() != nt || T.cols() != nt) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        scale(B, alpha);
+        if (B.rows() == 0 || B.cols() == 0) return;
+
+        // Trójkąt efektywnej macierzy M = op(T)
+        bool lower = (uplo == Triangle::Lower) != (op == Op::Transpose);
+        bool unit = diag == Diagonal::Unit;
+        Operand M(T, op);
+        std::size_t blocks = (nt + TRSM_BLOCK - 1) / TRSM_BLOCK;
+
+        // Przy M dolnej (lewa strona) lub górnej (prawa strona) bloki idą od początku
+        bool forward = (side == Side::Left) == lower;
+        for (std::size_t s = 0; s < blocks; ++s) {
+            std::size_t blk = forward ? s : blocks - 1 - s;
+            std::size_t k0 = blk * TRSM_BLOCK;
+            std::size_t k1 = std::min(nt, k0 + TRSM_BLOCK);
+            std::size_t kb = k1 - k0;
+            if (side == Side::Left) {
+                std::size_t m = B.cols();
+                solveLeftBlock(M, lower, unit, B, k0, k1);
+                ConstMatrixView Xk = B.block(k0, 0, kb, m);
+                if (lower && k1 < nt) {
+                    gemm(op, Op::None, -1.0, opBlock(T, op, k1, k0, nt - k1, kb), Xk, 1.0,
+                         B.block(k1, 0, nt - k1, m));
+                } else if (!lower && k0 > 0) {
+                    gemm(op, Op::None, -1.0, opBlock(T, op, 0, k0, k0, kb), Xk, 1.0, B.block(0, 0, k0, m));
+                }
+            } else {
+                std::size_t m = B.rows();
+                solveRightBlock(M, lower, unit, B, k0, k1);
+                ConstMatrixView Xk = B.block(0, k0, m, kb);
+                if (!lower && k1 < nt) {
+                    gemm(Op::None, op, -1.0, Xk, opBlock(T, op, k0, k1, kb, nt - k1), 1.0,
+                         B.block(0, k1, m, nt - k1));
+                } else if (lower && k0 > 0) {
+                    gemm(Op::None, op, -1.0, Xk, opBlock(T, op, k0, 0, kb, k0), 1.0, B.block(0, 0, m, k0));
+                }
+            }
+        }
+    }
+
+} // namespace numlib
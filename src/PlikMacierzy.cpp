@@ -0,0 +1,290 @@
+#include "../include/numlib/PlikMacierzy.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        const char MAGIC[8] = { 'N', 'U', 'M', 'L', 'I', 'B', 'M', 'F' };
+        const std::uint32_t BYTE_ORDER_TAG = 0x01020304;
+        const std::size_t MAX_ALIGNMENT = 4096;    // nie większe niż strona, od której zaczyna się odwzorowanie
+
+        static_assert(sizeof(std::size_t) == sizeof(std::uint64_t),
+                      "Wskaźniki wierszy CSR odwzorowywane są jako size_t");
+
+        // Działania nasycające: przepełnienie daje SIZE_MAX, więc nagłówek z wymiarami,
+        // których iloczyn nie mieści się w size_t, zawsze wskazuje na plik za krótki
+        constexpr std::size_t SATURATED = std::numeric_limits<std::size_t>::max();
+
+        std::size_t addSaturated(std::size_t a, std::size_t b) {
+            return a > SATURATED - b ? SATURATED : a + b;
+        }
+
+        std::size_t mulSaturated(std::size_t a, std::size_t b) {
+            return b != 0 && a > SATURATED / b ? SATURATED : a * b;
+        }
+
+        std::size_t alignUp(std::size_t x, std::size_t a) {
+            if (x > SATURATED - (a - 1)) return SATURATED;
+            return (x + a - 1) / a * a;
+        }
+
+        std::size_t scalarBytes(ScalarType scalar) {
+            return scalar == ScalarType::Float32 ? sizeof(float) : sizeof(double);
+        }
+
+        // Przesunięcia sekcji danych od początku pliku
+        struct Sections {
+            std::size_t data = 0;       // Dense/Vector: dane, SparseCSR: rowPointers
+            std::size_t indices = 0;    // SparseCSR: columnIndices
+            std::size_t values = 0;     // SparseCSR: values
+            std::size_t end = 0;
+        };
+
+        Sections sections(const MatrixFileHeader& h) {
+            Sections s;
+            s.data = alignUp(sizeof(MatrixFileHeader), h.alignment);
+            std::size_t bytes = scalarBytes(static_cast<ScalarType>(h.scalar));
+            switch (static_cast<MatrixFileLayout>(h.layout)) {
+            case MatrixFileLayout::Dense:
+                s.end = addSaturated(s.data, mulSaturated(mulSaturated(h.rows, h.stride), bytes));
+                break;
+            case MatrixFileLayout::Vector:
+                s.end = addSaturated(s.data, mulSaturated(h.rows, bytes));
+                break;
+            case MatrixFileLayout::SparseCSR:
+                s.indices = alignUp(addSaturated(s.data, mulSaturated(addSaturated(h.rows, 1), sizeof(std::uint64_t))),
+                                    h.alignment);
+                s.values = alignUp(addSaturated(s.indices, mulSaturated(h.nnz, sizeof(std::int32_t))), h.alignment);
+                s.end = addSaturated(s.values, mulSaturated(h.nnz, sizeof(double)));
+                break;
+            }
+            return s;
+        }
+
+        MatrixFileHeader makeHeader(MatrixFileLayout layout, ScalarType scalar, std::size_t alignment,
+                                    std::size_t rows, std::size_t cols) {
+            if (alignment < 8 || alignment > MAX_ALIGNMENT || (alignment & (alignment - 1)) != 0) {
+                throw std::invalid_argument("Wyrównanie musi być potęgą dwójki z przedziału [8, 4096]");
+            }
+            MatrixFileHeader h{};
+            std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+            h.version = MATRIX_FILE_VERSION;
+            h.layout = static_cast<std::uint8_t>(layout);
+            h.scalar = static_cast<std::uint8_t>(scalar);
+            h.alignment = static_cast<std::uint32_t>(alignment);
+            h.byteOrder = BYTE_ORDER_TAG;
+            h.rows = rows;
+            h.cols = cols;
+            return h;
+        }
+
+        bool validHeader(const MatrixFileHeader& h) {
+            if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0 || h.version != MATRIX_FILE_VERSION ||
+                h.byteOrder != BYTE_ORDER_TAG) {
+                return false;
+            }
+            if (h.alignment < 8 || h.alignment > MAX_ALIGNMENT || (h.alignment & (h.alignment - 1)) != 0) {
+                return false;
+            }
+            if (h.scalar > static_cast<std::uint8_t>(ScalarType::Float32)) return false;
+            switch (static_cast<MatrixFileLayout>(h.layout)) {
+            case MatrixFileLayout::Dense:
+                return h.stride >= h.cols;
+            case MatrixFileLayout::Vector:
+                return h.cols == 1;
+            case MatrixFileLayout::SparseCSR:
+                return h.scalar == static_cast<std::uint8_t>(ScalarType::Float64);
+            }
+            return false;
+        }
+
+        void writeBytes(std::ofstream& out, const void* data, std::size_t bytes) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+            if (!out) {
+                throw std::runtime_error("Błąd zapisu pliku macierzy");
+            }
+        }
+
+        // Dopisuje zera aż do przesunięcia offset
+        void padTo(std::ofstream& out, std::size_t offset) {
+            static const char zeros[MAX_ALIGNMENT] = {};
+            std::size_t position = static_cast<std::size_t>(out.tellp());
+            if (position < offset) writeBytes(out, zeros, offset - position);
+        }
+
+        std::ofstream openForWriting(const std::string& path) {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                throw std::runtime_error("Nie można utworzyć pliku " + path);
+            }
+            return out;
+        }
+
+        // Zapisuje n elementów w wybranej precyzji
+        void writeScalars(std::ofstream& out, const double* data, std::size_t n, ScalarType scalar,
+                          std::vector<char>& buffer) {
+            if (scalar == ScalarType::Float64) {
+                writeBytes(out, data, n * sizeof(double));
+                return;
+            }
+            buffer.resize(n * sizeof(float));
+            float* f = reinterpret_cast<float*>(buffer.data());
+            for (std::size_t i = 0; i < n; i++) f[i] = static_cast<float>(data[i]);
+            writeBytes(out, f, n * sizeof(float));
+        }
+    }
+
+    MatrixFile::MatrixFile(const std::string& path, Access mode) : access(mode) {
+        file = MappedFile(path, mode == Access::CopyOnWrite ? MappedFile::Mode::CopyOnWrite
+                                                            : MappedFile::Mode::ReadOnly);
+        if (file.size() < sizeof(MatrixFileHeader)) {
+            throw std::runtime_error("Plik " + path + " nie jest plikiem macierzy");
+        }
+        std::memcpy(&header, file.data(), sizeof(MatrixFileHeader));
+        if (!validHeader(header)) {
+            throw std::runtime_error("Nieprawidłowy nagłówek pliku macierzy " + path);
+        }
+        Sections s = sections(header);
+        if (file.size() < s.end) {
+            throw std::runtime_error("Plik macierzy " + path + " jest za krótki");
+        }
+        if (layout() == MatrixFileLayout::SparseCSR) {
+            const std::uint64_t* ptr = reinterpret_cast<const std::uint64_t*>(section(s.data));
+            if (ptr[0] != 0 || ptr[header.rows] != header.nnz) {
+                throw std::runtime_error("Niespójne wskaźniki wierszy w pliku " + path);
+            }
+        }
+    }
+
+    void MatrixFile::require(MatrixFileLayout expected, ScalarType scalar) const {
+        if (layout() != expected || scalarType() != scalar) {
+            throw std::runtime_error("Plik zawiera dane innego rodzaju lub typu");
+        }
+    }
+
+    ConstMatrixView MatrixFile::dense() const {
+        require(MatrixFileLayout::Dense, ScalarType::Float64);
+        return ConstMatrixView(reinterpret_cast<const double*>(section(sections(header).data)),
+                               header.rows, header.cols, header.stride);
+    }
+
+    MatrixViewT<const float> MatrixFile::denseFloat() const {
+        require(MatrixFileLayout::Dense, ScalarType::Float32);
+        return MatrixViewT<const float>(reinterpret_cast<const float*>(section(sections(header).data)),
+                                        header.rows, header.cols, header.stride);
+    }
+
+    MatrixView MatrixFile::mutableDense() {
+        if (access != Access::CopyOnWrite) {
+            throw std::runtime_error("Plik otwarto tylko do odczytu");
+        }
+        require(MatrixFileLayout::Dense, ScalarType::Float64);
+        char* base = static_cast<char*>(file.data()) + sections(header).data;
+        return MatrixView(reinterpret_cast<double*>(base), header.rows, header.cols, header.stride);
+    }
+
+    Span<const double> MatrixFile::vector() const {
+        require(MatrixFileLayout::Vector, ScalarType::Float64);
+        return Span<const double>(reinterpret_cast<const double*>(section(sections(header).data)), header.rows);
+    }
+
+    Span<const float> MatrixFile::vectorFloat() const {
+        require(MatrixFileLayout::Vector, ScalarType::Float32);
+        return Span<const float>(reinterpret_cast<const float*>(section(sections(header).data)), header.rows);
+    }
+
+    SparseMatrixView MatrixFile::sparse() const {
+        require(MatrixFileLayout::SparseCSR, ScalarType::Float64);
+        Sections s = sections(header);
+        return SparseMatrixView(header.rows, header.cols,
+                                Span<const std::size_t>(reinterpret_cast<const std::size_t*>(section(s.data)), header.rows + 1),
+                                Span<const int>(reinterpret_cast<const int*>(section(s.indices)), header.nnz),
+                                Span<const double>(reinterpret_cast<const double*>(section(s.values)), header.nnz));
+    }
+
+    MatrixFileWriter::MatrixFileWriter(const std::string& path, std::size_t rows, std::size_t cols,
+                                       ScalarType scalar, std::size_t alignment) {
+        header = makeHeader(MatrixFileLayout::Dense, scalar, alignment, rows, cols);
+        // Każdy wiersz zaczyna się na granicy wyrównania, jak w Matrix
+        header.stride = alignUp(cols, std::max<std::size_t>(1, alignment / scalarBytes(scalar)));
+        out = openForWriting(path);
+        writeBytes(out, &header, sizeof(header));
+        padTo(out, sections(header).data);
+        rowBuffer.assign(header.stride * scalarBytes(scalar), 0);
+    }
+
+    MatrixFileWriter::~MatrixFileWriter() {
+        // Niedokończony plik zostaje za krótki, więc MatrixFile go odrzuci
+        if (out.is_open()) out.close();
+    }
+
+    void MatrixFileWriter::writeRow(Span<const double> row) {
+        if (row.size() != header.cols) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        if (written == header.rows) {
+            throw std::runtime_error("Zapisano już wszystkie wiersze macierzy");
+        }
+        // Bufor ma długość stride, więc dopełnienie wiersza pozostaje zerowe
+        if (static_cast<ScalarType>(header.scalar) == ScalarType::Float32) {
+            float* f = reinterpret_cast<float*>(rowBuffer.data());
+            for (std::size_t j = 0; j < row.size(); j++) f[j] = static_cast<float>(row[j]);
+        } else {
+            std::memcpy(rowBuffer.data(), row.data(), row.size() * sizeof(double));
+        }
+        writeBytes(out, rowBuffer.data(), rowBuffer.size());
+        written++;
+    }
+
+    void MatrixFileWriter::writeRows(ConstMatrixView block) {
+        for (std::size_t i = 0; i < block.rows(); i++) {
+            writeRow(Span<const double>(block.row(i), block.cols()));
+        }
+    }
+
+    void MatrixFileWriter::close() {
+        if (!out.is_open()) return;
+        if (written != header.rows) {
+            out.close();
+            throw std::runtime_error("Zapisano mniej wierszy niż zadeklarowano w nagłówku");
+        }
+        out.close();
+        if (out.fail()) {
+            throw std::runtime_error("Błąd zapisu pliku macierzy");
+        }
+    }
+
+    void writeMatrixFile(const std::string& path, ConstMatrixView A, ScalarType scalar) {
+        MatrixFileWriter writer(path, A.rows(), A.cols(), scalar);
+        writer.writeRows(A);
+        writer.close();
+    }
+
+    void writeVectorFile(const std::string& path, Span<const double> v, ScalarType scalar) {
+        MatrixFileHeader header = makeHeader(MatrixFileLayout::Vector, scalar, MATRIX_ALIGNMENT, v.size(), 1);
+        std::ofstream out = openForWriting(path);
+        writeBytes(out, &header, sizeof(header));
+        padTo(out, sections(header).data);
+        std::vector<char> buffer;
+        writeScalars(out, v.data(), v.size(), scalar, buffer);
+    }
+
+    void writeMatrixFile(const std::string& path, const SparseMatrix& A) {
+        MatrixFileHeader header = makeHeader(MatrixFileLayout::SparseCSR, ScalarType::Float64,
+                                             MATRIX_ALIGNMENT, A.rows(), A.cols());
+        header.nnz = A.nnz();
+        Sections s = sections(header);
+        std::ofstream out = openForWriting(path);
+        writeBytes(out, &header, sizeof(header));
+        padTo(out, s.data);
+        writeBytes(out, A.rowPointers().data(), A.rowPointers().size() * sizeof(std::size_t));
+        padTo(out, s.indices);
+        writeBytes(out, A.columnIndices().data(), A.nnz() * sizeof(int));
+        padTo(out, s.values);
+        writeBytes(out, A.values().data(), A.nnz() * sizeof(double));
+    }
+
+} // namespace numlib
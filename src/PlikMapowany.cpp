@@ -0,0 +1,102 @@
+#include "../include/numlib/PlikMapowany.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace numlib {
+
+    namespace {
+        std::runtime_error fileError(const std::string& what, const std::string& path) {
+            return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+        }
+    }
+
+    MappedFile::MappedFile(const std::string& path, Mode mode, std::size_t size) {
+        bool readOnlyFile = mode == Mode::ReadOnly || mode == Mode::CopyOnWrite;
+        int flags = readOnlyFile ? O_RDONLY : O_RDWR;
+        if (mode == Mode::Create) flags |= O_CREAT | O_TRUNC;
+        fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0) {
+            throw fileError("Nie można otworzyć pliku", path);
+        }
+
+        if (mode == Mode::Create) {
+            // Plik rzadki - miejsce na dysku zajmowane jest dopiero przy zapisie
+            if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                std::runtime_error error = fileError("Nie można zmienić rozmiaru pliku", path);
+                release();
+                throw error;
+            }
+            length = size;
+        } else {
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+                std::runtime_error error = fileError("Nie można odczytać rozmiaru pliku", path);
+                release();
+                throw error;
+            }
+            length = static_cast<std::size_t>(st.st_size);
+        }
+
+        if (length > 0) {
+            int prot = mode == Mode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+            int share = mode == Mode::CopyOnWrite ? MAP_PRIVATE : MAP_SHARED;
+            void* p = ::mmap(nullptr, length, prot, share, fd, 0);
+            if (p == MAP_FAILED) {
+                std::runtime_error error = fileError("Nie można odwzorować pliku", path);
+                release();
+                throw error;
+            }
+            base = p;
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : base(std::exchange(other.base, nullptr)),
+          length(std::exchange(other.length, 0)),
+          fd(std::exchange(other.fd, -1)) {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            base = std::exchange(other.base, nullptr);
+            length = std::exchange(other.length, 0);
+            fd = std::exchange(other.fd, -1);
+        }
+        return *this;
+    }
+
+    void MappedFile::release() {
+        if (base) ::munmap(base, length);
+        if (fd >= 0) ::close(fd);
+        base = nullptr;
+        length = 0;
+        fd = -1;
+    }
+
+    void MappedFile::prefetch(std::size_t offset, std::size_t bytes) const {
+        if (!base || offset >= length) return;
+        bytes = std::min(bytes, length - offset);
+        // madvise wymaga adresu wyrównanego do strony
+        std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        std::size_t start = offset / page * page;
+        ::madvise(static_cast<char*>(base) + start, bytes + (offset - start), MADV_WILLNEED);
+    }
+
+    void MappedFile::flush() const {
+        if (base && ::msync(base, length, MS_SYNC) != 0) {
+            throw std::runtime_error(std::string("Nie można zapisać pliku: ") + std::strerror(errno));
+        }
+    }
+
+} // namespace numlib
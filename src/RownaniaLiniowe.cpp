@@ -1,4 +1,10 @@
 ﻿#include "../include/numlib/RownaniaLiniowe.h"
+#include <stdexcept>
+#include <cmath>
+#include <limits>
+#include "../include/numlib/Watki.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/MnozenieMacierzy.h"
 
 namespace numlib {
     void printMatrix(vector<vector<double>>& A, vector<double>& b) {
@@ -13,88 +19,637 @@ namespace numlib {
         cout << "-----------------------------" << endl;
     }
 
-    vector<double> Gauss(vector<vector<double>>& Mat, vector<double>& B) {
-        int n = B.size();
-        vector<vector<double>> A(Mat);
-        vector<double> b(B);
-
-        cout << "Macierz początkowa:" << endl;
-        printMatrix(A, b);
-
-        // Etap 1: Eliminacja współczynników (eliminacja w przód)
-        for (int k = 0; k < n - 1; k++) {
-            // Wybór elementu głównego (pivot)
-            int pivot_row = k;
-            double pivot_value = abs(A[k][k]);
-
-            for (int i = k + 1; i < n; i++) {
-                if (abs(A[i][k]) > pivot_value) {
-                    pivot_value = abs(A[i][k]);
-                    pivot_row = i;
+    namespace {
+        const double PIVOT_TOLERANCE = 1e-10;
+
+        // Jądra dla double i float korzystają z wersji SIMD wybranej przy starcie programu
+        void kernelAxpy(size_t n, double a, const double* x, double* y) {
+            simd::axpy(n, a, x, y);
+        }
+
+        void kernelAxpy(size_t n, float a, const float* x, float* y) {
+            simd::axpy(n, a, x, y);
+        }
+
+        void kernelRankUpdate(size_t m, size_t n, size_t k, const double* L, size_t ldl,
+                              const double* U, size_t ldu, double* C, size_t ldc) {
+            simd::rankUpdate(m, n, k, L, ldl, U, ldu, C, ldc);
+        }
+
+        void kernelRankUpdate(size_t m, size_t n, size_t k, const float* L, size_t ldl,
+                              const float* U, size_t ldu, float* C, size_t ldc) {
+            simd::rankUpdate(m, n, k, L, ldl, U, ldu, C, ldc);
+        }
+
+        // Rozkład panelu (kolumny k..k+nb-1) kolumna po kolumnie.
+        // Zamiany wierszy obejmują całe wiersze, więc od razu trafiają też do
+        // części na prawo od panelu i do wcześniej policzonych kolumn L.
+        template <typename T>
+        void factorPanel(MatrixViewT<T> A, vector<int>& piv, int k, int nb) {
+            int n = A.rows();
+            for (int c = k; c < k + nb; c++) {
+                int p = c;
+                T best = abs(A(c, c));
+                for (int i = c + 1; i < n; i++) {
+                    if (abs(A(i, c)) > best) {
+                        best = abs(A(i, c));
+                        p = i;
+                    }
+                }
+                piv[c] = p;
+                if (p != c) {
+                    swap_ranges(A.row(c), A.row(c) + n, A.row(p));
+                }
+                if (best < PIVOT_TOLERANCE) {
+                    throw runtime_error("Macierz osobliwa - brak rozwiązania");
+                }
+
+                const T* pivot = A.row(c);
+                for (int i = c + 1; i < n; i++) {
+                    T* row = A.row(i);
+                    T factor = row[c] / pivot[c];
+                    row[c] = factor;
+                    kernelAxpy(k + nb - c - 1, -factor, pivot + c + 1, row + c + 1);
                 }
             }
+        }
 
-            // Zamiana wierszy jeśli znaleziono lepszy element główny
-            if (pivot_row != k) {
-                for (int j = k; j < n; j++) {
-                    swap(A[k][j], A[pivot_row][j]);
+        const int TILE_ROWS = 64;
+        const int TILE_COLS = 256;
+
+        int tileCount(int length, int tile) {
+            return length <= 0 ? 0 : (length + tile - 1) / tile;
+        }
+
+        // U12 = L11^-1 * A12 dla wierszy panelu; paski kolumn są niezależne
+        template <typename T>
+        void solveU12(MatrixViewT<T> A, int k, int nb) {
+            int n = A.cols();
+            int first = k + nb;
+            parallelFor(tileCount(n - first, TILE_COLS), [&](int t) {
+                int j0 = first + t * TILE_COLS;
+                int j1 = min(n, j0 + TILE_COLS);
+                for (int r = k + 1; r < k + nb; r++) {
+                    kernelRankUpdate(1, j1 - j0, r - k, A.row(r) + k, A.stride(),
+                                     A.row(k) + j0, A.stride(), A.row(r) + j0, A.stride());
                 }
-                swap(b[k], b[pivot_row]);
+            });
+        }
+
+        // A22 -= L21 * U12 podzielone na kafelki TILE_ROWS x TILE_COLS.
+        // Każdy kafelek liczy dokładnie jeden wątek w ustalonej kolejności
+        // działań, więc wynik nie zależy od liczby wątków. Fragment U12
+        // potrzebny kafelkowi pozostaje w cache przez wszystkie jego wiersze.
+        template <typename T>
+        void updateTrailing(MatrixViewT<T> A, int k, int nb) {
+            int n = A.rows();
+            int first = k + nb;
+            int colTiles = tileCount(n - first, TILE_COLS);
+            int rowTiles = tileCount(n - first, TILE_ROWS);
+            parallelFor(rowTiles * colTiles, [&](int t) {
+                int i0 = first + (t / colTiles) * TILE_ROWS;
+                int i1 = min(n, i0 + TILE_ROWS);
+                int j0 = first + (t % colTiles) * TILE_COLS;
+                int j1 = min(n, j0 + TILE_COLS);
+                kernelRankUpdate(i1 - i0, j1 - j0, nb, A.row(i0) + k, A.stride(),
+                                 A.row(k) + j0, A.stride(), A.row(i0) + j0, A.stride());
+            });
+        }
+
+        // Dla double aktualizację wykonuje gemm z pakowaniem paneli
+        void updateTrailing(MatrixView A, int k, int nb) {
+            int rest = A.rows() - k - nb;
+            if (rest <= 0) return;
+            gemm(Op::None, Op::None, -1.0, A.block(k + nb, k, rest, nb), A.block(k, k + nb, nb, rest),
+                 1.0, A.block(k + nb, k + nb, rest, rest));
+        }
+
+        template <typename T>
+        void luFactorBlocked(MatrixViewT<T> A, vector<int>& piv, int blockSize) {
+            if (A.rows() != A.cols()) {
+                throw invalid_argument("Macierz musi być kwadratowa");
+            }
+            if (blockSize <= 0) {
+                throw invalid_argument("Rozmiar bloku musi być dodatni");
+            }
+            int n = A.rows();
+            piv.assign(n, 0);
+            for (int k = 0; k < n; k += blockSize) {
+                int nb = min(blockSize, n - k);
+                factorPanel(A, piv, k, nb);
+                solveU12(A, k, nb);
+                updateTrailing(A, k, nb);
             }
+        }
 
-            // Sprawdzenie osobliwości macierzy
-            if (abs(A[k][k]) < 1e-10) {
-                cout << "Macierz osobliwa - brak rozwiązania" << endl;
-                return vector<double>(n, 0.0);
+        void luSolveInPlace(ConstMatrixView LU, const vector<int>& piv, Span<double> b) {
+            int n = LU.rows();
+            if (b.size() != LU.rows()) {
+                throw invalid_argument("Nieprawidłowe wymiary macierzy");
+            }
+            for (int k = 0; k < n; k++) {
+                if (piv[k] != k) swap(b[k], b[piv[k]]);
+            }
+            // Podstawianie w przód (L ma jedynki na przekątnej)
+            for (int i = 1; i < n; i++) {
+                b[i] -= simd::dot(i, LU.row(i), b.data());
             }
+            // Podstawianie wsteczne
+            for (int i = n - 1; i >= 0; i--) {
+                const double* row = LU.row(i);
+                double sum = simd::dot(n - i - 1, row + i + 1, b.data() + i + 1);
+                b[i] = (b[i] - sum) / row[i];
+            }
+        }
+    }
+
+    void luFactorInPlace(MatrixView A, vector<int>& piv, int blockSize) {
+        luFactorBlocked(A, piv, blockSize);
+    }
+
+    void GaussSolveInPlace(MatrixView A, Span<double> b) {
+        if (A.rows() != b.size() || A.cols() != b.size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        vector<int> piv;
+        luFactorInPlace(A, piv);
+        luSolveInPlace(A, piv, b);
+    }
+
+    LU::LU(ConstMatrixView A, int blockSize) : lu(Matrix::copyOf(A)) {
+        luFactorInPlace(lu.view(), piv, blockSize);
+    }
+
+    LU::LU(Matrix&& A, int blockSize) : lu(std::move(A)) {
+        luFactorInPlace(lu.view(), piv, blockSize);
+    }
 
-            // Eliminacja współczynników w kolumnie
-            for (int i = k + 1; i < n; i++) {
-                double factor = A[i][k] / A[k][k];  // Mnożnik eliminacyjny
+    void LU::solveInPlace(Span<double> b) const {
+        luSolveInPlace(lu.view(), piv, b);
+    }
+
+    void LU::solveInPlace(MatrixView B) const {
+        int n = size();
+        int m = B.cols();
+        if (B.rows() != size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        for (int k = 0; k < n; k++) {
+            if (piv[k] != k) swap_ranges(B.row(k), B.row(k) + m, B.row(piv[k]));
+        }
+        if (m == 0) return;
+        trsm(Side::Left, Triangle::Lower, Op::None, Diagonal::Unit, 1.0, lu.view(), B);
+        trsm(Side::Left, Triangle::Upper, Op::None, Diagonal::NonUnit, 1.0, lu.view(), B);
+    }
+
+    vector<double> LU::solve(const vector<double>& b) const {
+        vector<double> x(b);
+        solveInPlace(Span<double>(x));
+        return x;
+    }
+
+    Matrix LU::solve(ConstMatrixView B) const {
+        Matrix X = Matrix::copyOf(B);
+        solveInPlace(X.view());
+        return X;
+    }
+
+    vector<double> GaussSolve(ConstMatrixView A, const vector<double>& b) {
+        Matrix work = Matrix::copyOf(A);
+        vector<double> x(b);
+        GaussSolveInPlace(work.view(), x);
+        return x;
+    }
+
+    vector<double> Gauss(vector<vector<double>>& Mat, vector<double>& B) {
+        int n = B.size();
+        if (Mat.size() != B.size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+
+        Matrix A = Matrix::fromRows(Mat);
+        vector<double> x(B);
+        try {
+            GaussSolveInPlace(A.view(), x);
+        } catch (const runtime_error& e) {
+            cout << e.what() << endl;
+            return vector<double>(n, 0.0);
+        }
+        return x;
+    }
 
-                for (int j = k; j < n; j++) {
-                    A[i][j] -= factor * A[k][j];
+    namespace {
+        // Rozkład bloku przekątnego L11 (kolumny k..k+nb-1), wiersz po wierszu
+        void choleskyDiagonal(MatrixView L, int k, int nb) {
+            for (int i = k; i < k + nb; i++) {
+                double* li = L.row(i);
+                for (int j = k; j < i; j++) {
+                    const double* lj = L.row(j);
+                    li[j] = (li[j] - simd::dot(j - k, li + k, lj + k)) / lj[j];
+                }
+                double d = li[i] - simd::dot(i - k, li + k, li + k);
+                if (!(d > 0.0)) {
+                    throw runtime_error("Macierz nie jest dodatnio określona");
                 }
-                b[i] -= factor * b[k];
+                li[i] = sqrt(d);
             }
+        }
 
-            cout << "Po eliminacji krok " << k + 1 << ":" << endl;
-            printMatrix(A, b);
+        // L21 = A21 * L11^-T; każdy wiersz liczony niezależnie podstawianiem w przód
+        void choleskyPanel(MatrixView L, int k, int nb) {
+            int n = L.rows();
+            int first = k + nb;
+            parallelFor(tileCount(n - first, TILE_ROWS), [&](int t) {
+                int i0 = first + t * TILE_ROWS;
+                int i1 = min(n, i0 + TILE_ROWS);
+                for (int i = i0; i < i1; i++) {
+                    double* li = L.row(i);
+                    for (int j = k; j < k + nb; j++) {
+                        const double* lj = L.row(j);
+                        li[j] = (li[j] - simd::dot(j - k, li + k, lj + k)) / lj[j];
+                    }
+                }
+            });
         }
 
-        // Etap 2: Podstawianie wsteczne
-        vector<double> x(n, 0.0);
+        // A22 -= L21 * L21^T tylko w dolnym trójkącie
+        void choleskyTrailing(MatrixView L, int k, int nb) {
+            int first = k + nb;
+            int m = L.rows() - first;
+            if (m <= 0) return;
+            syrk(Triangle::Lower, Op::None, -1.0, L.block(first, k, m, nb), 1.0, L.block(first, first, m, m));
+        }
+    }
 
-        // Sprawdzenie czy ostatni element na przekątnej nie jest zerem
-        if (abs(A[n - 1][n - 1]) < 1e-10) {
-            cout << "Błąd: Dzielenie przez zero podczas podstawiania wstecznego" << endl;
-            return vector<double>(n, 0.0);
+    void choleskyFactorInPlace(MatrixView A, int blockSize) {
+        if (A.rows() != A.cols()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (blockSize <= 0) {
+            throw invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        int n = A.rows();
+        for (int k = 0; k < n; k += blockSize) {
+            int nb = min(blockSize, n - k);
+            choleskyDiagonal(A, k, nb);
+            choleskyPanel(A, k, nb);
+            choleskyTrailing(A, k, nb);
         }
+    }
 
-        // Obliczenie ostatniej niewiadomej
-        x[n - 1] = b[n - 1] / A[n - 1][n - 1];
-        cout << "x[" << n - 1 << "] = " << x[n - 1] << endl;
+    Cholesky::Cholesky(ConstMatrixView A, int blockSize) : l(Matrix::copyOf(A)) {
+        choleskyFactorInPlace(l.view(), blockSize);
+        int n = l.rows();
+        for (int i = 0; i < n; i++) {
+            fill(l.row(i) + i + 1, l.row(i) + n, 0.0);
+        }
+    }
+
+    void Cholesky::solveInPlace(Span<double> b) const {
+        int n = size();
+        if (b.size() != size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        // L y = b
+        for (int i = 0; i < n; i++) {
+            b[i] = (b[i] - simd::dot(i, l.row(i), b.data())) / l(i, i);
+        }
+        // L^T x = y - kolumna L^T to wiersz L, więc odejmujemy całe wiersze
+        for (int i = n - 1; i >= 0; i--) {
+            b[i] /= l(i, i);
+            simd::axpy(i, -b[i], l.row(i), b.data());
+        }
+    }
 
-        // Obliczenie pozostałych niewiadomych
-        for (int i = n - 2; i >= 0; i--) {
-            double sum = 0.0;
-            for (int j = i + 1; j < n; j++) {
-                sum += A[i][j] * x[j];
+    void Cholesky::solveInPlace(MatrixView B) const {
+        int m = B.cols();
+        if (B.rows() != size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        if (m == 0) return;
+        trsm(Side::Left, Triangle::Lower, Op::None, Diagonal::NonUnit, 1.0, l.view(), B);
+        trsm(Side::Left, Triangle::Lower, Op::Transpose, Diagonal::NonUnit, 1.0, l.view(), B);
+    }
+
+    vector<double> Cholesky::solve(const vector<double>& b) const {
+        vector<double> x(b);
+        solveInPlace(Span<double>(x));
+        return x;
+    }
+
+    Matrix Cholesky::solve(ConstMatrixView B) const {
+        Matrix X = Matrix::copyOf(B);
+        solveInPlace(X.view());
+        return X;
+    }
+
+    namespace {
+        // L L^T + sign * X X^T. Obrót j-tej poprawki w kolumnie q (c, s) wyznaczany
+        // jest w wierszu q, a kolejne wiersze tylko go stosują, więc całość
+        // to jedno przejście przez L wierszami.
+        void choleskyRankUpdate(MatrixView L, MatrixView X, double sign) {
+            int n = L.rows();
+            int k = X.cols();
+            Matrix c(k, n), s(k, n);
+            for (int i = 0; i < n; i++) {
+                double* li = L.row(i);
+                for (int j = 0; j < k; j++) {
+                    double x = X(i, j);
+                    const double* cj = c.row(j);
+                    const double* sj = s.row(j);
+                    for (int q = 0; q < i; q++) {
+                        double l = (li[q] + sign * sj[q] * x) / cj[q];
+                        x = cj[q] * x - sj[q] * l;
+                        li[q] = l;
+                    }
+                    double d = li[i] * li[i] + sign * x * x;
+                    if (!(d > 0.0)) {
+                        throw runtime_error("Macierz po zmianie nie jest dodatnio określona");
+                    }
+                    double r = sqrt(d);
+                    c(j, i) = r / li[i];
+                    s(j, i) = x / li[i];
+                    li[i] = r;
+                }
+            }
+        }
+    }
+
+    void Cholesky::update(Span<const double> v) {
+        update(ConstMatrixView(v.data(), v.size(), 1, 1));
+    }
+
+    void Cholesky::update(ConstMatrixView V) {
+        if (V.rows() != size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        Matrix X = Matrix::copyOf(V);
+        choleskyRankUpdate(l.view(), X.view(), 1.0);
+    }
+
+    void Cholesky::downdate(Span<const double> v) {
+        downdate(ConstMatrixView(v.data(), v.size(), 1, 1));
+    }
+
+    void Cholesky::downdate(ConstMatrixView V) {
+        if (V.rows() != size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        Matrix X = Matrix::copyOf(V);
+        Matrix backup(l);
+        try {
+            choleskyRankUpdate(l.view(), X.view(), -1.0);
+        } catch (const runtime_error&) {
+            l = std::move(backup);
+            throw;
+        }
+    }
+
+    bool isSymmetric(ConstMatrixView A, double tolerance) {
+        if (A.rows() != A.cols()) return false;
+        for (size_t i = 0; i < A.rows(); i++) {
+            for (size_t j = 0; j < i; j++) {
+                double scale = max({ abs(A(i, j)), abs(A(j, i)), 1.0 });
+                if (abs(A(i, j) - A(j, i)) > tolerance * scale) return false;
+            }
+        }
+        return true;
+    }
+
+    vector<double> SolveSPD(ConstMatrixView A, const vector<double>& b) {
+        if (isSymmetric(A)) {
+            try {
+                return Cholesky(A).solve(b);
+            } catch (const runtime_error&) {
+                // Macierz nie jest dodatnio określona - przechodzimy do LU
             }
-            x[i] = (b[i] - sum) / A[i][i];
-            cout << "x[" << i << "] = " << x[i] << endl;
+        }
+        return LU(A).solve(b);
+    }
+
+    namespace {
+        // r = b - Ax; paski wierszy liczone niezależnie na puli wątków
+        void residual(ConstMatrixView A, const vector<double>& x, const vector<double>& b, vector<double>& r) {
+            int n = A.rows();
+            parallelFor(tileCount(n, TILE_ROWS), [&](int t) {
+                int i0 = t * TILE_ROWS;
+                int i1 = min(n, i0 + TILE_ROWS);
+                for (int i = i0; i < i1; i++) {
+                    r[i] = b[i] - simd::dot(n, A.row(i), x.data());
+                }
+            });
+        }
+
+        double normInf(const vector<double>& v) {
+            double m = 0.0;
+            for (double e : v) m = max(m, abs(e));
+            return m;
         }
 
-        // Etap 3: Weryfikacja rozwiązania
-        cout << "\nSprawdzenie rozwiązania:" << endl;
+        double backwardError(double normR, double normA, double normX) {
+            return normX > 0.0 ? normR / (normA * normX) : normR;
+        }
+    }
+
+    MixedLU::MixedLU(ConstMatrixView A, int blockSize) : a(Matrix::copyOf(A)), block(blockSize) {
+        if (A.rows() != A.cols()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (blockSize <= 0) {
+            throw invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        int n = a.rows();
+        bool inRange = true;
         for (int i = 0; i < n; i++) {
-            double check = 0.0;
+            double rowSum = 0.0;
             for (int j = 0; j < n; j++) {
-                check += Mat[i][j] * x[j];
+                double v = abs(a(i, j));
+                rowSum += v;
+                if (v > numeric_limits<float>::max()) inRange = false;
             }
-            cout << "Równanie " << i << ": " << check << " = " << B[i] << endl;
+            normA = max(normA, rowSum);
         }
 
+        if (inRange) {
+            lu = MatrixF::copyOf(a.view());
+            try {
+                luFactorBlocked(lu.view(), piv, block);
+                single = true;
+            } catch (const runtime_error&) {
+                // Element główny znikł w pojedynczej precyzji - zostaje rozkład w double
+            }
+        }
+        if (!single) {
+            lu = MatrixF();
+            fallbackLU.reset(new LU(a.view(), block));
+        }
+    }
+
+    void MixedLU::solveSingle(vector<float>& b) const {
+        int n = size();
+        for (int k = 0; k < n; k++) {
+            if (piv[k] != k) swap(b[k], b[piv[k]]);
+        }
+        for (int i = 1; i < n; i++) {
+            const float* row = lu.row(i);
+            float sum = 0.0f;
+            for (int j = 0; j < i; j++) sum += row[j] * b[j];
+            b[i] -= sum;
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            const float* row = lu.row(i);
+            float sum = 0.0f;
+            for (int j = i + 1; j < n; j++) sum += row[j] * b[j];
+            b[i] = (b[i] - sum) / row[i];
+        }
+    }
+
+    RefinementResult MixedLU::solve(const vector<double>& b, int maxIterations) {
+        int n = size();
+        if (b.size() != size()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        RefinementResult result{ vector<double>(n, 0.0), 0, 0.0, false };
+        vector<double> r(n);
+
+        if (single) {
+            const double target = numeric_limits<double>::epsilon() * sqrt(static_cast<double>(max(n, 1)));
+            vector<float> d(n);
+            // Pierwsze rozwiązanie to poprawka względem x = 0, czyli r = b
+            r = b;
+            double normR = normInf(r);
+            double previous = numeric_limits<double>::infinity();
+            while (true) {
+                // Residuum skalowane do jedności, aby nie wyjść poza zakres float
+                double scale = normR > 0.0 ? normR : 1.0;
+                for (int i = 0; i < n; i++) d[i] = static_cast<float>(r[i] / scale);
+                solveSingle(d);
+                for (int i = 0; i < n; i++) result.x[i] += scale * d[i];
+
+                residual(a.view(), result.x, b, r);
+                previous = normR;
+                normR = normInf(r);
+                result.residual = backwardError(normR, normA, normInf(result.x));
+                if (result.residual <= target) return result;
+                // Poprawianie stoi w miejscu (lub pojawił się NaN) - przechodzimy do double
+                if (!(normR < 0.5 * previous) || result.iterations >= maxIterations) break;
+                result.iterations++;
+            }
+        }
+
+        if (!fallbackLU) {
+            fallbackLU.reset(new LU(a.view(), block));
+        }
+        result.x = fallbackLU->solve(b);
+        result.fallback = true;
+        residual(a.view(), result.x, b, r);
+        result.residual = backwardError(normInf(r), normA, normInf(result.x));
+        return result;
+    }
+
+    RefinementResult MixedPrecisionSolve(ConstMatrixView A, const vector<double>& b) {
+        return MixedLU(A).solve(b);
+    }
+
+    WoodburyLU::WoodburyLU(ConstMatrixView A, int maxRank)
+        : a(Matrix::copyOf(A)), base(A), maxRank(maxRank) {
+        if (maxRank < 0) {
+            throw invalid_argument("Maksymalny rząd poprawek nie może być ujemny");
+        }
+        z = Matrix(size(), maxRank);
+        v = Matrix(size(), maxRank);
+        cap = Matrix(maxRank, maxRank);
+    }
+
+    void WoodburyLU::rebuild(Matrix&& updated) {
+        LU fresh(updated.view());
+        a = std::move(updated);
+        base = std::move(fresh);
+        r = 0;
+    }
+
+    void WoodburyLU::refactor() {
+        rebuild(Matrix(a));
+    }
+
+    void WoodburyLU::update(ConstMatrixView U, ConstMatrixView V) {
+        size_t n = size();
+        if (U.rows() != n || V.rows() != n || U.cols() != V.cols()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        int k = U.cols();
+        if (k == 0) return;
+        Matrix updated(a);
+        gemm(Op::None, Op::Transpose, 1.0, U, V, 1.0, updated.view());
+        if (r + k > maxRank) {
+            rebuild(std::move(updated));
+            return;
+        }
+
+        // Nowe kolumny Z = A0^-1 U i V; C rozszerzana o nowe wiersze i kolumny
+        int total = r + k;
+        Matrix Znew = base.solve(U);
+        for (size_t i = 0; i < n; i++) {
+            copy(Znew.row(i), Znew.row(i) + k, z.row(i) + r);
+            for (int j = 0; j < k; j++) v(i, r + j) = V(i, j);
+        }
+        ConstMatrixView Zall = z.block(0, 0, n, total), Vall = v.block(0, 0, n, total);
+        gemm(Op::Transpose, Op::None, 1.0, Vall, z.block(0, r, n, k), 0.0, cap.block(0, r, total, k));
+        gemm(Op::Transpose, Op::None, 1.0, v.block(0, r, n, k), Zall.block(0, 0, n, r), 0.0, cap.block(r, 0, k, r));
+        for (int j = r; j < total; j++) cap(j, j) += 1.0;
+
+        Matrix factored = Matrix::copyOf(cap.block(0, 0, total, total));
+        vector<int> piv;
+        try {
+            luFactorInPlace(factored.view(), piv);
+        } catch (const runtime_error&) {
+            // C osobliwa lub prawie osobliwa - wzór jest niestabilny, rozkładamy od nowa
+            // (jeśli i to się nie uda, nowa macierz jest osobliwa i obiekt zostaje bez zmian)
+            rebuild(std::move(updated));
+            return;
+        }
+        a = std::move(updated);
+        capLU = std::move(factored);
+        capPiv = std::move(piv);
+        r = total;
+    }
+
+    void WoodburyLU::update(Span<const double> u, Span<const double> v) {
+        update(ConstMatrixView(u.data(), u.size(), 1, 1), ConstMatrixView(v.data(), v.size(), 1, 1));
+    }
+
+    void WoodburyLU::updateRow(size_t i, Span<const double> delta) {
+        if (i >= size()) {
+            throw out_of_range("Indeks poza macierzą");
+        }
+        vector<double> e(size(), 0.0);
+        e[i] = 1.0;
+        update(Span<const double>(e), delta);
+    }
+
+    void WoodburyLU::updateColumn(size_t j, Span<const double> delta) {
+        if (j >= size()) {
+            throw out_of_range("Indeks poza macierzą");
+        }
+        vector<double> e(size(), 0.0);
+        e[j] = 1.0;
+        update(delta, Span<const double>(e));
+    }
+
+    void WoodburyLU::solveInPlace(Span<double> b) const {
+        base.solveInPlace(b);
+        if (r == 0) return;
+        // t = C^-1 V^T y, x = y - Z t
+        size_t n = size();
+        vector<double> t(r, 0.0);
+        for (size_t i = 0; i < n; i++) simd::axpy(r, b[i], v.row(i), t.data());
+        luSolveInPlace(capLU.view(), capPiv, Span<double>(t));
+        for (size_t i = 0; i < n; i++) b[i] -= simd::dot(r, z.row(i), t.data());
+    }
+
+    vector<double> WoodburyLU::solve(const vector<double>& b) const {
+        vector<double> x(b);
+        solveInPlace(Span<double>(x));
         return x;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,406 @@
+#include "../include/numlib/RozkladQR.h"
+#include "../include/numlib/Watki.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+
+        // Liczba wierszy w pasku przetwarzanym przez jedno zadanie puli wątków.
+        // Podział zależy tylko od m, a sumy częściowe pasków dodawane są w stałej
+        // kolejności, więc wynik nie zależy od liczby wątków.
+        constexpr std::size_t STRIPE_ROWS = 1024;
+
+        // Liczba wierszy, dla których V^T jest przepisywane do bufora naraz
+        constexpr std::size_t PACK_ROWS = 128;
+
+        int stripeCount(std::size_t first, std::size_t last) {
+            return last <= first ? 0 : static_cast<int>((last - first + STRIPE_ROWS - 1) / STRIPE_ROWS);
+        }
+
+        /*
+            Wiersz i macierzy V bloku zaczynającego się w kolumnie k (szerokość nb):
+            dla i >= k + nb to po prostu qr(i, k..k+nb-1), a w trójkącie k..k+nb-1
+            nad przekątną leży R, więc wiersz jest składany jawnie (jedynka na
+            przekątnej, zera nad nią).
+        */
+        void triangleRow(const Matrix& qr, std::size_t k, std::size_t nb, std::size_t i, double* v) {
+            std::size_t d = i - k;
+            for (std::size_t j = 0; j < nb; ++j) {
+                v[j] = j < d ? qr(i, k + j) : (j == d ? 1.0 : 0.0);
+            }
+        }
+    }
+
+    QR::QR(ConstMatrixView A, bool columnPivoting, int blockSize)
+        : QR(Matrix::copyOf(A), columnPivoting, blockSize) {}
+
+    QR::QR(Matrix&& A, bool columnPivoting, int blockSize)
+        : qr(std::move(A)), block(blockSize), pivoting(columnPivoting) {
+        if (qr.rows() < qr.cols()) {
+            throw std::invalid_argument("Macierz musi mieć co najmniej tyle wierszy co kolumn");
+        }
+        if (blockSize <= 0) {
+            throw std::invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        std::size_t n = qr.cols();
+        tau.assign(n, 0.0);
+        perm.resize(n);
+        for (std::size_t j = 0; j < n; ++j) perm[j] = static_cast<int>(j);
+        t = Matrix(n, std::min<std::size_t>(block, std::max<std::size_t>(n, 1)));
+
+        if (pivoting) {
+            factorPivoted();
+        } else {
+            factorBlocked();
+        }
+    }
+
+    namespace {
+        /*
+            Odbicie Householdera zerujące kolumnę c pod przekątną, zastosowane do
+            kolumn c+1 .. colEnd-1. Dwa przebiegi po wierszach c+1 .. m-1:
+            pierwszy (odczyt) liczy normę kolumny c i iloczyny s_j = sum A(i,c) A(i,j),
+            drugi skaluje v i aktualizuje kolumny. Zwraca tau.
+        */
+        double householderStep(Matrix& qr, std::size_t c, std::size_t colEnd, std::vector<double>& partial) {
+            std::size_t m = qr.rows();
+            std::size_t width = colEnd - c - 1;
+            std::size_t first = c + 1;
+            int stripes = stripeCount(first, m);
+
+            // Przebieg 1: [||x||^2, s_{c+1}, ..., s_{colEnd-1}] dla każdego paska
+            std::size_t stride = width + 1;
+            partial.assign(static_cast<std::size_t>(stripes) * stride, 0.0);
+            parallelFor(stripes, [&](int s) {
+                std::size_t i0 = first + s * STRIPE_ROWS;
+                std::size_t i1 = std::min(m, i0 + STRIPE_ROWS);
+                double* acc = partial.data() + s * stride;
+                for (std::size_t i = i0; i < i1; ++i) {
+                    const double* row = qr.row(i) + c;
+                    acc[0] += row[0] * row[0];
+                    simd::axpy(width, row[0], row + 1, acc + 1);
+                }
+            });
+            std::vector<double> sum(stride, 0.0);
+            for (int s = 0; s < stripes; ++s) {
+                for (std::size_t j = 0; j < stride; ++j) sum[j] += partial[s * stride + j];
+            }
+
+            double alpha = qr(c, c);
+            double xnorm = std::sqrt(sum[0]);
+            if (xnorm == 0.0) return 0.0;
+
+            double beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+            double tauC = (beta - alpha) / beta;
+            double scale = 1.0 / (alpha - beta);
+            qr(c, c) = beta;
+
+            // w_j = A(c,j) + v^T A(c+1:m, j); wiersz c zmienia się o -tau * w
+            std::vector<double> w(width);
+            double* rowC = qr.row(c) + c + 1;
+            for (std::size_t j = 0; j < width; ++j) {
+                w[j] = tauC * (rowC[j] + scale * sum[j + 1]);
+                rowC[j] -= w[j];
+            }
+
+            // Przebieg 2: v_i = A(i,c) * scale, A(i,j) -= v_i * tau * w_j
+            parallelFor(stripes, [&](int s) {
+                std::size_t i0 = first + s * STRIPE_ROWS;
+                std::size_t i1 = std::min(m, i0 + STRIPE_ROWS);
+                for (std::size_t i = i0; i < i1; ++i) {
+                    double* row = qr.row(i) + c;
+                    row[0] *= scale;
+                    simd::axpy(width, -row[0], w.data(), row + 1);
+                }
+            });
+            return tauC;
+        }
+
+        /*
+            out (nb x width) = V^T * B, gdzie V to wektory bloku k..k+nb-1, a B to
+            kolumny k .. k+width-1 macierzy qr (pierwsze nb kolumn B to dokładne V,
+            więc lewa część out jest macierzą Grama V^T V). Wiersze poniżej trójkąta
+            przetwarzane są paskami: V^T paczki wierszy trafia do bufora, a iloczyn
+            liczy to samo jądro rankUpdate co w LU.
+        */
+        void projectOnto(const Matrix& qr, std::size_t k, std::size_t nb, std::size_t width, Matrix& out) {
+            std::size_t m = qr.rows();
+            out = Matrix(nb, width);
+
+            std::vector<double> v(nb);
+            for (std::size_t i = k; i < k + nb; ++i) {
+                triangleRow(qr, k, nb, i, v.data());
+                const double* row = qr.row(i) + k;
+                for (std::size_t p = 0; p < nb; ++p) {
+                    if (v[p] == 0.0) continue;
+                    double* o = out.row(p);
+                    for (std::size_t j = 0; j < width; ++j) {
+                        o[j] += v[p] * (j < nb ? v[j] : row[j]);
+                    }
+                }
+            }
+
+            std::size_t first = k + nb;
+            int stripes = stripeCount(first, m);
+            std::vector<Matrix> partial(stripes);
+            parallelFor(stripes, [&](int s) {
+                std::size_t i0 = first + s * STRIPE_ROWS;
+                std::size_t i1 = std::min(m, i0 + STRIPE_ROWS);
+                Matrix acc(nb, width);
+                Matrix packed(nb, PACK_ROWS);
+                for (std::size_t p0 = i0; p0 < i1; p0 += PACK_ROWS) {
+                    std::size_t rows = std::min(PACK_ROWS, i1 - p0);
+                    for (std::size_t r = 0; r < rows; ++r) {
+                        const double* row = qr.row(p0 + r) + k;
+                        for (std::size_t p = 0; p < nb; ++p) packed(p, r) = row[p];
+                    }
+                    // acc -= V^T B, znak odwracany przy sumowaniu pasków
+                    simd::rankUpdate(nb, width, rows, packed.data(), packed.stride(),
+                                     qr.row(p0) + k, qr.stride(), acc.data(), acc.stride());
+                }
+                partial[s] = std::move(acc);
+            });
+            for (int s = 0; s < stripes; ++s) {
+                for (std::size_t p = 0; p < nb; ++p) {
+                    simd::axpy(width, -1.0, partial[s].row(p), out.row(p));
+                }
+            }
+        }
+
+        // T(0:i, i) = -tau_i * T(0:i, 0:i) * G(0:i, i), T(i, i) = tau_i (xLARFT)
+        void formT(const Matrix& gram, const double* tauBlock, std::size_t nb, double* T, std::size_t ldt) {
+            std::vector<double> z(nb);
+            for (std::size_t i = 0; i < nb; ++i) {
+                for (std::size_t j = 0; j < i; ++j) {
+                    double s = 0.0;
+                    for (std::size_t p = j; p < i; ++p) s += T[j * ldt + p] * gram(p, i);
+                    z[j] = -tauBlock[i] * s;
+                }
+                for (std::size_t j = 0; j < i; ++j) T[j * ldt + i] = z[j];
+                T[i * ldt + i] = tauBlock[i];
+                for (std::size_t j = i + 1; j < nb; ++j) T[j * ldt + i] = 0.0;
+            }
+        }
+    }
+
+    void QR::buildT(std::size_t k, std::size_t nb) {
+        Matrix gram;
+        projectOnto(qr, k, nb, nb, gram);
+        formT(gram, tau.data() + k, nb, t.row(k), t.stride());
+    }
+
+    void QR::factorBlocked() {
+        std::size_t m = qr.rows();
+        std::size_t n = qr.cols();
+        std::vector<double> partial;
+        Matrix proj, w2;
+
+        for (std::size_t k = 0; k < n; k += block) {
+            std::size_t nb = std::min<std::size_t>(block, n - k);
+            for (std::size_t c = k; c < k + nb; ++c) {
+                tau[c] = householderStep(qr, c, k + nb, partial);
+            }
+
+            // Gram V^T V i V^T A2 w jednym przebiegu, następnie T
+            std::size_t rest = n - k - nb;
+            projectOnto(qr, k, nb, nb + rest, proj);
+            formT(proj, tau.data() + k, nb, t.row(k), t.stride());
+            if (rest == 0) continue;
+
+            // W2 = T^T (V^T A2)
+            w2 = Matrix(nb, rest);
+            const double* T = t.row(k);
+            std::size_t ldt = t.stride();
+            for (std::size_t i = 0; i < nb; ++i) {
+                for (std::size_t p = 0; p <= i; ++p) {
+                    simd::axpy(rest, T[p * ldt + i], proj.row(p) + nb, w2.row(i));
+                }
+            }
+
+            // A2 -= V W2: trójkąt jawnie, pozostałe wiersze paskami jądrem rankUpdate
+            std::vector<double> v(nb);
+            for (std::size_t i = k; i < k + nb; ++i) {
+                triangleRow(qr, k, nb, i, v.data());
+                double* a2 = qr.row(i) + k + nb;
+                for (std::size_t p = 0; p < nb; ++p) {
+                    if (v[p] != 0.0) simd::axpy(rest, -v[p], w2.row(p), a2);
+                }
+            }
+            std::size_t first = k + nb;
+            parallelFor(stripeCount(first, m), [&](int s) {
+                std::size_t i0 = first + s * STRIPE_ROWS;
+                std::size_t i1 = std::min(m, i0 + STRIPE_ROWS);
+                simd::rankUpdate(i1 - i0, rest, nb, qr.row(i0) + k, qr.stride(),
+                                 w2.data(), w2.stride(), qr.row(i0) + k + nb, qr.stride());
+            });
+        }
+    }
+
+    void QR::factorPivoted() {
+        std::size_t m = qr.rows();
+        std::size_t n = qr.cols();
+        std::vector<double> partial;
+
+        // Normy kolumn (jeden przebieg po wierszach) i ich kopie do kontroli utraty dokładności
+        std::vector<double> norms(n, 0.0);
+        for (std::size_t i = 0; i < m; ++i) {
+            const double* row = qr.row(i);
+            for (std::size_t j = 0; j < n; ++j) norms[j] += row[j] * row[j];
+        }
+        for (double& v : norms) v = std::sqrt(v);
+        std::vector<double> reference(norms);
+        const double tol3z = std::sqrt(std::numeric_limits<double>::epsilon());
+
+        for (std::size_t c = 0; c < n; ++c) {
+            std::size_t p = c;
+            for (std::size_t j = c + 1; j < n; ++j) {
+                if (norms[j] > norms[p]) p = j;
+            }
+            if (p != c) {
+                for (std::size_t i = 0; i < m; ++i) std::swap(qr(i, c), qr(i, p));
+                std::swap(norms[c], norms[p]);
+                std::swap(reference[c], reference[p]);
+                std::swap(perm[c], perm[p]);
+            }
+
+            tau[c] = householderStep(qr, c, n, partial);
+
+            // Aktualizacja norm pozostałych kolumn (xGEQPF); przy dużej utracie
+            // cyfr znaczących norma liczona jest od nowa
+            for (std::size_t j = c + 1; j < n; ++j) {
+                if (norms[j] == 0.0) continue;
+                double ratio = std::abs(qr(c, j)) / norms[j];
+                double temp = std::max(0.0, (1.0 + ratio) * (1.0 - ratio));
+                double temp2 = temp * (norms[j] / reference[j]) * (norms[j] / reference[j]);
+                if (temp2 <= tol3z) {
+                    double s = 0.0;
+                    for (std::size_t i = c + 1; i < m; ++i) s += qr(i, j) * qr(i, j);
+                    norms[j] = std::sqrt(s);
+                    reference[j] = norms[j];
+                } else {
+                    norms[j] *= std::sqrt(temp);
+                }
+            }
+        }
+
+        for (std::size_t k = 0; k < n; k += block) {
+            buildT(k, std::min<std::size_t>(block, n - k));
+        }
+    }
+
+    Matrix QR::R() const {
+        std::size_t n = cols();
+        Matrix r(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            std::copy(qr.row(i) + i, qr.row(i) + n, r.row(i) + i);
+        }
+        return r;
+    }
+
+    int QR::rank(double tolerance) const {
+        std::size_t n = cols();
+        if (n == 0) return 0;
+        if (tolerance < 0.0) {
+            tolerance = std::max(rows(), cols()) * std::numeric_limits<double>::epsilon();
+        }
+        double r0 = std::abs(qr(0, 0));
+        int r = 0;
+        while (static_cast<std::size_t>(r) < n && std::abs(qr(r, r)) > tolerance * r0) ++r;
+        return r;
+    }
+
+    namespace {
+        // b := (I - V op(T) V^T) b dla bloku k..k+nb-1; op(T) = T^T gdy transpose
+        void applyBlock(const Matrix& qr, const Matrix& t, std::size_t k, std::size_t nb,
+                        Span<double> b, bool transpose) {
+            std::size_t m = qr.rows();
+            std::vector<double> v(nb), w(nb, 0.0), tw(nb, 0.0);
+            for (std::size_t i = k; i < k + nb; ++i) {
+                triangleRow(qr, k, nb, i, v.data());
+                simd::axpy(nb, b[i], v.data(), w.data());
+            }
+            for (std::size_t i = k + nb; i < m; ++i) {
+                simd::axpy(nb, b[i], qr.row(i) + k, w.data());
+            }
+
+            const double* T = t.row(k);
+            std::size_t ldt = t.stride();
+            for (std::size_t i = 0; i < nb; ++i) {
+                double s = 0.0;
+                if (transpose) {
+                    for (std::size_t p = 0; p <= i; ++p) s += T[p * ldt + i] * w[p];
+                } else {
+                    for (std::size_t p = i; p < nb; ++p) s += T[i * ldt + p] * w[p];
+                }
+                tw[i] = s;
+            }
+
+            for (std::size_t i = k; i < k + nb; ++i) {
+                triangleRow(qr, k, nb, i, v.data());
+                b[i] -= simd::dot(nb, v.data(), tw.data());
+            }
+            for (std::size_t i = k + nb; i < m; ++i) {
+                b[i] -= simd::dot(nb, qr.row(i) + k, tw.data());
+            }
+        }
+    }
+
+    void QR::applyQT(Span<double> b) const {
+        if (b.size() != rows()) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        std::size_t n = cols();
+        for (std::size_t k = 0; k < n; k += block) {
+            applyBlock(qr, t, k, std::min<std::size_t>(block, n - k), b, true);
+        }
+    }
+
+    void QR::applyQ(Span<double> b) const {
+        if (b.size() != rows()) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        std::size_t n = cols();
+        for (std::size_t blk = (n + block - 1) / block; blk-- > 0;) {
+            std::size_t k = blk * block;
+            applyBlock(qr, t, k, std::min<std::size_t>(block, n - k), b, false);
+        }
+    }
+
+    std::vector<double> QR::solve(const std::vector<double>& b) const {
+        std::size_t n = cols();
+        std::vector<double> c(b);
+        applyQT(Span<double>(c));
+
+        std::size_t r = n;
+        if (pivoting) {
+            r = rank();
+        } else {
+            for (std::size_t j = 0; j < n; ++j) {
+                if (qr(j, j) == 0.0) {
+                    throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+                }
+            }
+        }
+
+        // R(0:r, 0:r) y = (Q^T b)(0:r)
+        std::vector<double> y(n, 0.0);
+        for (std::size_t i = r; i-- > 0;) {
+            const double* row = qr.row(i);
+            y[i] = (c[i] - simd::dot(r - i - 1, row + i + 1, y.data() + i + 1)) / row[i];
+        }
+
+        std::vector<double> x(n);
+        for (std::size_t j = 0; j < n; ++j) x[perm[j]] = y[j];
+        return x;
+    }
+
+    std::vector<double> LeastSquaresQR(ConstMatrixView A, const std::vector<double>& b, bool columnPivoting) {
+        return QR(A, columnPivoting).solve(b);
+    }
+
+} // namespace numlib
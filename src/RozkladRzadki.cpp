@@ -0,0 +1,817 @@
+#include "../include/numlib/RozkladRzadki.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        const std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+        // Iloczyny bloków mniejsze niż tyle mnożeń liczone są pętlami - przy
+        // małych supernodach narzut pakowania w gemm przeważa nad zyskiem
+        const std::size_t GEMM_MIN_WORK = 48 * 48 * 48;
+
+        // Łączenie supernodów: do tej szerokości zawsze, dalej przy ułamku zer
+        // poniżej 0.8, 0.1 i 0.05 (progi jak w CHOLMOD)
+        const std::size_t RELAX_ALWAYS = 4;
+        const std::size_t RELAX_NARROW = 16;
+        const std::size_t RELAX_MEDIUM = 48;
+
+        void checkSquare(const SparseMatrix& A) {
+            if (A.rows() != A.cols()) {
+                throw std::invalid_argument("Macierz musi być kwadratowa");
+            }
+        }
+
+        // Wzorzec A + A^T bez przekątnej w formacie CSR (sąsiedzi posortowani)
+        struct Graph {
+            std::vector<std::size_t> ptr;
+            std::vector<int> adj;
+
+            std::size_t size() const { return ptr.size() - 1; }
+            int degree(int v) const { return static_cast<int>(ptr[v + 1] - ptr[v]); }
+            const int* begin(int v) const { return adj.data() + ptr[v]; }
+            const int* end(int v) const { return adj.data() + ptr[v + 1]; }
+        };
+
+        Graph symmetricGraph(const SparseMatrix& A) {
+            SparseMatrix T = A.transpose();
+            std::size_t n = A.rows();
+            const auto& ap = A.rowPointers();
+            const auto& ai = A.columnIndices();
+            const auto& tp = T.rowPointers();
+            const auto& ti = T.columnIndices();
+            Graph g;
+            g.ptr.assign(n + 1, 0);
+            g.adj.reserve(2 * A.nnz());
+            for (std::size_t i = 0; i < n; ++i) {
+                std::size_t p = ap[i], q = tp[i];
+                while (p < ap[i + 1] || q < tp[i + 1]) {
+                    int j;
+                    if (q == tp[i + 1] || (p < ap[i + 1] && ai[p] < ti[q])) {
+                        j = ai[p++];
+                    } else if (p == ap[i + 1] || ti[q] < ai[p]) {
+                        j = ti[q++];
+                    } else {
+                        j = ai[p++];
+                        ++q;
+                    }
+                    if (j != static_cast<int>(i)) g.adj.push_back(j);
+                }
+                g.ptr[i + 1] = g.adj.size();
+            }
+            return g;
+        }
+
+        std::vector<int> amd(const Graph& g) {
+            enum : char { VARIABLE, ELEMENT, ABSORBED };
+            int n = static_cast<int>(g.size());
+            // Graf ilorazowy: zmienna i ma sąsiadów-zmienne varAdj[i] i sąsiadów-elementy
+            // elemAdj[i]; element e (wyeliminowana zmienna) to klika zmiennych elemVars[e]
+            std::vector<std::vector<int>> varAdj(n), elemAdj(n), elemVars(n);
+            std::vector<char> state(n, VARIABLE);
+            std::vector<int> degree(n), head(n, -1), next(n, -1), prev(n, -1);
+            std::vector<int> mark(n, -1), wMark(n, -1), w(n, 0);
+
+            // Listy zmiennych o tym samym przybliżonym stopniu
+            auto insert = [&](int v) {
+                int d = degree[v];
+                prev[v] = -1;
+                next[v] = head[d];
+                if (head[d] != -1) prev[head[d]] = v;
+                head[d] = v;
+            };
+            auto remove = [&](int v) {
+                if (prev[v] != -1) next[prev[v]] = next[v];
+                else head[degree[v]] = next[v];
+                if (next[v] != -1) prev[next[v]] = prev[v];
+            };
+
+            for (int v = 0; v < n; ++v) {
+                varAdj[v].assign(g.begin(v), g.end(v));
+                degree[v] = g.degree(v);
+                insert(v);
+            }
+
+            std::vector<int> order;
+            order.reserve(n);
+            std::vector<int> Lp;
+            int minDegree = 0;
+            for (int k = 0; k < n; ++k) {
+                while (head[minDegree] == -1) ++minDegree;
+                int p = head[minDegree];
+                remove(p);
+                order.push_back(p);
+                state[p] = ELEMENT;
+
+                // Nowy element L_p: sąsiedzi p bezpośrednio i przez elementy, które pochłania
+                Lp.clear();
+                for (int v : varAdj[p]) {
+                    if (state[v] == VARIABLE && mark[v] != k) {
+                        mark[v] = k;
+                        Lp.push_back(v);
+                    }
+                }
+                for (int e : elemAdj[p]) {
+                    if (state[e] != ELEMENT) continue;
+                    for (int v : elemVars[e]) {
+                        if (v != p && mark[v] != k) {
+                            mark[v] = k;
+                            Lp.push_back(v);
+                        }
+                    }
+                    state[e] = ABSORBED;
+                    std::vector<int>().swap(elemVars[e]);
+                }
+                std::vector<int>().swap(varAdj[p]);
+                std::vector<int>().swap(elemAdj[p]);
+
+                // Pochłonięte elementy zastępuje p, a krawędzie do zmiennych z L_p
+                // są już zawarte w elemencie p
+                for (int i : Lp) {
+                    remove(i);
+                    auto& E = elemAdj[i];
+                    E.erase(std::remove_if(E.begin(), E.end(), [&](int e) { return state[e] != ELEMENT; }), E.end());
+                    E.push_back(p);
+                    auto& V = varAdj[i];
+                    V.erase(std::remove_if(V.begin(), V.end(),
+                                           [&](int v) { return state[v] != VARIABLE || mark[v] == k; }), V.end());
+                }
+
+                // w[e] = |L_e \ L_p| dla elementów sąsiadujących z L_p
+                for (int i : Lp) {
+                    for (int e : elemAdj[i]) {
+                        if (e == p) continue;
+                        if (wMark[e] != k) {
+                            wMark[e] = k;
+                            w[e] = static_cast<int>(elemVars[e].size());
+                        }
+                        --w[e];
+                    }
+                }
+
+                long long external = static_cast<long long>(Lp.size()) - 1;
+                long long remaining = n - k - 1;
+                for (int i : Lp) {
+                    long long d = static_cast<long long>(varAdj[i].size()) + external;
+                    for (int e : elemAdj[i]) {
+                        if (e == p || state[e] != ELEMENT) continue;
+                        if (w[e] == 0) {
+                            // L_e zawarte w L_p - element pochłaniany (agresywnie)
+                            state[e] = ABSORBED;
+                            std::vector<int>().swap(elemVars[e]);
+                        } else {
+                            d += w[e];
+                        }
+                    }
+                    d = std::min({ d, degree[i] + external, remaining - 1 });
+                    degree[i] = static_cast<int>(d);
+                    insert(i);
+                    minDegree = std::min(minDegree, degree[i]);
+                }
+                elemVars[p] = Lp;
+            }
+            return order;
+        }
+
+        // Przeszukiwanie wszerz od root; level musi być -1 na całej składowej.
+        // Zwraca odwiedzone wierzchołki w queue, sąsiedzi dokładani według rosnącego stopnia.
+        void breadthFirst(const Graph& g, int root, std::vector<int>& level, std::vector<int>& queue) {
+            queue.clear();
+            queue.push_back(root);
+            level[root] = 0;
+            std::vector<int> fresh;
+            for (std::size_t head = 0; head < queue.size(); ++head) {
+                int v = queue[head];
+                fresh.clear();
+                for (const int* u = g.begin(v); u != g.end(v); ++u) {
+                    if (level[*u] == -1) {
+                        level[*u] = level[v] + 1;
+                        fresh.push_back(*u);
+                    }
+                }
+                std::stable_sort(fresh.begin(), fresh.end(),
+                                 [&](int a, int b) { return g.degree(a) < g.degree(b); });
+                queue.insert(queue.end(), fresh.begin(), fresh.end());
+            }
+        }
+
+        std::vector<int> rcm(const Graph& g) {
+            int n = static_cast<int>(g.size());
+            std::vector<int> level(n, -1), queue, order;
+            std::vector<char> visited(n, 0);
+            order.reserve(n);
+            for (int start = 0; start < n; ++start) {
+                if (visited[start]) continue;
+                // Wierzchołek pseudoperyferyjny: z ostatniego poziomu BFS wybieramy
+                // wierzchołek o najmniejszym stopniu, dopóki mimośród rośnie
+                int root = start, eccentricity = -1;
+                while (true) {
+                    breadthFirst(g, root, level, queue);
+                    int depth = level[queue.back()];
+                    int candidate = queue.back();
+                    for (int v : queue) {
+                        if (level[v] == depth && g.degree(v) < g.degree(candidate)) candidate = v;
+                    }
+                    for (int v : queue) level[v] = -1;
+                    if (depth <= eccentricity) break;
+                    eccentricity = depth;
+                    root = candidate;
+                }
+                breadthFirst(g, root, level, queue);
+                for (int v : queue) visited[v] = 1;
+                order.insert(order.end(), queue.begin(), queue.end());
+            }
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+
+        // Drzewo eliminacji P S P^T (Liu, z kompresją ścieżek); -1 oznacza korzeń
+        std::vector<int> eliminationTree(const Graph& g, const std::vector<int>& perm, const std::vector<int>& inverse) {
+            int n = static_cast<int>(perm.size());
+            std::vector<int> parent(n, -1), ancestor(n, -1);
+            for (int i = 0; i < n; ++i) {
+                for (const int* u = g.begin(perm[i]); u != g.end(perm[i]); ++u) {
+                    int r = inverse[*u];
+                    if (r >= i) continue;
+                    while (ancestor[r] != -1 && ancestor[r] != i) {
+                        int up = ancestor[r];
+                        ancestor[r] = i;
+                        r = up;
+                    }
+                    if (ancestor[r] == -1) {
+                        ancestor[r] = i;
+                        parent[r] = i;
+                    }
+                }
+            }
+            return parent;
+        }
+
+        // Kolejność postorder lasu: post[k] - węzeł odwiedzony jako k-ty
+        std::vector<int> postorder(const std::vector<int>& parent) {
+            int n = static_cast<int>(parent.size());
+            std::vector<int> head(n, -1), next(n, -1), post, stack;
+            post.reserve(n);
+            for (int j = n - 1; j >= 0; --j) {
+                if (parent[j] == -1) continue;
+                next[j] = head[parent[j]];
+                head[parent[j]] = j;
+            }
+            for (int root = 0; root < n; ++root) {
+                if (parent[root] != -1) continue;
+                stack.push_back(root);
+                while (!stack.empty()) {
+                    int v = stack.back();
+                    int child = head[v];
+                    if (child == -1) {
+                        stack.pop_back();
+                        post.push_back(v);
+                    } else {
+                        head[v] = next[child];
+                        stack.push_back(child);
+                    }
+                }
+            }
+            return post;
+        }
+
+        // Położenie wiersza row (numeracja po permutacji) w panelu supernodu s
+        std::size_t panelRow(const SparseSymbolic& S, int s, int row) {
+            int first = S.supernodeStarts()[s], end = S.supernodeStarts()[s + 1];
+            if (row < end) return row - first;
+            Span<const int> r = S.supernodeRows(s);
+            return (end - first) + (std::lower_bound(r.begin(), r.end(), row) - r.begin());
+        }
+
+        /*
+         * Wiersze supernodu s poniżej bloku przekątnego dzielone są na ciągi
+         * należące do kolejnych supernodów-przodków t; body(t, c0, c1) dostaje
+         * ciąg rows[c0 .. c1-1]. Aktualizacja od s trafia do kolumn t tylko
+         * w wierszach rows[c0 ..] (struktura t je zawiera).
+         */
+        template <typename F>
+        void forEachTarget(const SparseSymbolic& S, int s, F body) {
+            Span<const int> rows = S.supernodeRows(s);
+            std::size_t nr = rows.size();
+            for (std::size_t c0 = 0, c1 = 0; c0 < nr; c0 = c1) {
+                int t = S.supernodeOf(rows[c0]);
+                int end = S.supernodeStarts()[t + 1];
+                c1 = c0;
+                while (c1 < nr && rows[c1] < end) ++c1;
+                body(t, c0, c1);
+            }
+        }
+
+        // rel[r] = położenie wiersza rows[r] supernodu s w panelu t, dla r >= c0 (jedno przejście)
+        void relativeRows(const SparseSymbolic& S, int s, int t, std::size_t c0, std::vector<std::size_t>& rel) {
+            Span<const int> rows = S.supernodeRows(s);
+            Span<const int> target = S.supernodeRows(t);
+            int first = S.supernodeStarts()[t], end = S.supernodeStarts()[t + 1];
+            std::size_t q = 0;
+            for (std::size_t r = c0; r < rows.size(); ++r) {
+                if (rows[r] < end) {
+                    rel[r] = rows[r] - first;
+                } else {
+                    while (target[q] != rows[r]) ++q;
+                    rel[r] = (end - first) + q;
+                }
+            }
+        }
+
+        // Układ paneli (ns + nr) x ns; zwraca rozmiar bufora na największy blok aktualizacji
+        std::size_t layoutPanels(const SparseSymbolic& S, std::vector<std::size_t>& offset) {
+            std::size_t count = S.supernodeCount();
+            offset.assign(count + 1, 0);
+            std::size_t largest = 0;
+            for (std::size_t s = 0; s < count; ++s) {
+                std::size_t ns = S.supernodeStarts()[s + 1] - S.supernodeStarts()[s];
+                std::size_t nr = S.supernodeRows(s).size();
+                offset[s + 1] = offset[s] + (ns + nr) * ns;
+                forEachTarget(S, static_cast<int>(s), [&](int, std::size_t c0, std::size_t c1) {
+                    largest = std::max({ largest, (nr - c0) * (c1 - c0), (c1 - c0) * (nr - c1) });
+                });
+            }
+            return largest;
+        }
+
+        // C = A B^T (transposeB) lub C = A B; małe bloki pętlami, duże przez gemm
+        void product(ConstMatrixView A, ConstMatrixView B, bool transposeB, MatrixView C) {
+            std::size_t k = A.cols();
+            if (C.rows() * C.cols() * k >= GEMM_MIN_WORK) {
+                gemm(Op::None, transposeB ? Op::Transpose : Op::None, 1.0, A, B, 0.0, C);
+                return;
+            }
+            for (std::size_t i = 0; i < C.rows(); ++i) {
+                double* c = C.row(i);
+                if (transposeB) {
+                    for (std::size_t j = 0; j < C.cols(); ++j) c[j] = simd::dot(k, A.row(i), B.row(j));
+                } else {
+                    std::fill(c, c + C.cols(), 0.0);
+                    for (std::size_t p = 0; p < k; ++p) simd::axpy(C.cols(), A(i, p), B.row(p), c);
+                }
+            }
+        }
+
+        // y = P b
+        void permute(const std::vector<int>& perm, Span<const double> b, std::vector<double>& y) {
+            if (b.size() != perm.size()) {
+                throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+            }
+            y.resize(perm.size());
+            for (std::size_t k = 0; k < perm.size(); ++k) y[k] = b[perm[k]];
+        }
+    }
+
+    std::vector<int> approximateMinimumDegree(const SparseMatrix& A) {
+        checkSquare(A);
+        return amd(symmetricGraph(A));
+    }
+
+    std::vector<int> reverseCuthillMcKee(const SparseMatrix& A) {
+        checkSquare(A);
+        return rcm(symmetricGraph(A));
+    }
+
+    SparseSymbolic::SparseSymbolic(const SparseMatrix& A, FillOrdering ordering)
+        : n(A.rows()), method(ordering) {
+        checkSquare(A);
+        patternPtr = A.rowPointers();
+        patternIdx = A.columnIndices();
+        Graph g = symmetricGraph(A);
+
+        switch (ordering) {
+        case FillOrdering::AMD:
+            perm = amd(g);
+            break;
+        case FillOrdering::RCM:
+            perm = rcm(g);
+            break;
+        default:
+            perm.resize(n);
+            std::iota(perm.begin(), perm.end(), 0);
+            break;
+        }
+        inverse.resize(n);
+        for (std::size_t k = 0; k < n; ++k) inverse[perm[k]] = static_cast<int>(k);
+
+        // Postorder drzewa eliminacji: poddrzewa zajmują ciągłe zakresy kolumn,
+        // a łańcuchy rodzic-dziecko stają się kolejnymi kolumnami (supernody)
+        std::vector<int> parent = eliminationTree(g, perm, inverse);
+        std::vector<int> post = postorder(parent);
+        std::vector<int> position(n), reordered(n), relabeled(n);
+        for (std::size_t k = 0; k < n; ++k) position[post[k]] = static_cast<int>(k);
+        for (std::size_t k = 0; k < n; ++k) {
+            reordered[k] = perm[post[k]];
+            relabeled[k] = parent[post[k]] == -1 ? -1 : position[parent[post[k]]];
+        }
+        perm.swap(reordered);
+        parent.swap(relabeled);
+        for (std::size_t k = 0; k < n; ++k) inverse[perm[k]] = static_cast<int>(k);
+
+        // Liczby niezerowych w kolumnach L: wiersz i ma niezerowe w kolumnach
+        // poddrzewa wyznaczonego przez ścieżki od niezerowych A(i, k), k < i
+        std::vector<std::size_t> count(n, 1);
+        std::vector<int> mark(n, -1);
+        for (std::size_t i = 0; i < n; ++i) {
+            mark[i] = static_cast<int>(i);
+            for (const int* u = g.begin(perm[i]); u != g.end(perm[i]); ++u) {
+                int k = inverse[*u];
+                if (k > static_cast<int>(i)) continue;
+                while (mark[k] != static_cast<int>(i)) {
+                    ++count[k];
+                    mark[k] = static_cast<int>(i);
+                    k = parent[k];
+                }
+            }
+        }
+
+        // Supernody: kolumna j dołącza do supernodu kolumny j - 1, jeśli jest jej
+        // rodzicem. Struktura L(:, j-1) poza j zawiera się wtedy w L(:, j), więc
+        // panel ma width + count[j] wierszy. Bez dodatkowych zer (supernody
+        // fundamentalne) łączymy zawsze, a wąskie supernody także kosztem części
+        // jawnych zer - większe bloki gęste są szybsze niż wiele małych.
+        superStart.assign(1, 0);
+        std::size_t width = 1, actual = n > 0 ? count[0] : 0;
+        for (std::size_t j = 1; j < n; ++j) {
+            bool merge = false;
+            if (parent[j - 1] == static_cast<int>(j)) {
+                std::size_t columns = width + 1;
+                std::size_t stored = columns * (width + count[j]) - width * columns / 2;
+                double zeros = static_cast<double>(stored - actual - count[j]) / stored;
+                merge = zeros == 0.0 || columns <= RELAX_ALWAYS ||
+                        (columns <= RELAX_NARROW && zeros < 0.8) ||
+                        (columns <= RELAX_MEDIUM && zeros < 0.1) || zeros < 0.05;
+            }
+            if (merge) {
+                ++width;
+                actual += count[j];
+            } else {
+                superStart.push_back(static_cast<int>(j));
+                width = 1;
+                actual = count[j];
+            }
+        }
+        superStart.push_back(static_cast<int>(n));
+        if (n == 0) superStart.assign(1, 0);
+        std::size_t supernodes = superStart.size() - 1;
+        superOf.resize(n);
+        for (std::size_t s = 0; s < supernodes; ++s) {
+            std::fill(superOf.begin() + superStart[s], superOf.begin() + superStart[s + 1], static_cast<int>(s));
+        }
+
+        // Struktura supernodu: wiersze A w jego kolumnach i struktury dzieci, poniżej bloku przekątnego
+        std::vector<int> childHead(supernodes, -1), childNext(supernodes, -1);
+        for (std::size_t s = supernodes; s-- > 0;) {
+            int up = parent[superStart[s + 1] - 1];
+            if (up == -1) continue;
+            int p = superOf[up];
+            childNext[s] = childHead[p];
+            childHead[p] = static_cast<int>(s);
+        }
+        rowStart.assign(supernodes + 1, 0);
+        std::fill(mark.begin(), mark.end(), -1);
+        std::vector<int> collected;
+        lnz = 0;
+        for (std::size_t s = 0; s < supernodes; ++s) {
+            int first = superStart[s], end = superStart[s + 1];
+            int stamp = static_cast<int>(s);
+            collected.clear();
+            for (int j = first; j < end; ++j) {
+                for (const int* u = g.begin(perm[j]); u != g.end(perm[j]); ++u) {
+                    int r = inverse[*u];
+                    if (r >= end && mark[r] != stamp) {
+                        mark[r] = stamp;
+                        collected.push_back(r);
+                    }
+                }
+            }
+            for (int c = childHead[s]; c != -1; c = childNext[c]) {
+                for (std::size_t q = rowStart[c]; q < rowStart[c + 1]; ++q) {
+                    int r = rows[q];
+                    if (r >= end && mark[r] != stamp) {
+                        mark[r] = stamp;
+                        collected.push_back(r);
+                    }
+                }
+            }
+            std::sort(collected.begin(), collected.end());
+            rows.insert(rows.end(), collected.begin(), collected.end());
+            rowStart[s + 1] = rows.size();
+            std::size_t ns = end - first;
+            lnz += ns * (ns + 1) / 2 + ns * collected.size();
+        }
+    }
+
+    bool SparseSymbolic::matches(const SparseMatrix& A) const {
+        return A.rows() == n && A.cols() == n && A.rowPointers() == patternPtr && A.columnIndices() == patternIdx;
+    }
+
+    SparseCholesky::SparseCholesky(const SparseMatrix& A, FillOrdering ordering)
+        : SparseCholesky(SparseSymbolic(A, ordering), A) {}
+
+    SparseCholesky::SparseCholesky(const SparseSymbolic& analysis, const SparseMatrix& A) : symbolic(analysis) {
+        if (!symbolic.matches(A)) {
+            throw std::invalid_argument("Wzorzec macierzy różni się od wzorca analizy");
+        }
+        work.resize(layoutPanels(symbolic, panelOffset));
+        values.resize(panelOffset.back());
+
+        // Dolny trójkąt P A P^T: element (pi, pj), pi >= pj, leży w kolumnie pj supernodu pj
+        const auto& ptr = A.rowPointers();
+        const auto& idx = A.columnIndices();
+        const auto& inverse = symbolic.inversePermutation();
+        target.assign(A.nnz(), NONE);
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                int pi = inverse[i], pj = inverse[idx[p]];
+                if (pi < pj) continue;
+                int s = symbolic.supernodeOf(pj);
+                int first = symbolic.supernodeStarts()[s];
+                std::size_t ns = symbolic.supernodeStarts()[s + 1] - first;
+                target[p] = panelOffset[s] + panelRow(symbolic, s, pi) * ns + (pj - first);
+            }
+        }
+        factorize(A);
+    }
+
+    void SparseCholesky::factorize(const SparseMatrix& A) {
+        if (!symbolic.matches(A)) {
+            throw std::invalid_argument("Wzorzec macierzy różni się od wzorca analizy");
+        }
+        std::fill(values.begin(), values.end(), 0.0);
+        const auto& a = A.values();
+        for (std::size_t p = 0; p < a.size(); ++p) {
+            if (target[p] != NONE) values[target[p]] += a[p];
+        }
+
+        std::vector<std::size_t> rel(symbolic.size());
+        for (std::size_t s = 0; s < symbolic.supernodeCount(); ++s) {
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - symbolic.supernodeStarts()[s];
+            std::size_t nr = symbolic.supernodeRows(s).size();
+            MatrixView panel(values.data() + panelOffset[s], ns + nr, ns, ns);
+            MatrixView D = panel.block(0, 0, ns, ns);
+            MatrixView B = panel.block(ns, 0, nr, ns);
+            choleskyFactorInPlace(D);
+            if (nr == 0) continue;
+            trsm(Side::Right, Triangle::Lower, Op::Transpose, Diagonal::NonUnit, 1.0, D, B);
+
+            // Aktualizacja -B B^T, kolumnami kolejnych supernodów-przodków
+            forEachTarget(symbolic, static_cast<int>(s), [&](int t, std::size_t c0, std::size_t c1) {
+                std::size_t width = c1 - c0;
+                MatrixView W(work.data(), nr - c0, width, width);
+                product(B.block(c0, 0, nr - c0, ns), B.block(c0, 0, width, ns), true, W);
+                relativeRows(symbolic, static_cast<int>(s), t, c0, rel);
+                Span<const int> rows = symbolic.supernodeRows(s);
+                int first = symbolic.supernodeStarts()[t];
+                std::size_t nt = symbolic.supernodeStarts()[t + 1] - first;
+                double* dst = values.data() + panelOffset[t];
+                for (std::size_t r = c0; r < nr; ++r) {
+                    double* row = dst + rel[r] * nt;
+                    const double* w = W.row(r - c0);
+                    std::size_t last = std::min(c1, r + 1);
+                    for (std::size_t c = c0; c < last; ++c) row[rows[c] - first] -= w[c - c0];
+                }
+            });
+        }
+    }
+
+    void SparseCholesky::solveInPlace(Span<double> b) const {
+        std::vector<double> y;
+        const std::vector<int>& perm = symbolic.permutation();
+        permute(perm, b, y);
+        std::size_t count = symbolic.supernodeCount();
+
+        // L y = P b
+        for (std::size_t s = 0; s < count; ++s) {
+            int first = symbolic.supernodeStarts()[s];
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - first;
+            Span<const int> rows = symbolic.supernodeRows(s);
+            const double* panel = values.data() + panelOffset[s];
+            double* ys = y.data() + first;
+            for (std::size_t i = 0; i < ns; ++i) {
+                const double* li = panel + i * ns;
+                ys[i] = (ys[i] - simd::dot(i, li, ys)) / li[i];
+            }
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                y[rows[r]] -= simd::dot(ns, panel + (ns + r) * ns, ys);
+            }
+        }
+        // L^T x = y
+        for (std::size_t s = count; s-- > 0;) {
+            int first = symbolic.supernodeStarts()[s];
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - first;
+            Span<const int> rows = symbolic.supernodeRows(s);
+            const double* panel = values.data() + panelOffset[s];
+            double* ys = y.data() + first;
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                simd::axpy(ns, -y[rows[r]], panel + (ns + r) * ns, ys);
+            }
+            for (std::size_t i = ns; i-- > 0;) {
+                const double* li = panel + i * ns;
+                ys[i] /= li[i];
+                simd::axpy(i, -ys[i], li, ys);
+            }
+        }
+        for (std::size_t k = 0; k < perm.size(); ++k) b[perm[k]] = y[k];
+    }
+
+    std::vector<double> SparseCholesky::solve(const std::vector<double>& b) const {
+        std::vector<double> x(b);
+        solveInPlace(Span<double>(x));
+        return x;
+    }
+
+    SparseLU::SparseLU(const SparseMatrix& A, FillOrdering ordering)
+        : SparseLU(SparseSymbolic(A, ordering), A) {}
+
+    SparseLU::SparseLU(const SparseSymbolic& analysis, const SparseMatrix& A) : symbolic(analysis) {
+        if (!symbolic.matches(A)) {
+            throw std::invalid_argument("Wzorzec macierzy różni się od wzorca analizy");
+        }
+        work.resize(layoutPanels(symbolic, panelOffset));
+        std::size_t count = symbolic.supernodeCount();
+        upperOffset.assign(count, 0);
+        std::size_t total = panelOffset.back();
+        for (std::size_t s = 0; s < count; ++s) {
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - symbolic.supernodeStarts()[s];
+            upperOffset[s] = total;
+            total += ns * symbolic.supernodeRows(s).size();
+        }
+        values.resize(total);
+        pivots.resize(symbolic.size());
+
+        // Element (pi, pj) leży w supernodzie mniejszego z indeksów: pod przekątną
+        // w panelu L, nad nią w bloku przekątnym albo w części U
+        const auto& ptr = A.rowPointers();
+        const auto& idx = A.columnIndices();
+        const auto& inverse = symbolic.inversePermutation();
+        target.resize(A.nnz());
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            for (std::size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                int pi = inverse[i], pj = inverse[idx[p]];
+                int s = symbolic.supernodeOf(std::min(pi, pj));
+                int first = symbolic.supernodeStarts()[s];
+                std::size_t ns = symbolic.supernodeStarts()[s + 1] - first;
+                if (pi >= pj) {
+                    target[p] = panelOffset[s] + panelRow(symbolic, s, pi) * ns + (pj - first);
+                    continue;
+                }
+                std::size_t column = panelRow(symbolic, s, pj);
+                if (column < ns) {
+                    target[p] = panelOffset[s] + (pi - first) * ns + column;
+                } else {
+                    std::size_t nr = symbolic.supernodeRows(s).size();
+                    target[p] = upperOffset[s] + (pi - first) * nr + (column - ns);
+                }
+            }
+        }
+        factorize(A);
+    }
+
+    void SparseLU::factorize(const SparseMatrix& A) {
+        if (!symbolic.matches(A)) {
+            throw std::invalid_argument("Wzorzec macierzy różni się od wzorca analizy");
+        }
+        a = A;
+        normA = 0.0;
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            double sum = 0.0;
+            for (std::size_t p = A.rowPointers()[i]; p < A.rowPointers()[i + 1]; ++p) sum += std::fabs(A.values()[p]);
+            normA = std::max(normA, sum);
+        }
+        std::fill(values.begin(), values.end(), 0.0);
+        for (std::size_t p = 0; p < a.nnz(); ++p) values[target[p]] += a.values()[p];
+
+        std::vector<std::size_t> rel(symbolic.size());
+        std::vector<int> piv;
+        for (std::size_t s = 0; s < symbolic.supernodeCount(); ++s) {
+            int start = symbolic.supernodeStarts()[s];
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - start;
+            std::size_t nr = symbolic.supernodeRows(s).size();
+            MatrixView panel(values.data() + panelOffset[s], ns + nr, ns, ns);
+            MatrixView D = panel.block(0, 0, ns, ns);
+            MatrixView B = panel.block(ns, 0, nr, ns);
+            MatrixView U(values.data() + upperOffset[s], ns, nr, nr);
+
+            luFactorInPlace(D, piv);
+            std::copy(piv.begin(), piv.end(), pivots.begin() + start);
+            if (nr == 0) continue;
+            for (std::size_t k = 0; k < ns; ++k) {
+                if (piv[k] != static_cast<int>(k)) std::swap_ranges(U.row(k), U.row(k) + nr, U.row(piv[k]));
+            }
+            trsm(Side::Left, Triangle::Lower, Op::None, Diagonal::Unit, 1.0, D, U);
+            trsm(Side::Right, Triangle::Upper, Op::None, Diagonal::NonUnit, 1.0, D, B);
+
+            // Aktualizacja -B U: kolumny supernodu t (panel L) i jego wiersze na prawo (część U)
+            forEachTarget(symbolic, static_cast<int>(s), [&](int t, std::size_t c0, std::size_t c1) {
+                std::size_t width = c1 - c0;
+                relativeRows(symbolic, static_cast<int>(s), t, c0, rel);
+                Span<const int> rows = symbolic.supernodeRows(s);
+                int first = symbolic.supernodeStarts()[t];
+                std::size_t nt = symbolic.supernodeStarts()[t + 1] - first;
+
+                MatrixView W(work.data(), nr - c0, width, width);
+                product(B.block(c0, 0, nr - c0, ns), U.block(0, c0, ns, width), false, W);
+                double* dst = values.data() + panelOffset[t];
+                for (std::size_t r = c0; r < nr; ++r) {
+                    double* row = dst + rel[r] * nt;
+                    const double* w = W.row(r - c0);
+                    for (std::size_t c = c0; c < c1; ++c) row[rows[c] - first] -= w[c - c0];
+                }
+
+                std::size_t rest = nr - c1;
+                if (rest == 0) return;
+                std::size_t nu = symbolic.supernodeRows(t).size();
+                MatrixView R(work.data(), width, rest, rest);
+                product(B.block(c0, 0, width, ns), U.block(0, c1, ns, rest), false, R);
+                double* upper = values.data() + upperOffset[t];
+                for (std::size_t r = c0; r < c1; ++r) {
+                    double* row = upper + (rows[r] - first) * nu;
+                    const double* w = R.row(r - c0);
+                    for (std::size_t c = c1; c < nr; ++c) row[rel[c] - nt] -= w[c - c1];
+                }
+            });
+        }
+    }
+
+    void SparseLU::substitute(Span<double> b) const {
+        std::vector<double> y, gathered;
+        const std::vector<int>& perm = symbolic.permutation();
+        permute(perm, b, y);
+        std::size_t count = symbolic.supernodeCount();
+
+        // L y = P b, z zamianami wierszy w obrębie supernodów
+        for (std::size_t s = 0; s < count; ++s) {
+            int first = symbolic.supernodeStarts()[s];
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - first;
+            Span<const int> rows = symbolic.supernodeRows(s);
+            const double* panel = values.data() + panelOffset[s];
+            double* ys = y.data() + first;
+            for (std::size_t k = 0; k < ns; ++k) {
+                if (pivots[first + k] != static_cast<int>(k)) std::swap(ys[k], ys[pivots[first + k]]);
+            }
+            for (std::size_t i = 1; i < ns; ++i) ys[i] -= simd::dot(i, panel + i * ns, ys);
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                y[rows[r]] -= simd::dot(ns, panel + (ns + r) * ns, ys);
+            }
+        }
+        // U x = y
+        for (std::size_t s = count; s-- > 0;) {
+            int first = symbolic.supernodeStarts()[s];
+            std::size_t ns = symbolic.supernodeStarts()[s + 1] - first;
+            Span<const int> rows = symbolic.supernodeRows(s);
+            std::size_t nr = rows.size();
+            const double* panel = values.data() + panelOffset[s];
+            const double* upper = values.data() + upperOffset[s];
+            double* ys = y.data() + first;
+            gathered.resize(nr);
+            for (std::size_t r = 0; r < nr; ++r) gathered[r] = y[rows[r]];
+            for (std::size_t i = 0; i < ns; ++i) ys[i] -= simd::dot(nr, upper + i * nr, gathered.data());
+            for (std::size_t i = ns; i-- > 0;) {
+                const double* ui = panel + i * ns;
+                ys[i] = (ys[i] - simd::dot(ns - i - 1, ui + i + 1, ys + i + 1)) / ui[i];
+            }
+        }
+        for (std::size_t k = 0; k < perm.size(); ++k) b[perm[k]] = y[k];
+    }
+
+    void SparseLU::solveInPlace(Span<double> b) const {
+        std::size_t n = size();
+        if (b.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        std::vector<double> x(b.begin(), b.end()), r(n);
+        substitute(Span<double>(x));
+        const double tolerance = std::numeric_limits<double>::epsilon() * std::sqrt(static_cast<double>(std::max<std::size_t>(n, 1)));
+        double previous = std::numeric_limits<double>::infinity();
+        for (int step = 0; step < MAX_REFINEMENT; ++step) {
+            a.multiply(x, r);
+            double normR = 0.0, normX = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                r[i] = b[i] - r[i];
+                normR = std::max(normR, std::fabs(r[i]));
+                normX = std::max(normX, std::fabs(x[i]));
+            }
+            // Poprawianie kończy się po osiągnięciu celu lub gdy residuum przestaje maleć
+            if (normR <= tolerance * normA * normX || !(normR < 0.5 * previous)) break;
+            previous = normR;
+            substitute(Span<double>(r));
+            for (std::size_t i = 0; i < n; ++i) x[i] += r[i];
+        }
+        std::copy(x.begin(), x.end(), b.begin());
+    }
+
+    std::vector<double> SparseLU::solve(const std::vector<double>& b) const {
+        std::vector<double> x(b);
+        solveInPlace(Span<double>(x));
+        return x;
+    }
+
+} // namespace numlib
@@ -0,0 +1,14 @@
+#pragma once
+
+/*
+    Wspólne makra plików z jądrami SIMD (nagłówek wewnętrzny, nie jest instalowany).
+    NUMLIB_SIMD_X86 - czy dostępne są wersje dla x86 kompilowane atrybutem target,
+    NUMLIB_TARGET(isa) - kompilacja jednej funkcji dla danego zestawu instrukcji.
+*/
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NUMLIB_SIMD_X86 1
+#include <immintrin.h>
+#define NUMLIB_TARGET(isa) __attribute__((target(isa)))
+#else
+#define NUMLIB_SIMD_X86 0
+#endif
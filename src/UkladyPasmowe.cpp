@@ -0,0 +1,187 @@
+#include "../include/numlib/UkladyPasmowe.h"
+#include "../include/numlib/Watki.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace numlib {
+
+    void ThomasInPlace(Span<const double> lower, Span<const double> diag, Span<const double> upper,
+                       Span<double> rhs, Span<double> work) {
+        std::size_t n = diag.size();
+        if (n == 0) return;
+        if (rhs.size() != n || lower.size() + 1 != n || upper.size() + 1 != n || work.size() < n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary układu trójdiagonalnego");
+        }
+
+        // Eliminacja w przód: work przechowuje zmodyfikowaną naddiagonalę
+        double m = diag[0];
+        if (m == 0.0) {
+            throw std::runtime_error("Zerowy element główny w algorytmie Thomasa");
+        }
+        rhs[0] /= m;
+        for (std::size_t i = 1; i < n; ++i) {
+            work[i - 1] = upper[i - 1] / m;
+            m = diag[i] - lower[i - 1] * work[i - 1];
+            if (m == 0.0) {
+                throw std::runtime_error("Zerowy element główny w algorytmie Thomasa");
+            }
+            rhs[i] = (rhs[i] - lower[i - 1] * rhs[i - 1]) / m;
+        }
+
+        // Podstawianie wsteczne
+        for (std::size_t i = n - 1; i-- > 0;) {
+            rhs[i] -= work[i] * rhs[i + 1];
+        }
+    }
+
+    std::vector<double> Thomas(const std::vector<double>& lower, const std::vector<double>& diag,
+                               const std::vector<double>& upper, const std::vector<double>& rhs) {
+        std::vector<double> x(rhs);
+        std::vector<double> work(diag.size());
+        ThomasInPlace(lower, diag, upper, Span<double>(x), Span<double>(work));
+        return x;
+    }
+
+    void ThomasBatched(std::size_t n, std::size_t batch,
+                       Span<const double> lower, Span<const double> diag, Span<const double> upper,
+                       Span<double> rhs) {
+        if (n == 0 || batch == 0) return;
+        if (diag.size() != n * batch || rhs.size() != n * batch ||
+            lower.size() != (n - 1) * batch || upper.size() != (n - 1) * batch) {
+            throw std::invalid_argument("Nieprawidłowe wymiary układów trójdiagonalnych");
+        }
+
+        // Paczka układów przetwarzana przez jedno zadanie; wewnętrzne pętle po s
+        // są ciągłe w pamięci i wektoryzują się
+        const std::size_t CHUNK = 512;
+        int chunks = static_cast<int>((batch + CHUNK - 1) / CHUNK);
+        parallelFor(chunks, [&](int t) {
+            std::size_t s0 = t * CHUNK;
+            std::size_t s1 = std::min(batch, s0 + CHUNK);
+            std::size_t w = s1 - s0;
+            std::vector<double> cprime((n - 1) * w);
+            std::vector<double> denom(w);
+
+            const double* d0 = diag.data() + s0;
+            double* r0 = rhs.data() + s0;
+            std::size_t zeroPivots = 0;
+            for (std::size_t s = 0; s < w; ++s) {
+                denom[s] = d0[s];
+                zeroPivots += denom[s] == 0.0;
+                r0[s] /= denom[s];
+            }
+            for (std::size_t i = 1; i < n; ++i) {
+                const double* lo = lower.data() + (i - 1) * batch + s0;
+                const double* up = upper.data() + (i - 1) * batch + s0;
+                const double* di = diag.data() + i * batch + s0;
+                double* cp = cprime.data() + (i - 1) * w;
+                double* ri = rhs.data() + i * batch + s0;
+                const double* rprev = rhs.data() + (i - 1) * batch + s0;
+                for (std::size_t s = 0; s < w; ++s) {
+                    cp[s] = up[s] / denom[s];
+                    denom[s] = di[s] - lo[s] * cp[s];
+                    zeroPivots += denom[s] == 0.0;
+                    ri[s] = (ri[s] - lo[s] * rprev[s]) / denom[s];
+                }
+            }
+            if (zeroPivots > 0) {
+                throw std::runtime_error("Zerowy element główny w algorytmie Thomasa");
+            }
+            for (std::size_t i = n - 1; i-- > 0;) {
+                const double* cp = cprime.data() + i * w;
+                double* ri = rhs.data() + i * batch + s0;
+                const double* rnext = rhs.data() + (i + 1) * batch + s0;
+                for (std::size_t s = 0; s < w; ++s) {
+                    ri[s] -= cp[s] * rnext[s];
+                }
+            }
+        });
+    }
+
+    BandMatrix::BandMatrix(std::size_t size, std::size_t lowerBandwidth, std::size_t upperBandwidth)
+        : n(size), kl(lowerBandwidth), ku(upperBandwidth), ld(2 * lowerBandwidth + upperBandwidth + 1),
+          data(size * (2 * lowerBandwidth + upperBandwidth + 1), 0.0) {}
+
+    std::vector<double> BandMatrix::multiply(const std::vector<double>& x) const {
+        if (x.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        std::vector<double> y(n, 0.0);
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t j0 = i >= kl ? i - kl : 0;
+            std::size_t j1 = std::min(n - 1, i + ku);
+            const double* row = data.data() + i * ld + (j0 + kl - i);
+            y[i] = simd::dot(j1 - j0 + 1, row, x.data() + j0);
+        }
+        return y;
+    }
+
+    BandLU::BandLU(BandMatrix A) : lu(std::move(A)), piv(lu.n) {
+        const std::size_t n = lu.n, kl = lu.kl, ku = lu.ku;
+        // Po zamianach wierszy U ma szerokość kl + ku nad przekątną
+        const std::size_t width = kl + ku;
+
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t last = std::min(n - 1, k + kl);
+            std::size_t p = k;
+            double best = std::abs(lu(k, k));
+            for (std::size_t i = k + 1; i <= last; ++i) {
+                if (std::abs(lu(i, k)) > best) {
+                    best = std::abs(lu(i, k));
+                    p = i;
+                }
+            }
+            piv[k] = p;
+            if (best == 0.0) {
+                throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+            }
+
+            std::size_t jEnd = std::min(n - 1, k + width);
+            if (p != k) {
+                std::swap_ranges(&lu(k, k), &lu(k, k) + (jEnd - k + 1), &lu(p, k));
+            }
+
+            const double* pivotRow = &lu(k, k);
+            for (std::size_t i = k + 1; i <= last; ++i) {
+                double* row = &lu(i, k);
+                double factor = row[0] / pivotRow[0];
+                row[0] = factor;
+                simd::axpy(jEnd - k, -factor, pivotRow + 1, row + 1);
+            }
+        }
+    }
+
+    void BandLU::solveInPlace(Span<double> b) const {
+        const std::size_t n = lu.n, kl = lu.kl, ku = lu.ku;
+        if (b.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        if (n == 0) return;
+
+        // L y = P b - zamiany stosowane w tej samej kolejności co w rozkładzie
+        for (std::size_t k = 0; k < n; ++k) {
+            if (piv[k] != k) std::swap(b[k], b[piv[k]]);
+            std::size_t last = std::min(n - 1, k + kl);
+            for (std::size_t i = k + 1; i <= last; ++i) {
+                b[i] -= lu(i, k) * b[k];
+            }
+        }
+
+        // U x = y
+        for (std::size_t i = n; i-- > 0;) {
+            std::size_t jEnd = std::min(n - 1, i + kl + ku);
+            const double* row = &lu.data[i * lu.ld + kl];
+            double sum = simd::dot(jEnd - i, row + 1, b.data() + i + 1);
+            b[i] = (b[i] - sum) / row[0];
+        }
+    }
+
+    std::vector<double> BandLU::solve(const std::vector<double>& b) const {
+        std::vector<double> x(b);
+        solveInPlace(Span<double>(x));
+        return x;
+    }
+
+} // namespace numlib
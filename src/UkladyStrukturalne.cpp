@@ -0,0 +1,243 @@
+#include "../include/numlib/UkladyStrukturalne.h"
+#include "../include/numlib/Interpolacja.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+        // Węzły układu Vandermonde'a muszą być parami różne
+        void checkDistinct(const std::vector<double>& nodes) {
+            std::vector<double> sorted = nodes;
+            std::sort(sorted.begin(), sorted.end());
+            if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+                throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+            }
+        }
+
+        /*
+            Rekurencja Durbina dla T(1, rho_0..rho_{m-2}) y = -(rho_0..rho_{m-1})
+            (Golub, Van Loan 4.7.1). Zwraca y (m elementów); alphas[k] to
+            ostatni element y rzędu k + 1.
+        */
+        std::vector<double> durbin(const std::vector<double>& rho, std::size_t m, std::vector<double>* alphas) {
+            std::vector<double> y(m);
+            if (m == 0) return y;
+            double beta = 1.0, alpha = -rho[0];
+            y[0] = alpha;
+            if (alphas) alphas->assign(1, alpha);
+            for (std::size_t k = 1; k < m; k++) {
+                beta *= 1.0 - alpha * alpha;
+                if (!(beta > 0.0)) {
+                    throw std::runtime_error("Macierz nie jest dodatnio określona");
+                }
+                double sum = rho[k];
+                for (std::size_t i = 0; i < k; i++) sum += rho[i] * y[k - 1 - i];
+                alpha = -sum / beta;
+                // y(0:k-1) += alpha * y(k-1:-1:0), parami od obu końców
+                for (std::size_t i = 0, j = k - 1; i <= j; i++, j--) {
+                    double a = y[i], b = y[j];
+                    y[i] = a + alpha * b;
+                    if (i != j) y[j] = b + alpha * a;
+                    if (j == 0) break;
+                }
+                y[k] = alpha;
+                if (alphas) alphas->push_back(alpha);
+            }
+            if (!(1.0 - alpha * alpha > 0.0)) {
+                throw std::runtime_error("Macierz nie jest dodatnio określona");
+            }
+            return y;
+        }
+
+        // rho_k = r_{k+1} / r_0
+        std::vector<double> normalized(const std::vector<double>& r) {
+            if (!(r[0] > 0.0)) {
+                throw std::runtime_error("Macierz nie jest dodatnio określona");
+            }
+            std::vector<double> rho(r.size() - 1);
+            for (std::size_t k = 0; k + 1 < r.size(); k++) rho[k] = r[k + 1] / r[0];
+            return rho;
+        }
+    }
+
+    std::vector<double> ToeplitzSolve(const std::vector<double>& column, const std::vector<double>& row,
+                                      const std::vector<double>& rhs) {
+        std::size_t n = rhs.size();
+        if (column.size() != n || row.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        if (n == 0) return {};
+        if (column[0] != row[0]) {
+            throw std::invalid_argument("Pierwszy element kolumny i wiersza musi być równy");
+        }
+        if (column[0] == 0.0) {
+            throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+        }
+
+        std::vector<double> f(n), b(n), x(n);
+        f[0] = b[0] = 1.0 / column[0];
+        x[0] = rhs[0] / column[0];
+        for (std::size_t k = 1; k < n; k++) {
+            // Ostatni wiersz T_{k+1} razy [f; 0] i [x; 0], pierwszy wiersz razy [0; b]
+            double ef = 0.0, eb = 0.0, ex = 0.0;
+            for (std::size_t j = 0; j < k; j++) {
+                ef += column[k - j] * f[j];
+                ex += column[k - j] * x[j];
+                eb += row[j + 1] * b[j];
+            }
+            double d = 1.0 - ef * eb;
+            if (std::abs(d) <= std::numeric_limits<double>::epsilon()) {
+                throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+            }
+            // f := ([f; 0] - ef [0; b]) / d,  b := ([0; b] - eb [f; 0]) / d
+            for (std::size_t j = k + 1; j-- > 0;) {
+                double fj = j < k ? f[j] : 0.0, bj = j > 0 ? b[j - 1] : 0.0;
+                f[j] = (fj - ef * bj) / d;
+                b[j] = (bj - eb * fj) / d;
+            }
+            double mu = rhs[k] - ex;
+            for (std::size_t j = 0; j < k; j++) x[j] += mu * b[j];
+            x[k] = mu * b[k];
+        }
+        return x;
+    }
+
+    std::vector<double> SymmetricToeplitzSolve(const std::vector<double>& r, const std::vector<double>& rhs) {
+        std::size_t n = rhs.size();
+        if (r.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        if (n == 0) return {};
+        std::vector<double> rho = normalized(r);
+
+        // Golub, Van Loan 4.7.2: y rozwiązuje równania Yule'a-Walkera rzędu k
+        std::vector<double> x(n), y(n);
+        x[0] = rhs[0] / r[0];
+        if (n == 1) return x;
+        double beta = 1.0, alpha = -rho[0];
+        y[0] = alpha;
+        for (std::size_t k = 1; k < n; k++) {
+            beta *= 1.0 - alpha * alpha;
+            if (!(beta > 0.0)) {
+                throw std::runtime_error("Macierz nie jest dodatnio określona");
+            }
+            double sum = rhs[k] / r[0];
+            for (std::size_t i = 0; i < k; i++) sum -= rho[i] * x[k - 1 - i];
+            double mu = sum / beta;
+            for (std::size_t i = 0; i < k; i++) x[i] += mu * y[k - 1 - i];
+            x[k] = mu;
+
+            if (k + 1 < n) {
+                double s = rho[k];
+                for (std::size_t i = 0; i < k; i++) s += rho[i] * y[k - 1 - i];
+                alpha = -s / beta;
+                for (std::size_t i = 0, j = k - 1; i <= j; i++, j--) {
+                    double a = y[i], b = y[j];
+                    y[i] = a + alpha * b;
+                    if (i != j) y[j] = b + alpha * a;
+                    if (j == 0) break;
+                }
+                y[k] = alpha;
+            }
+        }
+        return x;
+    }
+
+    LevinsonDurbinResult LevinsonDurbin(const std::vector<double>& autocorrelation, std::size_t order) {
+        if (autocorrelation.size() < order + 1) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        std::vector<double> r(autocorrelation.begin(), autocorrelation.begin() + order + 1);
+        std::vector<double> rho = normalized(r);
+        std::vector<double> alphas;
+        std::vector<double> y = durbin(rho, order, &alphas);
+
+        LevinsonDurbinResult result;
+        result.coefficients.resize(order);
+        result.reflection.resize(order);
+        result.error = r[0];
+        for (std::size_t k = 0; k < order; k++) {
+            result.coefficients[k] = -y[k];
+            result.reflection[k] = -alphas[k];
+            result.error *= 1.0 - alphas[k] * alphas[k];
+        }
+        return result;
+    }
+
+    Matrix SymmetricToeplitzInverse(const std::vector<double>& r) {
+        std::size_t n = r.size();
+        Matrix B(n, n);
+        if (n == 0) return B;
+        std::vector<double> rho = normalized(r);
+        std::vector<double> y = durbin(rho, n - 1, nullptr);
+
+        // Pierwsza kolumna odwrotności: u = gamma [1; y], bo T [1; y] = [1 + rho^T y; 0]
+        double sum = 1.0;
+        for (std::size_t k = 0; k + 1 < n; k++) sum += rho[k] * y[k];
+        std::vector<double> u(n);
+        u[0] = 1.0 / sum;
+        for (std::size_t k = 1; k < n; k++) u[k] = u[0] * y[k - 1];
+
+        // Trench: B(i, j) = B(i-1, j-1) + (u_i u_j - u_{n-i} u_{n-j}) / u_0 w klinie i <= j <= n-1-i,
+        // resztę daje symetria B(i, j) = B(j, i) i persymetria B(i, j) = B(n-1-j, n-1-i)
+        for (std::size_t j = 0; j < n; j++) B(0, j) = u[j];
+        for (std::size_t i = 1; 2 * i < n; i++) {
+            for (std::size_t j = i; j + i < n; j++) {
+                B(i, j) = B(i - 1, j - 1) + (u[i] * u[j] - u[n - i] * u[n - j]) / u[0];
+            }
+        }
+        for (std::size_t i = 0; 2 * i < n; i++) {
+            for (std::size_t j = i; j + i < n; j++) {
+                double v = B(i, j) / r[0];
+                B(i, j) = B(j, i) = v;
+                B(n - 1 - j, n - 1 - i) = B(n - 1 - i, n - 1 - j) = v;
+            }
+        }
+        return B;
+    }
+
+    std::vector<double> NewtonToMonomial(const std::vector<double>& nodes, const std::vector<double>& coeffs) {
+        std::size_t n = coeffs.size();
+        if (nodes.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        if (n == 0) return {};
+        std::vector<double> a = coeffs;
+        // Schemat Hornera od najwyższego czynnika (x - x_k)
+        for (std::size_t k = n - 1; k-- > 0;) {
+            for (std::size_t i = k; i + 1 < n; i++) a[i] -= a[i + 1] * nodes[k];
+        }
+        return a;
+    }
+
+    std::vector<double> VandermondeSolve(const std::vector<double>& nodes, const std::vector<double>& values) {
+        if (nodes.size() != values.size()) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        checkDistinct(nodes);
+        return NewtonToMonomial(nodes, DividedDiff(nodes, values));
+    }
+
+    std::vector<double> VandermondeTransposeSolve(const std::vector<double>& nodes, const std::vector<double>& rhs) {
+        std::size_t n = rhs.size();
+        if (nodes.size() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+        }
+        if (n == 0) return {};
+        checkDistinct(nodes);
+        // Golub, Van Loan 4.6.2: odwrotność etapów algorytmu dla układu pierwotnego w odwrotnej kolejności
+        std::vector<double> w = rhs;
+        for (std::size_t k = 0; k + 1 < n; k++) {
+            for (std::size_t i = n - 1; i > k; i--) w[i] -= nodes[k] * w[i - 1];
+        }
+        for (std::size_t k = n - 1; k-- > 0;) {
+            for (std::size_t i = k + 1; i < n; i++) w[i] /= nodes[i] - nodes[i - k - 1];
+            for (std::size_t i = k; i + 1 < n; i++) w[i] -= w[i + 1];
+        }
+        return w;
+    }
+
+} // namespace numlib
@@ -0,0 +1,246 @@
+#include "../include/numlib/UkladyWsadowe.h"
+#include "../include/numlib/Watki.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "SIMDWewnetrzne.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define NUMLIB_INLINE inline __attribute__((always_inline))
+#else
+#define NUMLIB_INLINE inline
+#endif
+
+namespace numlib {
+
+    namespace {
+
+        /*
+            Paczka PACK układów przetwarzana jedną instrukcją wektorową: element (i, j)
+            wszystkich układów paczki to jeden wektor. Z GCC/Clang używane są wektory
+            rozszerzeń kompilatora (8 x double = jeden rejestr AVX-512, dwa AVX2 lub
+            cztery SSE2), w innych kompilatorach paczka ma jeden element.
+        */
+#if defined(__GNUC__) || defined(__clang__)
+        constexpr int PACK = 8;
+        typedef double Pack __attribute__((vector_size(PACK * sizeof(double))));
+        typedef long long Mask __attribute__((vector_size(PACK * sizeof(double))));
+
+        NUMLIB_INLINE bool anyLane(const Mask& m) {
+            bool any = false;
+            for (int s = 0; s < PACK; ++s) any |= m[s] != 0;
+            return any;
+        }
+
+        // Wybór po elementach: out = m ? x : y (operacje bitowe zamiast ?: na wektorach).
+        // Wynik przez referencję - zwracanie 512-bitowego wektora poza funkcją z atrybutem
+        // target zmienia ABI (-Wpsabi)
+        NUMLIB_INLINE void select(const Mask& m, const Pack& x, const Pack& y, Pack& out) {
+            out = (Pack)(((Mask)x & m) | ((Mask)y & ~m));
+        }
+#else
+        constexpr int PACK = 1;
+        using Pack = double;
+        using Mask = long long;
+
+        inline bool anyLane(const Mask& m) { return m != 0; }
+
+        inline void select(const Mask& m, const Pack& x, const Pack& y, Pack& out) { out = m ? x : y; }
+#endif
+
+        // Ta sama granica co w LU i GaussSolve
+        constexpr double PIVOT_TOLERANCE = 1e-10;
+
+        // Liczba paczek w jednym zadaniu puli wątków
+        constexpr std::size_t PACKS_PER_TASK = 16;
+
+        /*
+            Eliminacja Gaussa z częściowym wyborem elementu głównego dla paczki układów.
+            Pętle po i, j mają liczbę obrotów znaną w czasie kompilacji. Wiersz główny
+            wybierany jest w każdym układzie osobno, a zamiana wierszy to wybór (blend)
+            między wektorami; jeśli żaden układ paczki nie wymaga zamiany, jest pomijana.
+            Na przekątnej zostają odwrotności elementów głównych (jedno dzielenie na wiersz).
+            Zwraca true, gdy w którymś z układów element główny ma moduł mniejszy
+            niż PIVOT_TOLERANCE.
+        */
+        template<int N>
+        NUMLIB_INLINE bool eliminatePack(Pack* a, Pack* b) {
+            const Pack zero = {};
+            Pack smallest = zero + 1.0;
+
+            for (int k = 0; k < N; ++k) {
+                Pack best = a[k * N + k];
+                select(best < 0.0, -best, best, best);
+                Mask piv = Mask{} + k;
+                for (int i = k + 1; i < N; ++i) {
+                    Pack v = a[i * N + k];
+                    select(v < 0.0, -v, v, v);
+                    Mask better = v > best;
+                    select(better, v, best, best);
+                    piv = ((Mask{} + i) & better) | (piv & ~better);
+                }
+                select(best < smallest, best, smallest, smallest);
+
+                if (anyLane(piv != k)) {
+                    for (int i = k + 1; i < N; ++i) {
+                        // swap = (piv == i) bez porównania wektorowego, które przy -O3 wywraca GCC 12
+                        const Mask d = piv ^ i;
+                        const Mask swap = ~((d | -d) >> 63);
+                        for (int j = k; j <= N; ++j) {
+                            Pack& rk = j < N ? a[k * N + j] : b[k];
+                            Pack& ri = j < N ? a[i * N + j] : b[i];
+                            Pack x = rk, y = ri;
+                            select(swap, y, x, rk);
+                            select(swap, x, y, ri);
+                        }
+                    }
+                }
+
+                Pack inv = 1.0 / a[k * N + k];
+                a[k * N + k] = inv;
+                for (int i = k + 1; i < N; ++i) {
+                    Pack f = a[i * N + k] * inv;
+                    for (int j = k + 1; j < N; ++j) a[i * N + j] -= f * a[k * N + j];
+                    b[i] -= f * b[k];
+                }
+            }
+
+            // Podstawianie wsteczne
+            for (int i = N - 1; i >= 0; --i) {
+                for (int j = i + 1; j < N; ++j) b[i] -= a[i * N + j] * b[j];
+                b[i] *= a[i * N + i];
+            }
+            return anyLane(smallest < PIVOT_TOLERANCE);
+        }
+
+        /*
+            Rozwiązuje układy s0 .. s0+w-1: kolejne paczki są kopiowane z układu SoA
+            do zmiennych lokalnych (niepełna paczka uzupełniana macierzą jednostkową),
+            rozwiązywane i zapisywane z powrotem. Zwraca true przy układzie osobliwym.
+        */
+        template<int N>
+        NUMLIB_INLINE bool solveChunk(std::size_t batch, std::size_t s0, std::size_t w,
+                                      const double* A, double* b) {
+            bool singular = false;
+            for (std::size_t p0 = 0; p0 < w; p0 += PACK) {
+                std::size_t lanes = std::min<std::size_t>(PACK, w - p0);
+                std::size_t first = s0 + p0;
+                Pack la[N * N], lb[N];
+                if (lanes == PACK) {
+                    for (int e = 0; e < N * N; ++e) std::memcpy(&la[e], A + e * batch + first, sizeof(Pack));
+                    for (int i = 0; i < N; ++i) std::memcpy(&lb[i], b + i * batch + first, sizeof(Pack));
+                } else {
+                    double tmp[PACK];
+                    for (int e = 0; e < N * N; ++e) {
+                        std::fill(tmp, tmp + PACK, e / N == e % N ? 1.0 : 0.0);
+                        std::copy(A + e * batch + first, A + e * batch + first + lanes, tmp);
+                        std::memcpy(&la[e], tmp, sizeof(Pack));
+                    }
+                    for (int i = 0; i < N; ++i) {
+                        std::fill(tmp, tmp + PACK, 0.0);
+                        std::copy(b + i * batch + first, b + i * batch + first + lanes, tmp);
+                        std::memcpy(&lb[i], tmp, sizeof(Pack));
+                    }
+                }
+
+                singular |= eliminatePack<N>(la, lb);
+
+                for (int i = 0; i < N; ++i) {
+                    double tmp[PACK];
+                    std::memcpy(tmp, &lb[i], sizeof(Pack));
+                    std::copy(tmp, tmp + lanes, b + i * batch + first);
+                }
+            }
+            return singular;
+        }
+
+        // Ta sama funkcja skompilowana dla różnych zestawów instrukcji
+        template<int N>
+        bool solveChunkGeneric(std::size_t batch, std::size_t s0, std::size_t w, const double* A, double* b) {
+            return solveChunk<N>(batch, s0, w, A, b);
+        }
+
+#if NUMLIB_SIMD_X86
+        template<int N>
+        NUMLIB_TARGET("avx2,fma")
+        bool solveChunkAVX2(std::size_t batch, std::size_t s0, std::size_t w, const double* A, double* b) {
+            return solveChunk<N>(batch, s0, w, A, b);
+        }
+
+        template<int N>
+        // Tylko AVX-512F - dispatch (simd::activeLevel) nie sprawdza rozszerzeń DQ/VL
+        NUMLIB_TARGET("avx512f,prefer-vector-width=512")
+        bool solveChunkAVX512(std::size_t batch, std::size_t s0, std::size_t w, const double* A, double* b) {
+            return solveChunk<N>(batch, s0, w, A, b);
+        }
+#endif
+
+        using ChunkKernel = bool (*)(std::size_t, std::size_t, std::size_t, const double*, double*);
+
+        template<int N>
+        ChunkKernel selectKernel() {
+#if NUMLIB_SIMD_X86
+            switch (simd::activeLevel()) {
+                case SimdLevel::AVX512: return solveChunkAVX512<N>;
+                case SimdLevel::AVX2: return solveChunkAVX2<N>;
+                default: break;
+            }
+#endif
+            return solveChunkGeneric<N>;
+        }
+    }
+
+    template<int N>
+    void SolveSmallBatched(std::size_t batch, Span<const double> A, Span<double> b) {
+        static_assert(N >= 1 && N <= MAX_SMALL_SYSTEM, "Nieobsługiwany rozmiar układu");
+        if (A.size() != static_cast<std::size_t>(N * N) * batch || b.size() != static_cast<std::size_t>(N) * batch) {
+            throw std::invalid_argument("Nieprawidłowe wymiary układów");
+        }
+        if (batch == 0) return;
+
+        constexpr std::size_t CHUNK = PACK * PACKS_PER_TASK;
+        ChunkKernel kernel = selectKernel<N>();
+        int chunks = static_cast<int>((batch + CHUNK - 1) / CHUNK);
+        parallelFor(chunks, [&](int t) {
+            std::size_t s0 = t * CHUNK;
+            std::size_t w = std::min(CHUNK, batch - s0);
+            if (kernel(batch, s0, w, A.data(), b.data())) {
+                throw std::runtime_error("Macierz osobliwa - brak rozwiązania");
+            }
+        });
+    }
+
+    template void SolveSmallBatched<1>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<2>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<3>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<4>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<5>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<6>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<7>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<8>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<9>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<10>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<11>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<12>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<13>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<14>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<15>(std::size_t, Span<const double>, Span<double>);
+    template void SolveSmallBatched<16>(std::size_t, Span<const double>, Span<double>);
+
+    void SolveSmallBatched(int n, std::size_t batch, Span<const double> A, Span<double> b) {
+        using Solver = void (*)(std::size_t, Span<const double>, Span<double>);
+        static const Solver solvers[MAX_SMALL_SYSTEM] = {
+            SolveSmallBatched<1>, SolveSmallBatched<2>, SolveSmallBatched<3>, SolveSmallBatched<4>,
+            SolveSmallBatched<5>, SolveSmallBatched<6>, SolveSmallBatched<7>, SolveSmallBatched<8>,
+            SolveSmallBatched<9>, SolveSmallBatched<10>, SolveSmallBatched<11>, SolveSmallBatched<12>,
+            SolveSmallBatched<13>, SolveSmallBatched<14>, SolveSmallBatched<15>, SolveSmallBatched<16>,
+        };
+        if (n < 1 || n > MAX_SMALL_SYSTEM) {
+            throw std::invalid_argument("Nieobsługiwany rozmiar układu");
+        }
+        solvers[n - 1](batch, A, b);
+    }
+
+} // namespace numlib
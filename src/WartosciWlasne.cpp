@@ -0,0 +1,901 @@
+#include "../include/numlib/WartosciWlasne.h"
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace numlib {
+
+    namespace {
+        const double EPS = std::numeric_limits<double>::epsilon();
+
+        // Wiersze w pasku mnożenia A v podczas redukcji. Podział zależy tylko od n,
+        // a sumy częściowe pasków dodawane są w stałej kolejności.
+        const std::size_t SYMV_ROWS = 256;
+
+        // Szerokość pasów kolumn przy aktualizacji dolnego trójkąta po panelu
+        const std::size_t UPDATE_COLS = 256;
+
+        // Podproblemy "dziel i zwyciężaj" do tego rozmiaru rozwiązywane są metodą QL
+        const std::size_t QL_MAX = 32;
+
+        // ... a do tego rozmiaru - w całości przez jedno zadanie puli wątków
+        const std::size_t SERIAL_MAX = 256;
+
+        const std::size_t ROWS_PER_TASK = 64;
+        const int QL_MAX_ITERATIONS = 60;           // na jedną wartość własną
+        const int SECULAR_MAX_ITERATIONS = 200;
+        const int BISECTION_MAX_ITERATIONS = 200;
+        const int INVERSE_ITERATIONS = 4;
+
+        // Wartości bliższe niż CLUSTER_GAP * ||T|| tworzą skupisko w odwrotnej iteracji
+        const double CLUSTER_GAP = 1e-3;
+
+        int taskCount(std::size_t n) {
+            return static_cast<int>((n + ROWS_PER_TASK - 1) / ROWS_PER_TASK);
+        }
+
+        template <typename F>
+        void forEachChunk(std::size_t n, F body) {
+            parallelFor(taskCount(n), [&](int t) {
+                std::size_t i0 = t * ROWS_PER_TASK;
+                body(i0, std::min(n, i0 + ROWS_PER_TASK));
+            });
+        }
+
+        std::vector<std::size_t> sortedOrder(const double* values, std::size_t n) {
+            std::vector<std::size_t> order(n);
+            std::iota(order.begin(), order.end(), std::size_t(0));
+            std::stable_sort(order.begin(), order.end(),
+                             [values](std::size_t i, std::size_t j) { return values[i] < values[j]; });
+            return order;
+        }
+
+        /*
+            Przestawia kolumny: nowa kolumna p to dawna kolumna src[p]
+            (p < src.size(); pozostałe kolumny nie są ruszane).
+        */
+        void gatherColumns(MatrixView M, const std::vector<std::size_t>& src) {
+            std::size_t count = src.size();
+            forEachChunk(M.rows(), [&](std::size_t r0, std::size_t r1) {
+                std::vector<double> buf(count);
+                for (std::size_t r = r0; r < r1; ++r) {
+                    double* row = M.row(r);
+                    for (std::size_t p = 0; p < count; ++p) buf[p] = row[src[p]];
+                    std::copy(buf.begin(), buf.end(), row);
+                }
+            });
+        }
+
+        /*
+            Niejawna metoda QL z przesunięciem Wilkinsona (tql2). e[i] łączy
+            wiersze i oraz i + 1, e[n-1] jest roboczy. Dla vectors obroty dokładane
+            są do kolumn Z (n x n). Wartości nie są sortowane.
+        */
+        void implicitQL(double* d, double* e, std::size_t n, MatrixView Z, bool vectors) {
+            if (n == 0) return;
+            e[n - 1] = 0.0;
+            for (std::size_t l = 0; l < n; ++l) {
+                int iter = 0;
+                std::size_t m;
+                do {
+                    for (m = l; m + 1 < n; ++m) {
+                        double dd = std::abs(d[m]) + std::abs(d[m + 1]);
+                        if (std::abs(e[m]) <= EPS * dd) break;
+                    }
+                    if (m == l) break;
+                    if (++iter > QL_MAX_ITERATIONS) {
+                        throw std::runtime_error("Metoda QL nie osiągnęła zbieżności");
+                    }
+                    double g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+                    double r = std::hypot(g, 1.0);
+                    g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+                    double s = 1.0, c = 1.0, p = 0.0;
+                    bool underflow = false;
+                    for (std::size_t i = m; i-- > l;) {
+                        double f = s * e[i];
+                        double b = c * e[i];
+                        r = std::hypot(f, g);
+                        e[i + 1] = r;
+                        if (r == 0.0) {
+                            d[i + 1] -= p;
+                            e[m] = 0.0;
+                            underflow = true;
+                            break;
+                        }
+                        s = f / r;
+                        c = g / r;
+                        g = d[i + 1] - p;
+                        r = (d[i] - g) * s + 2.0 * c * b;
+                        p = s * r;
+                        d[i + 1] = g + p;
+                        g = c * r - b;
+                        if (vectors) {
+                            for (std::size_t k = 0; k < n; ++k) {
+                                double* zk = Z.row(k);
+                                double t = zk[i + 1];
+                                zk[i + 1] = s * zk[i] + c * t;
+                                zk[i] = c * zk[i] - s * t;
+                            }
+                        }
+                    }
+                    if (underflow) continue;
+                    d[l] -= p;
+                    e[l] = g;
+                    e[m] = 0.0;
+                } while (true);
+            }
+        }
+
+        // ---- Metoda "dziel i zwyciężaj" ----
+
+        /*
+            Pierwiastek i równania sekularnego 1/rho + sum z_j^2 / (d_j - lambda) = 0
+            (d rosnąco, |z| = 1, rho > 0). Pierwiastek leży w (d_i, d_{i+1}), a ostatni
+            w (d_{K-1}, d_{K-1} + rho). Obliczenia prowadzone są względem bliższego
+            bieguna d_o, dzięki czemu różnice d_j - lambda = (d_j - d_o) - tau są
+            dokładne; delta[j] otrzymuje właśnie te różnice.
+
+            Krok: psi (bieguny do i) i phi (bieguny od i + 1) przybliżane są
+            funkcjami wymiernymi zgodnymi co do wartości i pochodnej, a zero modelu
+            wyznacza równanie kwadratowe (Bunch, Nielsen, Sorensen). Przedział
+            zawierający pierwiastek jest zawężany, a krok poza niego zastępowany
+            bisekcją.
+        */
+        double secularRoot(std::size_t i, const double* d, const double* z, std::size_t K, double rho,
+                           double* delta) {
+            if (K == 1) {
+                delta[0] = -rho;
+                return d[0] + rho;
+            }
+            const double rhoInv = 1.0 / rho;
+            const bool last = i + 1 == K;
+            std::size_t origin = i;
+            double lo = 0.0, hi = rho;
+            if (!last) {
+                double gap = d[i + 1] - d[i];
+                double mid = 0.5 * gap;
+                double w = rhoInv;
+                for (std::size_t j = 0; j < K; ++j) w += z[j] * z[j] / ((d[j] - d[i]) - mid);
+                if (w >= 0.0) {
+                    hi = mid;
+                } else {
+                    origin = i + 1;
+                    lo = mid - gap;
+                    hi = 0.0;
+                }
+            }
+            for (std::size_t j = 0; j < K; ++j) delta[j] = d[j] - d[origin];
+
+            double tau = 0.5 * (lo + hi);
+            for (int iter = 0; iter < SECULAR_MAX_ITERATIONS; ++iter) {
+                double psi = 0.0, dpsi = 0.0, phi = 0.0, dphi = 0.0;
+                for (std::size_t j = 0; j <= i; ++j) {
+                    double q = z[j] / (delta[j] - tau);
+                    psi += z[j] * q;
+                    dpsi += q * q;
+                }
+                for (std::size_t j = i + 1; j < K; ++j) {
+                    double q = z[j] / (delta[j] - tau);
+                    phi += z[j] * q;
+                    dphi += q * q;
+                }
+                double w = rhoInv + psi + phi;
+                if (w < 0.0) lo = tau; else hi = tau;
+                double bound = 8.0 * (phi - psi + rhoInv) + std::abs(tau) * (dpsi + dphi);
+                if (std::abs(w) <= EPS * bound) break;
+
+                double next;
+                double ai = delta[i] - tau;
+                double s = dpsi * ai * ai;
+                if (last) {
+                    next = s / (w - dpsi * ai);
+                } else {
+                    double ai1 = delta[i + 1] - tau;
+                    double S = dphi * ai1 * ai1;
+                    double c = w - dpsi * ai - dphi * ai1;
+                    // c (delta_i - x)(delta_{i+1} - x) + s (delta_{i+1} - x) + S (delta_i - x) = 0
+                    if (origin == i) {
+                        double gap = delta[i + 1];
+                        double b = c * gap + s + S;
+                        next = 2.0 * s * gap / (b + std::sqrt(std::max(b * b - 4.0 * c * s * gap, 0.0)));
+                    } else {
+                        double gap = -delta[i];
+                        double b = s + S - c * gap;
+                        next = -2.0 * S * gap / (b + std::sqrt(std::max(b * b + 4.0 * c * S * gap, 0.0)));
+                    }
+                }
+                if (!(next > lo && next < hi)) next = 0.5 * (lo + hi);
+                if (next == tau) break;
+                tau = next;
+            }
+            for (std::size_t j = 0; j < K; ++j) delta[j] -= tau;
+            return d[origin] + tau;
+        }
+
+        /*
+            Łączy rozwiązane połówki: kolumny Z (n x n) to wektory własne
+            diag(T1', T2'), d - ich wartości własne (rosnąco w każdej połówce).
+            T = diag(T1', T2') + |beta| u u^T, u = [e_{m-1}; sign(beta) e_m],
+            więc w bazie wektorów własnych zadanie to D + rho z z^T. Wynik:
+            wartości w d (rosnąco), wektory w Z.
+        */
+        void mergeHalves(double* d, std::size_t n, std::size_t m, double beta, MatrixView Z) {
+            const double sign = beta >= 0.0 ? 1.0 : -1.0;
+            const double rho = 2.0 * std::abs(beta);
+            const double invSqrt2 = 1.0 / std::sqrt(2.0);
+
+            std::vector<std::size_t> perm = sortedOrder(d, n);
+            std::vector<double> ds(n), zs(n);
+            std::vector<int> type(n);          // 0 - niezerowa tylko górna część, 1 - obie, 2 - tylko dolna
+            double dmax = 0.0, zmax = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+                std::size_t c = perm[j];
+                ds[j] = d[c];
+                zs[j] = (c < m ? Z(m - 1, c) : sign * Z(m, c)) * invSqrt2;
+                type[j] = c < m ? 0 : 2;
+                dmax = std::max(dmax, std::abs(ds[j]));
+                zmax = std::max(zmax, std::abs(zs[j]));
+            }
+            const double tol = 8.0 * EPS * std::max(dmax, rho * zmax);
+
+            // Deflacja: małe z_j oraz pary bliskich d (obrót zerujący jedno z_j)
+            std::vector<std::size_t> kept, deflated;
+            std::size_t prev = n;
+            for (std::size_t j = 0; j < n; ++j) {
+                if (rho * std::abs(zs[j]) <= tol) {
+                    deflated.push_back(j);
+                    continue;
+                }
+                if (prev == n) {
+                    prev = j;
+                    continue;
+                }
+                double t = std::hypot(zs[prev], zs[j]);
+                double c = zs[j] / t, s = -zs[prev] / t;
+                if (std::abs((ds[j] - ds[prev]) * c * s) <= tol) {
+                    std::size_t cp = perm[prev], cj = perm[j];
+                    for (std::size_t r = 0; r < n; ++r) {
+                        double* zr = Z.row(r);
+                        double x = zr[cp], y = zr[cj];
+                        zr[cp] = c * x + s * y;
+                        zr[cj] = c * y - s * x;
+                    }
+                    if (type[prev] != type[j]) type[prev] = type[j] = 1;
+                    zs[j] = t;
+                    zs[prev] = 0.0;
+                    double dp = ds[prev] * c * c + ds[j] * s * s;
+                    ds[j] = ds[prev] * s * s + ds[j] * c * c;
+                    ds[prev] = dp;
+                    deflated.push_back(prev);
+                } else {
+                    kept.push_back(prev);
+                }
+                prev = j;
+            }
+            if (prev != n) kept.push_back(prev);
+
+            // Równanie sekularne dla nieodrzuconych składowych
+            const std::size_t K = kept.size();
+            std::vector<double> dl(K), zl(K), lambda(K);
+            double znorm = 0.0;
+            for (std::size_t i = 0; i < K; ++i) {
+                dl[i] = ds[kept[i]];
+                zl[i] = zs[kept[i]];
+                znorm += zl[i] * zl[i];
+            }
+            double rk = rho * znorm;
+            znorm = std::sqrt(znorm);
+            for (std::size_t i = 0; i < K; ++i) zl[i] /= znorm;
+
+            Matrix U(K, K);                     // U(i, j) = dl_j - lambda_i, potem wektory własne (wierszami)
+            forEachChunk(K, [&](std::size_t i0, std::size_t i1) {
+                for (std::size_t i = i0; i < i1; ++i) {
+                    lambda[i] = secularRoot(i, dl.data(), zl.data(), K, rk, U.row(i));
+                }
+            });
+
+            // Wektor z odtworzony z obliczonych wartości (Gu, Eisenstat):
+            // z_j^2 ~ -(dl_j - lambda_j) prod_{i != j} (dl_j - lambda_i) / (dl_j - dl_i)
+            std::vector<double> zhat(K);
+            forEachChunk(K, [&](std::size_t j0, std::size_t j1) {
+                for (std::size_t j = j0; j < j1; ++j) {
+                    double w = U(j, j);
+                    for (std::size_t i = 0; i < K; ++i) {
+                        if (i != j) w *= U(i, j) / (dl[j] - dl[i]);
+                    }
+                    zhat[j] = std::copysign(std::sqrt(std::max(-w, 0.0)), zl[j]);
+                }
+            });
+            forEachChunk(K, [&](std::size_t i0, std::size_t i1) {
+                for (std::size_t i = i0; i < i1; ++i) {
+                    double* u = U.row(i);
+                    double norm = 0.0;
+                    for (std::size_t j = 0; j < K; ++j) {
+                        u[j] = zhat[j] / u[j];
+                        norm += u[j] * u[j];
+                    }
+                    norm = 1.0 / std::sqrt(norm);
+                    for (std::size_t j = 0; j < K; ++j) u[j] *= norm;
+                }
+            });
+
+            // Kolumny Z: nieodrzucone pogrupowane [górne, mieszane, dolne], potem
+            // odrzucone. Wtedy górne wiersze wyniku zależą tylko od dwóch pierwszych
+            // grup, a dolne - od dwóch ostatnich.
+            std::vector<std::size_t> order;
+            order.reserve(K);
+            std::size_t groupEnd[3] = {0, 0, 0};
+            for (int t = 0; t < 3; ++t) {
+                for (std::size_t i = 0; i < K; ++i) {
+                    if (type[kept[i]] == t) order.push_back(i);
+                }
+                groupEnd[t] = order.size();
+            }
+            std::vector<std::size_t> columns(n);
+            for (std::size_t p = 0; p < K; ++p) columns[p] = perm[kept[order[p]]];
+            for (std::size_t p = 0; p < deflated.size(); ++p) columns[K + p] = perm[deflated[p]];
+            gatherColumns(Z, columns);
+            gatherColumns(U.view(), order);
+
+            Matrix R(n, K);
+            const std::size_t topCols = groupEnd[1], bottomFirst = groupEnd[0];
+            if (K > 0 && topCols > 0) {
+                gemm(Op::None, Op::Transpose, 1.0, Z.block(0, 0, m, topCols), U.block(0, 0, K, topCols),
+                     0.0, R.block(0, 0, m, K));
+            }
+            if (K > bottomFirst) {
+                gemm(Op::None, Op::Transpose, 1.0, Z.block(m, bottomFirst, n - m, K - bottomFirst),
+                     U.block(0, bottomFirst, K, K - bottomFirst), 0.0, R.block(m, 0, n - m, K));
+            }
+
+            // Wartości rosnąco; kolumna q wyniku to R(:, i) albo odrzucona kolumna Z
+            std::vector<double> all(n);
+            for (std::size_t p = 0; p < K; ++p) all[p] = lambda[p];
+            for (std::size_t p = 0; p < deflated.size(); ++p) all[K + p] = ds[deflated[p]];
+            std::vector<std::size_t> ranked = sortedOrder(all.data(), n);
+            for (std::size_t q = 0; q < n; ++q) d[q] = all[ranked[q]];
+            forEachChunk(n, [&](std::size_t r0, std::size_t r1) {
+                std::vector<double> buf(n);
+                for (std::size_t r = r0; r < r1; ++r) {
+                    double* zr = Z.row(r);
+                    const double* rr = R.row(r);
+                    for (std::size_t q = 0; q < n; ++q) {
+                        std::size_t src = ranked[q];
+                        buf[q] = src < K ? rr[src] : zr[src];
+                    }
+                    std::copy(buf.begin(), buf.end(), zr);
+                }
+            });
+        }
+
+        // Podział T = diag(T1', T2') + |beta| u u^T w wierszu m
+        void tear(double* d, const double* e, std::size_t m) {
+            double b = std::abs(e[m - 1]);
+            d[m - 1] -= b;
+            d[m] -= b;
+        }
+
+        // Z: blok n x n wypełniony zerami; wynik - wektory własne w kolumnach, d rosnąco
+        void divideSerial(double* d, const double* e, std::size_t n, MatrixView Z) {
+            if (n <= QL_MAX) {
+                for (std::size_t i = 0; i < n; ++i) Z(i, i) = 1.0;
+                std::vector<double> work(e, e + n - 1);
+                work.push_back(0.0);
+                implicitQL(d, work.data(), n, Z, true);
+                std::vector<std::size_t> order = sortedOrder(d, n);
+                std::vector<double> sorted(n);
+                for (std::size_t q = 0; q < n; ++q) sorted[q] = d[order[q]];
+                std::copy(sorted.begin(), sorted.end(), d);
+                gatherColumns(Z, order);
+                return;
+            }
+            std::size_t m = n / 2;
+            tear(d, e, m);
+            divideSerial(d, e, m, Z.block(0, 0, m, m));
+            divideSerial(d + m, e + m, n - m, Z.block(m, m, n - m, n - m));
+            mergeHalves(d, n, m, e[m - 1], Z);
+        }
+
+        void collectLeaves(double* d, const double* e, std::size_t offset, std::size_t n,
+                           std::vector<std::pair<std::size_t, std::size_t>>& leaves) {
+            if (n <= SERIAL_MAX) {
+                leaves.emplace_back(offset, n);
+                return;
+            }
+            std::size_t m = n / 2;
+            tear(d + offset, e + offset, m);
+            collectLeaves(d, e, offset, m, leaves);
+            collectLeaves(d, e, offset + m, n - m, leaves);
+        }
+
+        void mergeUp(double* d, const double* e, std::size_t offset, std::size_t n, MatrixView Z) {
+            if (n <= SERIAL_MAX) return;
+            std::size_t m = n / 2;
+            mergeUp(d, e, offset, m, Z);
+            mergeUp(d, e, offset + m, n - m, Z);
+            mergeHalves(d + offset, n, m, e[offset + m - 1], Z.block(offset, offset, n, n));
+        }
+
+        /*
+            Podproblemy do SERIAL_MAX (ten sam podział co w rekurencji) rozwiązywane
+            są równolegle, każdy przez jedno zadanie; większe łączenia wykonywane są
+            kolejno, z wielowątkowym gemm w środku.
+        */
+        void divideAndConquer(double* d, const double* e, std::size_t n, MatrixView Z) {
+            std::vector<std::pair<std::size_t, std::size_t>> leaves;
+            collectLeaves(d, e, 0, n, leaves);
+            parallelFor(static_cast<int>(leaves.size()), [&](int t) {
+                std::size_t offset = leaves[t].first, size = leaves[t].second;
+                divideSerial(d + offset, e + offset, size, Z.block(offset, offset, size, size));
+            });
+            mergeUp(d, e, 0, n, Z);
+        }
+
+        // ---- Bisekcja i odwrotna iteracja ----
+
+        struct SturmData {
+            const double* d;
+            std::vector<double> e2;
+            std::size_t n;
+            double pivmin;
+            double low, high;       // przedział Gerszgorina
+            double norm;
+        };
+
+        SturmData sturmData(const std::vector<double>& d, const std::vector<double>& e) {
+            SturmData s;
+            s.d = d.data();
+            s.n = d.size();
+            s.e2.resize(e.size());
+            double maxE2 = 1.0;
+            for (std::size_t i = 0; i < e.size(); ++i) {
+                s.e2[i] = e[i] * e[i];
+                maxE2 = std::max(maxE2, s.e2[i]);
+            }
+            s.pivmin = std::numeric_limits<double>::min() * maxE2;
+            s.low = std::numeric_limits<double>::infinity();
+            s.high = -s.low;
+            for (std::size_t i = 0; i < s.n; ++i) {
+                double radius = (i > 0 ? std::abs(e[i - 1]) : 0.0) + (i + 1 < s.n ? std::abs(e[i]) : 0.0);
+                s.low = std::min(s.low, d[i] - radius);
+                s.high = std::max(s.high, d[i] + radius);
+            }
+            s.norm = std::max(std::abs(s.low), std::abs(s.high));
+            double pad = 2.0 * EPS * s.norm * s.n + 2.0 * s.pivmin;
+            s.low -= pad;
+            s.high += pad;
+            return s;
+        }
+
+        // Liczba wartości własnych mniejszych od x
+        std::size_t sturmCount(const SturmData& s, double x) {
+            std::size_t count = 0;
+            double q = s.d[0] - x;
+            for (std::size_t i = 0;;) {
+                if (std::abs(q) < s.pivmin) q = -s.pivmin;
+                if (q < 0.0) ++count;
+                if (++i == s.n) break;
+                q = s.d[i] - x - s.e2[i - 1] / q;
+            }
+            return count;
+        }
+
+        double bisect(const SturmData& s, std::size_t index) {
+            double lo = s.low, hi = s.high;
+            const double atol = EPS * s.norm + s.pivmin;
+            for (int iter = 0; iter < BISECTION_MAX_ITERATIONS; ++iter) {
+                if (hi - lo <= std::max(atol, 2.0 * EPS * std::max(std::abs(lo), std::abs(hi)))) break;
+                double mid = 0.5 * (lo + hi);
+                if (sturmCount(s, mid) > index) hi = mid; else lo = mid;
+            }
+            return 0.5 * (lo + hi);
+        }
+
+        /*
+            Rozkład LU z częściowym wyborem T - shift I (jak dgttrf): dl - mnożniki,
+            dd - przekątna U, du, du2 - pierwsza i druga naddiagonala U.
+        */
+        struct TridiagonalLU {
+            std::vector<double> dl, dd, du, du2;
+            std::vector<char> swapped;
+
+            TridiagonalLU(const double* d, const std::vector<double>& e, std::size_t n, double shift, double tiny)
+                : dl(e), dd(n), du(e), du2(n, 0.0), swapped(n, 0) {
+                for (std::size_t i = 0; i < n; ++i) dd[i] = d[i] - shift;
+                for (std::size_t i = 0; i + 1 < n; ++i) {
+                    if (std::abs(dd[i]) >= std::abs(dl[i])) {
+                        if (dd[i] == 0.0) dd[i] = tiny;
+                        double f = dl[i] / dd[i];
+                        dl[i] = f;
+                        dd[i + 1] -= f * du[i];
+                    } else {
+                        double f = dd[i] / dl[i];
+                        dd[i] = dl[i];
+                        dl[i] = f;
+                        double t = du[i];
+                        du[i] = dd[i + 1];
+                        dd[i + 1] = t - f * dd[i + 1];
+                        if (i + 2 < n) {
+                            du2[i] = du[i + 1];
+                            du[i + 1] = -f * du[i + 1];
+                        }
+                        swapped[i] = 1;
+                    }
+                }
+                if (n > 0 && std::abs(dd[n - 1]) < tiny) dd[n - 1] = tiny;
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (std::abs(dd[i]) < tiny) dd[i] = std::copysign(tiny, dd[i]);
+                }
+            }
+
+            void solve(double* b) const {
+                std::size_t n = dd.size();
+                for (std::size_t i = 0; i + 1 < n; ++i) {
+                    if (swapped[i]) {
+                        double t = b[i];
+                        b[i] = b[i + 1];
+                        b[i + 1] = t - dl[i] * b[i];
+                    } else {
+                        b[i + 1] -= dl[i] * b[i];
+                    }
+                }
+                for (std::size_t i = n; i-- > 0;) {
+                    double s = b[i];
+                    if (i + 1 < n) s -= du[i] * b[i + 1];
+                    if (i + 2 < n) s -= du2[i] * b[i + 2];
+                    b[i] = s / dd[i];
+                }
+            }
+        };
+
+        void normalize(double* x, std::size_t n) {
+            double s = std::sqrt(simd::dot(n, x, x));
+            if (s > 0.0) {
+                s = 1.0 / s;
+                for (std::size_t i = 0; i < n; ++i) x[i] *= s;
+            }
+        }
+
+        /*
+            Wartości o numerach first..last-1 bisekcją, wektory odwrotną iteracją.
+            Wektory z jednego skupiska liczone są przez jedno zadanie i ortogonalizowane
+            (dwukrotny Gram-Schmidt) względem poprzednich wektorów skupiska.
+        */
+        EigenDecomposition bisectionEigen(const std::vector<double>& d, const std::vector<double>& e,
+                                          std::size_t first, std::size_t last, bool computeVectors) {
+            EigenDecomposition result;
+            if (last <= first) return result;
+            std::size_t count = last - first;
+            SturmData s = sturmData(d, e);
+            result.values.resize(count);
+            forEachChunk(count, [&](std::size_t j0, std::size_t j1) {
+                for (std::size_t j = j0; j < j1; ++j) result.values[j] = bisect(s, first + j);
+            });
+            if (!computeVectors) return result;
+
+            const std::size_t n = d.size();
+            const std::vector<double>& lambda = result.values;
+            std::vector<std::size_t> clusterStart{0};
+            for (std::size_t j = 1; j < count; ++j) {
+                if (lambda[j] - lambda[j - 1] > CLUSTER_GAP * s.norm) clusterStart.push_back(j);
+            }
+            clusterStart.push_back(count);
+
+            Matrix vt(count, n);                // wektory własne wierszami
+            const double tiny = EPS * std::max(s.norm, s.pivmin);
+            parallelFor(static_cast<int>(clusterStart.size() - 1), [&](int c) {
+                double previousShift = 0.0;
+                for (std::size_t j = clusterStart[c]; j < clusterStart[c + 1]; ++j) {
+                    // Równe wartości w skupisku dostają minimalnie różne przesunięcia
+                    double shift = lambda[j];
+                    double perturbation = 10.0 * EPS * std::max(std::abs(shift), s.norm * EPS);
+                    if (j > clusterStart[c] && shift - previousShift < perturbation) {
+                        shift = previousShift + perturbation;
+                    }
+                    previousShift = shift;
+                    TridiagonalLU lu(s.d, e, n, shift, tiny);
+
+                    double* x = vt.row(j);
+                    unsigned state = 12345u + 2654435761u * static_cast<unsigned>(first + j);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        state = state * 1103515245u + 12345u;
+                        x[i] = ((state >> 16) % 2000) / 1000.0 - 1.0;
+                    }
+                    normalize(x, n);
+                    for (int it = 0; it < INVERSE_ITERATIONS; ++it) {
+                        lu.solve(x);
+                        for (int pass = 0; pass < 2; ++pass) {
+                            for (std::size_t p = clusterStart[c]; p < j; ++p) {
+                                const double* y = vt.row(p);
+                                simd::axpy(n, -simd::dot(n, x, y), y, x);
+                            }
+                        }
+                        normalize(x, n);
+                    }
+                }
+            });
+
+            result.vectors = Matrix(n, count);
+            forEachChunk(n, [&](std::size_t r0, std::size_t r1) {
+                for (std::size_t r = r0; r < r1; ++r) {
+                    for (std::size_t j = 0; j < count; ++j) result.vectors(r, j) = vt(j, r);
+                }
+            });
+            return result;
+        }
+
+        void checkTridiagonal(const std::vector<double>& d, const std::vector<double>& e) {
+            if (d.empty() ? !e.empty() : e.size() + 1 != d.size()) {
+                throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+            }
+        }
+
+        // Wszystkie wartości (i wektory) dla d, e już sprawdzonych
+        EigenDecomposition fullTridiagonal(const std::vector<double>& d, const std::vector<double>& e,
+                                           bool computeVectors) {
+            EigenDecomposition result;
+            std::size_t n = d.size();
+            result.values = d;
+            if (n == 0) return result;
+            if (!computeVectors) {
+                std::vector<double> work(e);
+                work.push_back(0.0);
+                implicitQL(result.values.data(), work.data(), n, MatrixView(nullptr, 0, 0, 0), false);
+                std::sort(result.values.begin(), result.values.end());
+                return result;
+            }
+            result.vectors = Matrix(n, n);
+            divideAndConquer(result.values.data(), e.data(), n, result.vectors.view());
+            return result;
+        }
+
+        void checkSquare(ConstMatrixView A) {
+            if (A.rows() != A.cols()) {
+                throw std::invalid_argument("Macierz musi być kwadratowa");
+            }
+        }
+    }
+
+    Tridiagonalization::Tridiagonalization(ConstMatrixView A, int blockSize)
+        : Tridiagonalization(Matrix::copyOf(A), blockSize) {}
+
+    Tridiagonalization::Tridiagonalization(Matrix&& A, int blockSize)
+        : a(std::move(A)), block(blockSize) {
+        if (a.rows() != a.cols()) {
+            throw std::invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (blockSize <= 0) {
+            throw std::invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        reduce();
+    }
+
+    /*
+        Panel kolumn k0..k0+nbk-1 (dlatrd): przed wyznaczeniem odbicia kolumna k
+        poprawiana jest o wcześniejsze odbicia panelu, A(k+1:, k+1:) v liczone
+        jest na macierzy sprzed panelu i poprawiane o V (W^T v) + W (V^T v).
+        Pozostała część A nie jest zmieniana aż do końca panelu.
+    */
+    void Tridiagonalization::reduce() {
+        const std::size_t n = a.rows();
+        d.assign(n, 0.0);
+        e.assign(n > 0 ? n - 1 : 0, 0.0);
+        tau.assign(e.size(), 0.0);
+        if (n == 0) return;
+
+        const std::size_t nb = std::min<std::size_t>(block, std::max<std::size_t>(n - 1, 1));
+        Matrix vw(n, 2 * nb), wv(n, 2 * nb);       // [V W] oraz [W V] panelu
+        const std::size_t maxStripes = (n + SYMV_ROWS - 1) / SYMV_ROWS;
+        Matrix partial(maxStripes, n);             // sumy A^T v z dolnego trójkąta pasków
+        Matrix products(maxStripes, 2 * nb);       // sumy V^T v, W^T v pasków
+        std::vector<double> v(n), y(n), pv(nb), pw(nb);
+
+        for (std::size_t k0 = 0; k0 + 1 < n; k0 += nb) {
+            const std::size_t nbk = std::min(nb, n - 1 - k0);
+            for (std::size_t r = k0; r < n; ++r) std::fill(vw.row(r), vw.row(r) + 2 * nbk, 0.0);
+
+            for (std::size_t i = 0; i < nbk; ++i) {
+                const std::size_t k = k0 + i;
+                const double* vk = vw.row(k);
+                for (std::size_t r = k; r < n; ++r) {
+                    const double* vr = vw.row(r);
+                    double s = 0.0;
+                    for (std::size_t p = 0; p < i; ++p) s += vr[p] * vk[nbk + p] + vr[nbk + p] * vk[p];
+                    a(r, k) -= s;
+                }
+                d[k] = a(k, k);
+
+                // Odbicie zerujące a(k+2:, k)
+                double alpha = a(k + 1, k);
+                double xnorm = 0.0;
+                for (std::size_t r = k + 2; r < n; ++r) xnorm += a(r, k) * a(r, k);
+                double t = 0.0, beta = alpha;
+                if (xnorm > 0.0) {
+                    beta = -std::copysign(std::sqrt(alpha * alpha + xnorm), alpha);
+                    t = (beta - alpha) / beta;
+                    double scale = 1.0 / (alpha - beta);
+                    for (std::size_t r = k + 2; r < n; ++r) a(r, k) *= scale;
+                }
+                a(k + 1, k) = beta;
+                e[k] = beta;
+                tau[k] = t;
+                const std::size_t first = k + 1;
+                v[first] = 1.0;
+                for (std::size_t r = k + 2; r < n; ++r) v[r] = a(r, k);
+                for (std::size_t r = first; r < n; ++r) vw(r, i) = v[r];
+                if (t == 0.0) continue;
+
+                // y = A(first:, first:) v z dolnego trójkąta oraz V^T v, W^T v
+                const int stripes = static_cast<int>((n - first + SYMV_ROWS - 1) / SYMV_ROWS);
+                parallelFor(stripes, [&](int s) {
+                    std::size_t r0 = first + s * SYMV_ROWS, r1 = std::min(n, r0 + SYMV_ROWS);
+                    double* part = partial.row(s);
+                    double* prod = products.row(s);
+                    std::fill(part + first, part + r1, 0.0);
+                    std::fill(prod, prod + 2 * i, 0.0);
+                    for (std::size_t r = r0; r < r1; ++r) {
+                        const double* ar = a.row(r) + first;
+                        std::size_t len = r - first;
+                        y[r] = simd::dot(len, ar, v.data() + first) + a(r, r) * v[r];
+                        simd::axpy(len, v[r], ar, part + first);
+                        const double* vr = vw.row(r);
+                        for (std::size_t p = 0; p < i; ++p) {
+                            prod[p] += vr[p] * v[r];
+                            prod[i + p] += vr[nbk + p] * v[r];
+                        }
+                    }
+                });
+                std::fill(pv.begin(), pv.end(), 0.0);
+                std::fill(pw.begin(), pw.end(), 0.0);
+                for (int s = 0; s < stripes; ++s) {
+                    std::size_t r1 = std::min(n, first + (s + 1) * SYMV_ROWS);
+                    const double* part = partial.row(s);
+                    const double* prod = products.row(s);
+                    for (std::size_t c = first; c < r1; ++c) y[c] += part[c];
+                    for (std::size_t p = 0; p < i; ++p) {
+                        pv[p] += prod[p];
+                        pw[p] += prod[i + p];
+                    }
+                }
+
+                // w = tau (y - V W^T v - W V^T v), w += -tau/2 (w^T v) v
+                double vy = 0.0;
+                for (std::size_t r = first; r < n; ++r) {
+                    const double* vr = vw.row(r);
+                    double s = 0.0;
+                    for (std::size_t p = 0; p < i; ++p) s += vr[p] * pw[p] + vr[nbk + p] * pv[p];
+                    y[r] = t * (y[r] - s);
+                    vy += y[r] * v[r];
+                }
+                double alpha2 = -0.5 * t * vy;
+                for (std::size_t r = first; r < n; ++r) vw(r, nbk + i) = y[r] + alpha2 * v[r];
+            }
+
+            // A(j1:, j1:) -= V W^T + W V^T = [V W] [W V]^T, tylko dolny trójkąt (pasami kolumn)
+            const std::size_t j1 = k0 + nbk;
+            for (std::size_t r = j1; r < n; ++r) {
+                const double* src = vw.row(r);
+                double* dst = wv.row(r);
+                std::copy(src + nbk, src + 2 * nbk, dst);
+                std::copy(src, src + nbk, dst + nbk);
+            }
+            for (std::size_t c0 = j1; c0 < n; c0 += UPDATE_COLS) {
+                std::size_t width = std::min(UPDATE_COLS, n - c0);
+                gemm(Op::None, Op::Transpose, -1.0, vw.block(c0, 0, n - c0, 2 * nbk),
+                     wv.block(c0, 0, width, 2 * nbk), 1.0, a.block(c0, c0, n - c0, width));
+            }
+        }
+        d[n - 1] = a(n - 1, n - 1);
+    }
+
+    void Tridiagonalization::applyQ(MatrixView Z) const {
+        const std::size_t n = size();
+        if (Z.rows() != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy");
+        }
+        if (n < 2 || Z.cols() == 0) return;
+        const std::size_t reflectors = n - 1, m = Z.cols();
+        const std::size_t nb = std::min<std::size_t>(block, reflectors);
+        Matrix V(n - 1, nb), T(nb, nb), W(nb, m), TW(nb, m);
+
+        // Bloki H_k0 ... H_k0+nbk-1 = I - V T V^T od ostatniego do pierwszego
+        for (std::size_t k0 = (reflectors - 1) / nb * nb;; k0 -= nb) {
+            const std::size_t nbk = std::min(nb, reflectors - k0);
+            const std::size_t rows = n - 1 - k0;  // wiersze k0+1 .. n-1
+            for (std::size_t q = 0; q < rows; ++q) {
+                std::size_t r = k0 + 1 + q;
+                for (std::size_t j = 0; j < nbk; ++j) {
+                    std::size_t k = k0 + j;
+                    V(q, j) = r < k + 1 ? 0.0 : (r == k + 1 ? 1.0 : a(r, k));
+                }
+            }
+            for (std::size_t j = 0; j < nbk; ++j) {
+                // T(0:j, j) = -tau_j T(0:j, 0:j) V(:, 0:j)^T v_j
+                std::vector<double> s(j, 0.0);
+                for (std::size_t q = j; q < rows; ++q) {
+                    for (std::size_t p = 0; p < j; ++p) s[p] += V(q, p) * V(q, j);
+                }
+                double tj = tau[k0 + j];
+                for (std::size_t p = 0; p < j; ++p) {
+                    double sum = 0.0;
+                    for (std::size_t l = p; l < j; ++l) sum += T(p, l) * s[l];
+                    T(p, j) = -tj * sum;
+                }
+                T(j, j) = tj;
+            }
+            ConstMatrixView Vb = V.block(0, 0, rows, nbk);
+            MatrixView Zb = Z.block(k0 + 1, 0, rows, m);
+            gemm(Op::Transpose, Op::None, 1.0, Vb, Zb, 0.0, W.block(0, 0, nbk, m));
+            for (std::size_t p = 0; p < nbk; ++p) {
+                double* out = TW.row(p);
+                std::fill(out, out + m, 0.0);
+                for (std::size_t l = p; l < nbk; ++l) simd::axpy(m, T(p, l), W.row(l), out);
+            }
+            gemm(Op::None, Op::None, -1.0, Vb, TW.block(0, 0, nbk, m), 1.0, Zb);
+            if (k0 == 0) break;
+        }
+    }
+
+    Matrix Tridiagonalization::Q() const {
+        Matrix q = Matrix::identity(size());
+        applyQ(q.view());
+        return q;
+    }
+
+    EigenDecomposition TridiagonalEigen(const std::vector<double>& d, const std::vector<double>& e,
+                                        bool computeVectors) {
+        checkTridiagonal(d, e);
+        return fullTridiagonal(d, e, computeVectors);
+    }
+
+    EigenDecomposition TridiagonalEigenRange(const std::vector<double>& d, const std::vector<double>& e,
+                                             double lower, double upper, bool computeVectors) {
+        checkTridiagonal(d, e);
+        if (!(lower <= upper)) {
+            throw std::invalid_argument("Nieprawidłowy przedział");
+        }
+        if (d.empty()) return {};
+        SturmData s = sturmData(d, e);
+        return bisectionEigen(d, e, sturmCount(s, lower), sturmCount(s, upper), computeVectors);
+    }
+
+    EigenDecomposition SymmetricEigen(ConstMatrixView A, bool computeVectors) {
+        checkSquare(A);
+        Tridiagonalization tri(A);
+        EigenDecomposition result = fullTridiagonal(tri.diagonal(), tri.offDiagonal(), computeVectors);
+        if (computeVectors) tri.applyQ(result.vectors.view());
+        return result;
+    }
+
+    EigenDecomposition SymmetricEigenRange(ConstMatrixView A, double lower, double upper, bool computeVectors) {
+        checkSquare(A);
+        if (!(lower <= upper)) {
+            throw std::invalid_argument("Nieprawidłowy przedział");
+        }
+        Tridiagonalization tri(A);
+        EigenDecomposition result = TridiagonalEigenRange(tri.diagonal(), tri.offDiagonal(), lower, upper,
+                                                          computeVectors);
+        if (computeVectors && !result.values.empty()) tri.applyQ(result.vectors.view());
+        return result;
+    }
+
+    EigenDecomposition SymmetricEigenIndex(ConstMatrixView A, std::size_t first, std::size_t last,
+                                           bool computeVectors) {
+        checkSquare(A);
+        if (first > last || last >= A.rows()) {
+            throw std::invalid_argument("Nieprawidłowy zakres numerów wartości własnych");
+        }
+        Tridiagonalization tri(A);
+        EigenDecomposition result = bisectionEigen(tri.diagonal(), tri.offDiagonal(), first, last + 1,
+                                                   computeVectors);
+        if (computeVectors) tri.applyQ(result.vectors.view());
+        return result;
+    }
+
+} // namespace numlib
@@ -0,0 +1,730 @@
+#include "../include/numlib/WartosciWlasneRzadkie.h"
+#include "../include/numlib/WartosciWlasne.h"
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace numlib {
+
+    namespace {
+        using Complex = std::complex<double>;
+
+        // Pasek wektora przetwarzany przez jedno zadanie w ortogonalizacji
+        const std::size_t STRIPE = 16384;
+        const int MAX_QR_ITERATIONS = 30;
+        const int INVERSE_ITERATIONS = 2;
+
+        int stripeCount(std::size_t n) {
+            return static_cast<int>(std::max<std::size_t>(1, (n + STRIPE - 1) / STRIPE));
+        }
+
+        /*
+            Rozkład Arnoldiego A V_m = V_m H_m + beta v_m e_m^T.
+            Wektory bazy to wiersze V ((m + 1) x n), wiersz m to v_m.
+            W trybie symetrycznym H utrzymywana jest jako trójdiagonalna.
+        */
+        class KrylovFactorization {
+        private:
+            const LinearOperator& op;
+            std::size_t n, m;
+            bool symmetric;
+            std::vector<double> x, y, h, h2;
+            Matrix partial;                 // sumy częściowe iloczynów skalarnych (pasek x wektor)
+            Matrix restartBuffer;           // (k + 1) x n
+            unsigned seed = 12345u;
+
+            void orthogonalize(std::size_t count, std::vector<double>& w, std::vector<double>& coefficients);
+            void project(std::size_t count, const double* w, double* out);
+            void subtract(std::size_t count, const double* coefficients, double* w);
+            double norm(const double* w);
+            void randomVector(double* w);
+
+        public:
+            Matrix V, H;
+            double beta = 0.0;
+            int operations = 0;
+
+            KrylovFactorization(const LinearOperator& A, std::size_t size, std::size_t subspace, bool isSymmetric,
+                                const std::vector<double>& start);
+
+            void extend(std::size_t from);
+            void applyShift(double mu, Matrix& Q);
+            void applyDoubleShift(Complex mu, Matrix& Q);
+            void truncate(const Matrix& Q, std::size_t k);
+            Matrix ritzVectors(ConstMatrixView Y) const;
+        };
+
+        KrylovFactorization::KrylovFactorization(const LinearOperator& A, std::size_t size, std::size_t subspace,
+                                                 bool isSymmetric, const std::vector<double>& start)
+            : op(A), n(size), m(subspace), symmetric(isSymmetric), x(size), y(size), h(subspace + 1),
+              h2(subspace + 1), partial(stripeCount(size), subspace + 1), V(subspace + 1, size),
+              H(subspace, subspace) {
+            double* v0 = V.row(0);
+            if (start.empty()) {
+                randomVector(v0);
+            } else {
+                if (start.size() != n) {
+                    throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+                }
+                std::copy(start.begin(), start.end(), v0);
+            }
+            double s = norm(v0);
+            if (s == 0.0) {
+                throw std::invalid_argument("Wektor startowy nie może być zerowy");
+            }
+            for (std::size_t i = 0; i < n; i++) v0[i] /= s;
+        }
+
+        void KrylovFactorization::randomVector(double* w) {
+            for (std::size_t i = 0; i < n; i++) {
+                seed = seed * 1103515245u + 12345u;
+                w[i] = (seed >> 8) / 8388608.0 - 1.0;
+            }
+        }
+
+        // out[i] = <V_i, w> dla i < count; sumy pasków w stałej kolejności
+        void KrylovFactorization::project(std::size_t count, const double* w, double* out) {
+            int stripes = stripeCount(n);
+            parallelFor(stripes, [&](int s) {
+                std::size_t lo = static_cast<std::size_t>(s) * STRIPE;
+                std::size_t len = std::min(STRIPE, n - lo);
+                for (std::size_t i = 0; i < count; i++) {
+                    partial(s, i) = simd::dot(len, V.row(i) + lo, w + lo);
+                }
+            });
+            for (std::size_t i = 0; i < count; i++) {
+                double sum = 0.0;
+                for (int s = 0; s < stripes; s++) sum += partial(s, i);
+                out[i] = sum;
+            }
+        }
+
+        // w -= sum coefficients[i] V_i
+        void KrylovFactorization::subtract(std::size_t count, const double* coefficients, double* w) {
+            parallelFor(stripeCount(n), [&](int s) {
+                std::size_t lo = static_cast<std::size_t>(s) * STRIPE;
+                std::size_t len = std::min(STRIPE, n - lo);
+                for (std::size_t i = 0; i < count; i++) {
+                    simd::axpy(len, -coefficients[i], V.row(i) + lo, w + lo);
+                }
+            });
+        }
+
+        double KrylovFactorization::norm(const double* w) {
+            int stripes = stripeCount(n);
+            parallelFor(stripes, [&](int s) {
+                std::size_t lo = static_cast<std::size_t>(s) * STRIPE;
+                std::size_t len = std::min(STRIPE, n - lo);
+                partial(s, 0) = simd::dot(len, w + lo, w + lo);
+            });
+            double sum = 0.0;
+            for (int s = 0; s < stripes; s++) sum += partial(s, 0);
+            return std::sqrt(sum);
+        }
+
+        // Dwukrotny klasyczny Gram-Schmidt względem wierszy 0..count-1
+        void KrylovFactorization::orthogonalize(std::size_t count, std::vector<double>& w,
+                                                std::vector<double>& coefficients) {
+            project(count, w.data(), coefficients.data());
+            subtract(count, coefficients.data(), w.data());
+            project(count, w.data(), h2.data());
+            subtract(count, h2.data(), w.data());
+            for (std::size_t i = 0; i < count; i++) coefficients[i] += h2[i];
+        }
+
+        // Kroki from..m-1; wiersz from bazy musi być już ustawiony
+        void KrylovFactorization::extend(std::size_t from) {
+            for (std::size_t j = from; j < m; j++) {
+                std::copy(V.row(j), V.row(j) + n, x.begin());
+                op(x, y);
+                operations++;
+                if (y.size() != n) {
+                    throw std::invalid_argument("Nieprawidłowe wymiary wektora");
+                }
+                orthogonalize(j + 1, y, h);
+                double b = norm(y.data());
+                double hn = std::sqrt(std::inner_product(h.begin(), h.begin() + j + 1, h.begin(), 0.0));
+
+                if (symmetric) {
+                    H(j, j) = h[j];
+                } else {
+                    for (std::size_t i = 0; i <= j; i++) H(i, j) = h[i];
+                }
+
+                if (b <= 1e-12 * hn || b == 0.0) {
+                    // Podprzestrzeń niezmiennicza - kontynuacja od wektora ortogonalnego do bazy
+                    b = 0.0;
+                    randomVector(y.data());
+                    orthogonalize(j + 1, y, h);
+                    double s = norm(y.data());
+                    if (s > 0.0) {
+                        for (std::size_t i = 0; i < n; i++) y[i] /= s;
+                    }
+                } else {
+                    for (std::size_t i = 0; i < n; i++) y[i] /= b;
+                }
+                std::copy(y.begin(), y.end(), V.row(j + 1));
+                if (j + 1 < m) {
+                    H(j + 1, j) = b;
+                    if (symmetric) H(j, j + 1) = b;
+                } else {
+                    beta = b;
+                }
+            }
+        }
+
+        // Krok QR z przesunięciem: H := G^T H G, Q := Q G (obroty Givensa z rozkładu H - mu I)
+        void KrylovFactorization::applyShift(double mu, Matrix& Q) {
+            Matrix M = Matrix::copyOf(H.view());
+            for (std::size_t i = 0; i < m; i++) M(i, i) -= mu;
+            for (std::size_t i = 0; i + 1 < m; i++) {
+                double a = M(i, i), b = M(i + 1, i);
+                double r = std::hypot(a, b);
+                double c = 1.0, s = 0.0;
+                if (r != 0.0) {
+                    c = a / r;
+                    s = b / r;
+                }
+                for (std::size_t j = i; j < m; j++) {
+                    double p = M(i, j), q = M(i + 1, j);
+                    M(i, j) = c * p + s * q;
+                    M(i + 1, j) = -s * p + c * q;
+                }
+                for (std::size_t j = 0; j < m; j++) {
+                    double p = H(i, j), q = H(i + 1, j);
+                    H(i, j) = c * p + s * q;
+                    H(i + 1, j) = -s * p + c * q;
+                }
+                for (std::size_t j = 0; j < m; j++) {
+                    double p = H(j, i), q = H(j, i + 1);
+                    H(j, i) = c * p + s * q;
+                    H(j, i + 1) = -s * p + c * q;
+                    p = Q(j, i);
+                    q = Q(j, i + 1);
+                    Q(j, i) = c * p + s * q;
+                    Q(j, i + 1) = -s * p + c * q;
+                }
+            }
+        }
+
+        // Krok QR z parą sprzężonych przesunięć: rozkład H^2 - 2 Re(mu) H + |mu|^2 I odbiciami 3 x 3
+        void KrylovFactorization::applyDoubleShift(Complex mu, Matrix& Q) {
+            double s = 2.0 * mu.real(), t = std::norm(mu);
+            Matrix M(m, m);
+            for (std::size_t i = 0; i < m; i++) {
+                for (std::size_t j = 0; j < m; j++) {
+                    double sum = 0.0;
+                    std::size_t lo = i > 0 ? i - 1 : 0, hi = std::min(j + 1, m - 1);
+                    for (std::size_t l = lo; l <= hi; l++) sum += H(i, l) * H(l, j);
+                    M(i, j) = sum - s * H(i, j);
+                }
+                M(i, i) += t;
+            }
+            for (std::size_t i = 0; i + 1 < m; i++) {
+                std::size_t len = std::min<std::size_t>(3, m - i);
+                double v[3] = {M(i, i), M(i + 1, i), len == 3 ? M(i + 2, i) : 0.0};
+                double alpha = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+                if (alpha == 0.0) continue;
+                v[0] += std::copysign(alpha, v[0]);
+                double vv = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+                // P = I - 2 v v^T / v^T v
+                auto reflectRows = [&](Matrix& X, std::size_t from) {
+                    for (std::size_t j = from; j < m; j++) {
+                        double dotv = 0.0;
+                        for (std::size_t l = 0; l < len; l++) dotv += v[l] * X(i + l, j);
+                        dotv *= 2.0 / vv;
+                        for (std::size_t l = 0; l < len; l++) X(i + l, j) -= dotv * v[l];
+                    }
+                };
+                auto reflectColumns = [&](Matrix& X) {
+                    for (std::size_t j = 0; j < m; j++) {
+                        double dotv = 0.0;
+                        for (std::size_t l = 0; l < len; l++) dotv += X(j, i + l) * v[l];
+                        dotv *= 2.0 / vv;
+                        for (std::size_t l = 0; l < len; l++) X(j, i + l) -= dotv * v[l];
+                    }
+                };
+                reflectRows(M, i);
+                reflectRows(H, 0);
+                reflectColumns(H);
+                reflectColumns(Q);
+            }
+        }
+
+        /*
+            Skrócenie rozkładu do k kroków po przesunięciach zebranych w Q:
+            V_k := V_m Q(:, 0:k), f := (V_m Q)_k H(k, k-1) + v_m beta Q(m-1, k-1).
+            Pierwsze k - 1 elementów ostatniego wiersza Q jest zerowych.
+        */
+        void KrylovFactorization::truncate(const Matrix& Q, std::size_t k) {
+            if (restartBuffer.rows() != k + 1) restartBuffer = Matrix(k + 1, n);
+            gemm(Op::Transpose, Op::None, 1.0, Q.block(0, 0, m, k + 1), V.block(0, 0, m, n), 0.0,
+                 restartBuffer.view());
+            double hk = H(k, k - 1), sigma = beta * Q(m - 1, k - 1);
+            double* f = restartBuffer.row(k);
+            const double* vm = V.row(m);
+            parallelFor(stripeCount(n), [&](int s) {
+                std::size_t lo = static_cast<std::size_t>(s) * STRIPE;
+                std::size_t hi = std::min(n, lo + STRIPE);
+                for (std::size_t i = lo; i < hi; i++) f[i] = hk * f[i] + sigma * vm[i];
+            });
+            for (std::size_t i = 0; i < k; i++) {
+                std::copy(restartBuffer.row(i), restartBuffer.row(i) + n, V.row(i));
+            }
+            std::copy(f, f + n, y.begin());
+            // f jest w dokładnej arytmetyce ortogonalny do V_k - ponowna ortogonalizacja usuwa błędy zaokrągleń
+            orthogonalize(k, y, h);
+            double b = norm(y.data());
+
+            for (std::size_t i = 0; i < m; i++) {
+                for (std::size_t j = 0; j < m; j++) {
+                    bool keep = i < k && j < k && (symmetric ? (i + 1 >= j && j + 1 >= i) : i <= j + 1);
+                    if (!keep) H(i, j) = 0.0;
+                }
+            }
+            if (symmetric) {
+                for (std::size_t i = 0; i + 1 < k; i++) H(i, i + 1) = H(i + 1, i);
+            }
+
+            if (b == 0.0) {
+                randomVector(y.data());
+                orthogonalize(k, y, h);
+                double s = norm(y.data());
+                for (std::size_t i = 0; i < n; i++) y[i] /= s;
+            } else {
+                for (std::size_t i = 0; i < n; i++) y[i] /= b;
+            }
+            std::copy(y.begin(), y.end(), V.row(k));
+            H(k, k - 1) = b;
+            if (symmetric) H(k - 1, k) = b;
+        }
+
+        // X = V_m^T Y (n x cols)
+        Matrix KrylovFactorization::ritzVectors(ConstMatrixView Y) const {
+            Matrix X(n, Y.cols());
+            gemm(Op::Transpose, Op::None, 1.0, V.block(0, 0, m, n), Y, 0.0, X.view());
+            return X;
+        }
+
+        /*
+            Wartości własne macierzy górnej Hessenberga - metoda QR Francisa
+            z podwójnym przesunięciem (hqr z EISPACK). Pary sprzężone zwracane
+            są kolejno, wartości rzeczywiste mają część urojoną równą 0.
+        */
+        std::vector<Complex> hessenbergEigenvalues(Matrix h) {
+            int n = static_cast<int>(h.rows());
+            auto a = [&h](int i, int j) -> double& { return h(i - 1, j - 1); };
+            std::vector<double> wr(n + 1), wi(n + 1);
+            double anorm = 0.0;
+            for (int i = 1; i <= n; i++) {
+                for (int j = std::max(i - 1, 1); j <= n; j++) anorm += std::abs(a(i, j));
+            }
+            int nn = n, l = 1;
+            double t = 0.0, p = 0.0, q = 0.0, r = 0.0, s = 0.0, w = 0.0, x = 0.0, y = 0.0, z = 0.0;
+            while (nn >= 1) {
+                int its = 0;
+                do {
+                    for (l = nn; l >= 2; l--) {
+                        s = std::abs(a(l - 1, l - 1)) + std::abs(a(l, l));
+                        if (s == 0.0) s = anorm;
+                        if (std::abs(a(l, l - 1)) + s == s) {
+                            a(l, l - 1) = 0.0;
+                            break;
+                        }
+                    }
+                    x = a(nn, nn);
+                    if (l == nn) {
+                        wr[nn] = x + t;
+                        wi[nn--] = 0.0;
+                    } else {
+                        y = a(nn - 1, nn - 1);
+                        w = a(nn, nn - 1) * a(nn - 1, nn);
+                        if (l == nn - 1) {
+                            p = 0.5 * (y - x);
+                            q = p * p + w;
+                            z = std::sqrt(std::abs(q));
+                            x += t;
+                            if (q >= 0.0) {
+                                z = p + std::copysign(z, p);
+                                wr[nn - 1] = wr[nn] = x + z;
+                                if (z != 0.0) wr[nn] = x - w / z;
+                                wi[nn - 1] = wi[nn] = 0.0;
+                            } else {
+                                wr[nn - 1] = wr[nn] = x + p;
+                                wi[nn - 1] = z;
+                                wi[nn] = -z;
+                            }
+                            nn -= 2;
+                        } else {
+                            if (its == MAX_QR_ITERATIONS) {
+                                throw std::runtime_error("Metoda QR nie osiągnęła zbieżności");
+                            }
+                            if (its == 10 || its == 20) {
+                                // Przesunięcie wyjątkowe
+                                t += x;
+                                for (int i = 1; i <= nn; i++) a(i, i) -= x;
+                                s = std::abs(a(nn, nn - 1)) + std::abs(a(nn - 1, nn - 2));
+                                y = x = 0.75 * s;
+                                w = -0.4375 * s * s;
+                            }
+                            ++its;
+                            int mm;
+                            for (mm = nn - 2; mm >= l; mm--) {
+                                z = a(mm, mm);
+                                r = x - z;
+                                s = y - z;
+                                p = (r * s - w) / a(mm + 1, mm) + a(mm, mm + 1);
+                                q = a(mm + 1, mm + 1) - z - r - s;
+                                r = a(mm + 2, mm + 1);
+                                s = std::abs(p) + std::abs(q) + std::abs(r);
+                                p /= s;
+                                q /= s;
+                                r /= s;
+                                if (mm == l) break;
+                                double u = std::abs(a(mm, mm - 1)) * (std::abs(q) + std::abs(r));
+                                double v = std::abs(p) * (std::abs(a(mm - 1, mm - 1)) + std::abs(z) +
+                                                          std::abs(a(mm + 1, mm + 1)));
+                                if (u + v == v) break;
+                            }
+                            for (int i = mm + 2; i <= nn; i++) {
+                                a(i, i - 2) = 0.0;
+                                if (i != mm + 2) a(i, i - 3) = 0.0;
+                            }
+                            for (int k = mm; k <= nn - 1; k++) {
+                                if (k != mm) {
+                                    p = a(k, k - 1);
+                                    q = a(k + 1, k - 1);
+                                    r = 0.0;
+                                    if (k != nn - 1) r = a(k + 2, k - 1);
+                                    if ((x = std::abs(p) + std::abs(q) + std::abs(r)) != 0.0) {
+                                        p /= x;
+                                        q /= x;
+                                        r /= x;
+                                    }
+                                }
+                                if ((s = std::copysign(std::sqrt(p * p + q * q + r * r), p)) != 0.0) {
+                                    if (k == mm) {
+                                        if (l != mm) a(k, k - 1) = -a(k, k - 1);
+                                    } else {
+                                        a(k, k - 1) = -s * x;
+                                    }
+                                    p += s;
+                                    x = p / s;
+                                    y = q / s;
+                                    z = r / s;
+                                    q /= p;
+                                    r /= p;
+                                    for (int j = k; j <= nn; j++) {
+                                        p = a(k, j) + q * a(k + 1, j);
+                                        if (k != nn - 1) {
+                                            p += r * a(k + 2, j);
+                                            a(k + 2, j) -= p * z;
+                                        }
+                                        a(k + 1, j) -= p * y;
+                                        a(k, j) -= p * x;
+                                    }
+                                    int mmin = nn < k + 3 ? nn : k + 3;
+                                    for (int i = l; i <= mmin; i++) {
+                                        p = x * a(i, k) + y * a(i, k + 1);
+                                        if (k != nn - 1) {
+                                            p += z * a(i, k + 2);
+                                            a(i, k + 2) -= p * r;
+                                        }
+                                        a(i, k + 1) -= p * q;
+                                        a(i, k) -= p;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                } while (nn >= 1 && l < nn - 1);
+            }
+            std::vector<Complex> values(n);
+            for (int i = 0; i < n; i++) values[i] = Complex(wr[i + 1], wi[i + 1]);
+            return values;
+        }
+
+        /*
+            Wektor własny macierzy Hessenberga dla wartości lambda - odwrotna
+            iteracja z rozkładem LU (H - lambda I) z wyborem elementu głównego
+            spośród dwóch wierszy. Wynik ma normę 1, a jego największa składowa
+            jest rzeczywista i dodatnia.
+        */
+        std::vector<Complex> hessenbergEigenvector(const Matrix& H, Complex lambda) {
+            std::size_t m = H.rows();
+            double hnorm = 0.0;
+            for (std::size_t i = 0; i < m; i++) {
+                for (std::size_t j = 0; j < m; j++) hnorm = std::max(hnorm, std::abs(H(i, j)));
+            }
+            double tiny = std::numeric_limits<double>::epsilon() * std::max(hnorm, 1e-300);
+            std::vector<Complex> U(m * m), mult(m);
+            std::vector<char> swapped(m, 0);
+            for (std::size_t i = 0; i < m; i++) {
+                for (std::size_t j = 0; j < m; j++) U[i * m + j] = H(i, j);
+                U[i * m + i] -= lambda;
+            }
+            for (std::size_t k = 0; k + 1 < m; k++) {
+                if (std::abs(U[(k + 1) * m + k]) > std::abs(U[k * m + k])) {
+                    for (std::size_t j = k; j < m; j++) std::swap(U[k * m + j], U[(k + 1) * m + j]);
+                    swapped[k] = 1;
+                }
+                if (std::abs(U[k * m + k]) < tiny) U[k * m + k] = tiny;
+                mult[k] = U[(k + 1) * m + k] / U[k * m + k];
+                for (std::size_t j = k + 1; j < m; j++) U[(k + 1) * m + j] -= mult[k] * U[k * m + j];
+            }
+            if (std::abs(U[(m - 1) * m + m - 1]) < tiny) U[(m - 1) * m + m - 1] = tiny;
+
+            std::vector<Complex> v(m, Complex(1.0, 0.0));
+            for (int it = 0; it < INVERSE_ITERATIONS; it++) {
+                for (std::size_t k = 0; k + 1 < m; k++) {
+                    if (swapped[k]) std::swap(v[k], v[k + 1]);
+                    v[k + 1] -= mult[k] * v[k];
+                }
+                for (std::size_t i = m; i-- > 0;) {
+                    Complex sum = v[i];
+                    for (std::size_t j = i + 1; j < m; j++) sum -= U[i * m + j] * v[j];
+                    v[i] = sum / U[i * m + i];
+                }
+                double s = 0.0;
+                for (const Complex& c : v) s += std::norm(c);
+                s = std::sqrt(s);
+                for (Complex& c : v) c /= s;
+            }
+            std::size_t big = 0;
+            for (std::size_t i = 1; i < m; i++) {
+                if (std::abs(v[i]) > std::abs(v[big])) big = i;
+            }
+            Complex phase = std::conj(v[big]) / std::abs(v[big]);
+            for (Complex& c : v) c *= phase;
+            v[big] = std::abs(v[big]);
+            return v;
+        }
+
+        // Kolejność wartości - od najlepiej pasującej do celu; z pary sprzężonej najpierw Im > 0
+        std::vector<std::size_t> rank(const std::vector<Complex>& values, EigenTarget target) {
+            auto key = [target](const Complex& c) {
+                switch (target) {
+                    case EigenTarget::Largest: return -c.real();
+                    case EigenTarget::Smallest: return c.real();
+                    default: return -std::abs(c);
+                }
+            };
+            std::vector<std::size_t> order(values.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j) {
+                double ki = key(values[i]), kj = key(values[j]);
+                if (ki != kj) return ki < kj;
+                return values[i].imag() > values[j].imag();
+            });
+            return order;
+        }
+
+        bool isConverged(double estimate, double theta, double tolerance) {
+            static const double floor = std::pow(std::numeric_limits<double>::epsilon(), 2.0 / 3.0);
+            return estimate <= tolerance * std::max(std::abs(theta), floor);
+        }
+
+        std::size_t subspaceSize(std::size_t n, std::size_t nev, const KrylovEigenOptions& options,
+                                 std::size_t minimum) {
+            std::size_t m = options.subspace;
+            if (m == 0) m = std::min(n, std::max<std::size_t>(2 * nev + 1, 20));
+            if (m < minimum || m > n) {
+                throw std::invalid_argument("Nieprawidłowy wymiar podprzestrzeni");
+            }
+            return m;
+        }
+
+        LinearOperator wrap(const SparseMatrix& A) {
+            if (A.rows() != A.cols()) {
+                throw std::invalid_argument("Macierz musi być kwadratowa");
+            }
+            return [&A](const std::vector<double>& x, std::vector<double>& y) {
+                A.multiply(Span<const double>(x), Span<double>(y));
+            };
+        }
+
+        template <typename Factorization>
+        LinearOperator inverse(const Factorization& factorization) {
+            return [&factorization](const std::vector<double>& x, std::vector<double>& y) {
+                y = x;
+                factorization.solveInPlace(Span<double>(y));
+            };
+        }
+    }
+
+    SparseEigenResult Lanczos(const LinearOperator& A, std::size_t n, std::size_t nev,
+                              const KrylovEigenOptions& options) {
+        if (nev == 0 || nev >= n) {
+            throw std::invalid_argument("Nieprawidłowa liczba wartości własnych");
+        }
+        std::size_t m = subspaceSize(n, nev, options, nev + 1);
+        KrylovFactorization krylov(A, n, m, true, options.start);
+        krylov.extend(0);
+
+        SparseEigenResult result;
+        EigenDecomposition ritz;
+        std::vector<std::size_t> order;
+        std::vector<double> estimates(m);
+        for (int restart = 0;; restart++) {
+            ritz = SymmetricEigen(krylov.H);
+            std::vector<Complex> values(ritz.values.begin(), ritz.values.end());
+            order = rank(values, options.target);
+            std::size_t converged = 0;
+            for (std::size_t i = 0; i < m; i++) {
+                estimates[i] = std::abs(krylov.beta * ritz.vectors(m - 1, i));
+            }
+            for (std::size_t i = 0; i < nev; i++) {
+                if (isConverged(estimates[order[i]], ritz.values[order[i]], options.tolerance)) converged++;
+            }
+            result.restarts = restart;
+            result.converged = converged == nev;
+            if (result.converged || restart == options.maxRestarts) break;
+
+            // Zachowanie części zbieżnych nadmiarowych wektorów przyspiesza dalsze restarty (jak w ARPACK-u)
+            std::size_t k = std::min(m - 1, nev + std::min(converged, (m - nev) / 2));
+            Matrix Q = Matrix::identity(m);
+            for (std::size_t i = k; i < m; i++) krylov.applyShift(ritz.values[order[i]], Q);
+            krylov.truncate(Q, k);
+            krylov.extend(k);
+        }
+
+        Matrix Y(m, nev);
+        result.values.resize(nev);
+        result.residuals.resize(nev);
+        for (std::size_t j = 0; j < nev; j++) {
+            result.values[j] = ritz.values[order[j]];
+            result.residuals[j] = estimates[order[j]];
+            for (std::size_t i = 0; i < m; i++) Y(i, j) = ritz.vectors(i, order[j]);
+        }
+        result.vectors = krylov.ritzVectors(Y);
+        result.operations = krylov.operations;
+        return result;
+    }
+
+    SparseEigenResult Lanczos(const SparseMatrix& A, std::size_t nev, const KrylovEigenOptions& options) {
+        return Lanczos(wrap(A), A.rows(), nev, options);
+    }
+
+    SparseEigenResult LanczosShiftInvert(const LinearOperator& solve, std::size_t n, double sigma,
+                                         std::size_t nev, const KrylovEigenOptions& options) {
+        KrylovEigenOptions inverted = options;
+        inverted.target = EigenTarget::LargestMagnitude;
+        SparseEigenResult result = Lanczos(solve, n, nev, inverted);
+        for (double& value : result.values) value = sigma + 1.0 / value;
+        return result;
+    }
+
+    SparseEigenResult LanczosShiftInvert(const SparseLU& factorization, double sigma, std::size_t nev,
+                                         const KrylovEigenOptions& options) {
+        return LanczosShiftInvert(inverse(factorization), factorization.size(), sigma, nev, options);
+    }
+
+    SparseEigenResult LanczosShiftInvert(const SparseCholesky& factorization, double sigma, std::size_t nev,
+                                         const KrylovEigenOptions& options) {
+        return LanczosShiftInvert(inverse(factorization), factorization.size(), sigma, nev, options);
+    }
+
+    ArnoldiResult Arnoldi(const LinearOperator& A, std::size_t n, std::size_t nev,
+                          const KrylovEigenOptions& options) {
+        if (nev == 0 || nev + 1 >= n) {
+            throw std::invalid_argument("Nieprawidłowa liczba wartości własnych");
+        }
+        std::size_t m = subspaceSize(n, nev, options, nev + 2);
+        KrylovFactorization krylov(A, n, m, false, options.start);
+        krylov.extend(0);
+
+        ArnoldiResult result;
+        std::vector<Complex> values;
+        std::vector<std::size_t> order;
+        std::vector<std::vector<Complex>> vectors;
+        std::vector<double> estimates;
+        std::size_t wanted = nev;
+        for (int restart = 0;; restart++) {
+            values = hessenbergEigenvalues(krylov.H);
+            order = rank(values, options.target);
+            wanted = values[order[nev - 1]].imag() > 0.0 ? nev + 1 : nev;
+
+            vectors.assign(wanted, {});
+            estimates.assign(wanted, 0.0);
+            std::size_t converged = 0;
+            for (std::size_t i = 0; i < wanted; i++) {
+                vectors[i] = hessenbergEigenvector(krylov.H, values[order[i]]);
+                estimates[i] = krylov.beta * std::abs(vectors[i][m - 1]);
+                if (isConverged(estimates[i], std::abs(values[order[i]]), options.tolerance)) converged++;
+            }
+            result.restarts = restart;
+            result.converged = converged == wanted;
+            if (result.converged || restart == options.maxRestarts) break;
+
+            std::size_t k = std::min(m - 1, wanted + std::min(converged, (m - wanted) / 2));
+            if (values[order[k - 1]].imag() > 0.0) {
+                k = k + 1 < m ? k + 1 : k - 1;      // granica nie może rozdzielać pary sprzężonej
+            }
+            Matrix Q = Matrix::identity(m);
+            for (std::size_t i = k; i < m; i++) {
+                Complex mu = values[order[i]];
+                if (mu.imag() == 0.0) {
+                    krylov.applyShift(mu.real(), Q);
+                } else if (mu.imag() > 0.0) {
+                    krylov.applyDoubleShift(mu, Q);
+                }
+            }
+            krylov.truncate(Q, k);
+            krylov.extend(k);
+        }
+
+        Matrix Y(m, wanted);
+        result.values.resize(wanted);
+        result.residuals.resize(wanted);
+        for (std::size_t j = 0; j < wanted; j++) {
+            result.values[j] = values[order[j]];
+            result.residuals[j] = estimates[j];
+            if (result.values[j].imag() == 0.0) {
+                for (std::size_t i = 0; i < m; i++) Y(i, j) = vectors[j][i].real();
+            } else if (result.values[j].imag() > 0.0) {
+                for (std::size_t i = 0; i < m; i++) {
+                    Y(i, j) = vectors[j][i].real();
+                    if (j + 1 < wanted) Y(i, j + 1) = vectors[j][i].imag();
+                }
+            }
+        }
+        result.vectors = krylov.ritzVectors(Y);
+        result.operations = krylov.operations;
+        return result;
+    }
+
+    ArnoldiResult Arnoldi(const SparseMatrix& A, std::size_t nev, const KrylovEigenOptions& options) {
+        return Arnoldi(wrap(A), A.rows(), nev, options);
+    }
+
+    ArnoldiResult ArnoldiShiftInvert(const LinearOperator& solve, std::size_t n, double sigma,
+                                     std::size_t nev, const KrylovEigenOptions& options) {
+        KrylovEigenOptions inverted = options;
+        inverted.target = EigenTarget::LargestMagnitude;
+        ArnoldiResult result = Arnoldi(solve, n, nev, inverted);
+        for (std::size_t j = 0; j < result.values.size(); j++) {
+            result.values[j] = sigma + 1.0 / result.values[j];
+        }
+        // Odwrotność zmienia znak części urojonej - przywrócenie kolejności w parach
+        for (std::size_t j = 0; j + 1 < result.values.size(); j++) {
+            if (result.values[j].imag() < 0.0) {
+                std::swap(result.values[j], result.values[j + 1]);
+                for (std::size_t i = 0; i < n; i++) result.vectors(i, j + 1) = -result.vectors(i, j + 1);
+                j++;
+            }
+        }
+        return result;
+    }
+
+    ArnoldiResult ArnoldiShiftInvert(const SparseLU& factorization, double sigma, std::size_t nev,
+                                     const KrylovEigenOptions& options) {
+        return ArnoldiShiftInvert(inverse(factorization), factorization.size(), sigma, nev, options);
+    }
+
+} // namespace numlib
@@ -0,0 +1,172 @@
+#include "../include/numlib/Watki.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <exception>
+#include <stdexcept>
+
+namespace numlib {
+
+    namespace {
+
+        // Prosta pula wątków wykonująca jedno zadanie typu "parallel for" naraz.
+        // Wątek wywołujący również pobiera zadania, więc pula o rozmiarze n
+        // utrzymuje n - 1 wątków roboczych.
+        class ThreadPool {
+        public:
+            ThreadPool() {
+                unsigned hw = std::thread::hardware_concurrency();
+                resize(hw == 0 ? 1 : static_cast<int>(hw));
+            }
+
+            ~ThreadPool() {
+                stopWorkers();
+            }
+
+            // Bez blokady runMutex - wywoływane także z wnętrza zadań (np. przez gemm)
+            int size() const {
+                return threads.load();
+            }
+
+            void resize(int n) {
+                std::lock_guard<std::mutex> lock(runMutex);
+                stopWorkers();
+                quit = false;
+                for (int i = 1; i < n; ++i) {
+                    workers.emplace_back([this] { workerLoop(); });
+                }
+                threads.store(n);
+            }
+
+            void run(int count, const std::function<void(int)>& body) {
+                std::lock_guard<std::mutex> runLock(runMutex);
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    job = &body;
+                    jobCount = count;
+                    next.store(0);
+                    error = nullptr;
+                    ++generation;
+                }
+                cv.notify_all();
+
+                drain(body, count);
+
+                std::unique_lock<std::mutex> lock(m);
+                doneCv.wait(lock, [this] { return busy == 0; });
+                job = nullptr;
+                if (error) {
+                    std::exception_ptr e = error;
+                    error = nullptr;
+                    std::rethrow_exception(e);
+                }
+            }
+
+        private:
+            std::vector<std::thread> workers;
+            std::atomic<int> threads{1};
+            std::mutex runMutex;   // serializuje wywołania run() i resize()
+            std::mutex m;
+            std::condition_variable cv, doneCv;
+            const std::function<void(int)>* job = nullptr;
+            int jobCount = 0;
+            std::atomic<int> next{0};
+            unsigned long long generation = 0;
+            int busy = 0;
+            bool quit = false;
+            std::exception_ptr error;
+
+            void stopWorkers() {
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    quit = true;
+                }
+                cv.notify_all();
+                for (auto& t : workers) t.join();
+                workers.clear();
+            }
+
+            void drain(const std::function<void(int)>& body, int count) {
+                for (;;) {
+                    int i = next.fetch_add(1);
+                    if (i >= count) return;
+                    try {
+                        body(i);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(m);
+                        if (!error) error = std::current_exception();
+                        next.store(count);
+                    }
+                }
+            }
+
+            void workerLoop();
+        };
+
+        thread_local bool insideParallel = false;
+
+        void ThreadPool::workerLoop() {
+            insideParallel = true;
+            unsigned long long seen = 0;
+            for (;;) {
+                const std::function<void(int)>* body;
+                int count;
+                {
+                    std::unique_lock<std::mutex> lock(m);
+                    cv.wait(lock, [&] { return quit || generation != seen; });
+                    if (quit) return;
+                    seen = generation;
+                    if (job == nullptr) continue;
+                    body = job;
+                    count = jobCount;
+                    ++busy;
+                }
+                drain(*body, count);
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    --busy;
+                }
+                doneCv.notify_all();
+            }
+        }
+
+        ThreadPool& pool() {
+            static ThreadPool instance;
+            return instance;
+        }
+    }
+
+    void setNumThreads(int n) {
+        if (n < 0) {
+            throw std::invalid_argument("Liczba wątków nie może być ujemna");
+        }
+        if (n == 0) {
+            unsigned hw = std::thread::hardware_concurrency();
+            n = hw == 0 ? 1 : static_cast<int>(hw);
+        }
+        pool().resize(n);
+    }
+
+    int getNumThreads() {
+        return pool().size();
+    }
+
+    void parallelFor(int count, const std::function<void(int)>& body) {
+        if (count <= 0) return;
+        if (count == 1 || insideParallel || getNumThreads() == 1) {
+            for (int i = 0; i < count; ++i) body(i);
+            return;
+        }
+        insideParallel = true;
+        try {
+            pool().run(count, body);
+        } catch (...) {
+            insideParallel = false;
+            throw;
+        }
+        insideParallel = false;
+    }
+
+} // namespace numlib
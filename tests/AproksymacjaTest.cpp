@@ -391,6 +391,50 @@ public:
         }
     }
 
+    // Test 15: Dyskretna aproksymacja rozkładem QR - wielomian stopnia 10 na [0, 2]
+    // (macierz Vandermonde'a, dla której równania normalne tracą większość cyfr)
+    void test_discrete_approximation() {
+        try {
+            numlib::ContinuousLeastSquares approx(0.0, 2.0);
+            auto poly = [](double x) {
+                double result = 0.0;
+                for (int k = 10; k >= 0; --k) result = result * x + (k % 3 - 1);
+                return result;
+            };
+            approx.addFunction(poly, 200);
+            for (auto& basis_func : numlib::StandardBasis::polynomial(10)) {
+                approx.addBasisFunction(std::move(basis_func));
+            }
+
+            bool success = approx.approximateDiscrete();
+            bool coefficients_ok = success;
+            if (success) {
+                const auto& c = approx.getCoefficients();
+                for (int k = 0; k <= 10; ++k) {
+                    coefficients_ok = coefficients_ok && is_close(c[k], k % 3 - 1, 1e-6);
+                }
+            }
+            assert_test(coefficients_ok, "Discrete QR approximation of degree 10 polynomial");
+        } catch (...) {
+            assert_test(false, "Discrete QR approximation of degree 10 polynomial");
+        }
+    }
+
+    // Test 16: Uwarunkowanie macierzy Grama - dla bazy 1, x, x^2, x^3 na [0, 1]
+    // jest to macierz Hilberta 4 x 4 o wskaźniku uwarunkowania ok. 15514
+    void test_gram_condition_number() {
+        try {
+            numlib::ContinuousLeastSquares approx(0.0, 1.0);
+            for (auto& basis_func : numlib::StandardBasis::polynomial(3)) {
+                approx.addBasisFunction(std::move(basis_func));
+            }
+            double cond = approx.gramConditionNumber();
+            assert_test(std::abs(cond - 15513.7387) < 1e-2 * 15513.7387, "Gram matrix condition number");
+        } catch (...) {
+            assert_test(false, "Gram matrix condition number");
+        }
+    }
+
     void run_all_tests() {
         std::cout << "=== TESTY APROKSYMACJI CIĄGŁEJ ===" << std::endl;
         std::cout << std::endl;
@@ -409,6 +453,8 @@ public:
         test_error_cases();
         test_utility_methods();
         test_basis_cloning();
+        test_discrete_approximation();
+        test_gram_condition_number();
 
         std::cout << std::endl;
         std::cout << "=== PODSUMOWANIE ===" << std::endl;
@@ -0,0 +1,285 @@
+#include "../include/numlib/EksponentaMacierzy.h"
+#include "../include/numlib/WartosciWlasne.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+#include <limits>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+double maxDiff(numlib::ConstMatrixView A, numlib::ConstMatrixView B) {
+    double m = 0.0;
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t j = 0; j < A.cols(); j++) m = max(m, abs(A(i, j) - B(i, j)));
+    }
+    return m;
+}
+
+double relativeError(const vector<double>& x, const vector<double>& reference) {
+    double num = 0.0, den = 0.0;
+    for (size_t i = 0; i < x.size(); i++) {
+        num += (x[i] - reference[i]) * (x[i] - reference[i]);
+        den += reference[i] * reference[i];
+    }
+    return sqrt(num / den);
+}
+
+// Jawna postać macierzy rzadkiej
+numlib::Matrix dense(const numlib::SparseMatrix& A) {
+    numlib::Matrix D(A.rows(), A.cols());
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t p = A.rowPointers()[i]; p < A.rowPointers()[i + 1]; p++) {
+            D(i, A.columnIndices()[p]) = A.values()[p];
+        }
+    }
+    return D;
+}
+
+// Dyskretyzacja u_t = u_xx - c u_x na (0, 1) z warunkami Dirichleta
+numlib::SparseMatrix convectionDiffusion(size_t n, double c) {
+    double h = 1.0 / (n + 1);
+    numlib::CooBuilder builder(n, n);
+    for (size_t i = 0; i < n; i++) {
+        builder.add(i, i, -2.0 / (h * h));
+        if (i > 0) builder.add(i, i - 1, 1.0 / (h * h) + c / (2.0 * h));
+        if (i + 1 < n) builder.add(i, i + 1, 1.0 / (h * h) - c / (2.0 * h));
+    }
+    return builder.build();
+}
+
+vector<double> multiply(numlib::ConstMatrixView E, const vector<double>& v) {
+    vector<double> y(E.rows(), 0.0);
+    for (size_t i = 0; i < E.rows(); i++) {
+        for (size_t j = 0; j < E.cols(); j++) y[i] += E(i, j) * v[j];
+    }
+    return y;
+}
+
+// Test 1: expm dla macierzy o znanej eksponencie
+void ExpmTest1() {
+    // Obrót: e^{[[0, -a], [a, 0]]} = [[cos a, -sin a], [sin a, cos a]]
+    for (double a : {1e-3, 0.2, 1.5, 40.0}) {
+        numlib::Matrix R = numlib::Matrix::fromRows({{0.0, -a}, {a, 0.0}});
+        numlib::Matrix E = numlib::expm(R);
+        numlib::Matrix exact = numlib::Matrix::fromRows({{cos(a), -sin(a)}, {sin(a), cos(a)}});
+        assertTest(maxDiff(E, exact) < 1e-13 * max(1.0, a), "Błędna eksponenta macierzy obrotu");
+    }
+
+    // Klasyczny przykład Molera-Van Loana: wartości własne -1 i -17
+    numlib::Matrix A = numlib::Matrix::fromRows({{-49.0, 24.0}, {-64.0, 31.0}});
+    double e1 = exp(-1.0), e17 = exp(-17.0);
+    // A = V diag(-1, -17) V^-1, V = [[1, 3], [2, 4]], V^-1 = [[-2, 1.5], [1, -0.5]]
+    numlib::Matrix exact = numlib::Matrix::fromRows({{-2.0 * e1 + 3.0 * e17, 1.5 * e1 - 1.5 * e17},
+                                                     {-4.0 * e1 + 4.0 * e17, 3.0 * e1 - 2.0 * e17}});
+    assertTest(maxDiff(numlib::expm(A), exact) < 1e-12, "Błędna eksponenta dla przykładu Molera-Van Loana");
+
+    // Macierz nilpotentna (blok Jordana): szereg kończy się na N^3 / 6
+    numlib::Matrix N(4, 4);
+    N(0, 1) = N(1, 2) = N(2, 3) = 2.0;
+    numlib::Matrix EN = numlib::expm(N);
+    assertTest(abs(EN(0, 0) - 1.0) < 1e-15 && abs(EN(0, 1) - 2.0) < 1e-14 && abs(EN(0, 2) - 2.0) < 1e-14 &&
+               abs(EN(0, 3) - 8.0 / 6.0) < 1e-14 && abs(EN(3, 0)) < 1e-15, "Błędna eksponenta bloku Jordana");
+
+    assertTest(numlib::expm(numlib::Matrix(0, 0)).rows() == 0, "Błąd dla macierzy pustej");
+}
+
+// Test 2: expm macierzy symetrycznej - porównanie z V e^Lambda V^T
+void ExpmTest2() {
+    size_t n = 60;
+    for (double scale : {0.01, 1.0, 30.0}) {
+        numlib::Matrix A(n, n);
+        unsigned seed = 17;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j <= i; j++) {
+                seed = seed * 1103515245u + 12345u;
+                A(i, j) = A(j, i) = scale * ((seed >> 16) % 2001 / 1000.0 - 1.0) / sqrt(double(n));
+            }
+        }
+        numlib::EigenDecomposition eig = numlib::SymmetricEigen(A);
+        numlib::Matrix reference(n, n);
+        double largest = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                double s = 0.0;
+                for (size_t k = 0; k < n; k++) s += eig.vectors(i, k) * exp(eig.values[k]) * eig.vectors(j, k);
+                reference(i, j) = s;
+                largest = max(largest, abs(s));
+            }
+        }
+        numlib::Matrix E = numlib::expm(A);
+        assertTest(maxDiff(E, reference) < 1e-11 * largest, "expm niezgodna z rozkładem własnym");
+    }
+}
+
+// Test 3: expmMultiply dla macierzy rzadkiej - porównanie z gęstą expm
+void ExpmTest3() {
+    size_t n = 200;
+    for (double c : {0.0, 40.0}) {
+        numlib::SparseMatrix A = convectionDiffusion(n, c);
+        vector<double> v(n);
+        for (size_t i = 0; i < n; i++) v[i] = sin(3.1 * (i + 1.0) / (n + 1)) + (i % 7) * 0.01;
+        for (double t : {1e-4, 1e-2}) {
+            numlib::Matrix tA = dense(A);
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < n; j++) tA(i, j) *= t;
+            }
+            vector<double> reference = multiply(numlib::expm(tA), v);
+            vector<double> x = numlib::expmMultiply(A, v, t);
+            assertTest(relativeError(x, reference) < 1e-8, "expmMultiply niezgodny z expm");
+        }
+    }
+
+    // Ujemny czas: e^{-tA} e^{tA} v = v
+    numlib::SparseMatrix A = convectionDiffusion(50, 5.0);
+    vector<double> v(50, 1.0);
+    vector<double> forward = numlib::expmMultiply(A, v, 1e-3);
+    vector<double> back = numlib::expmMultiply(A, forward, -1e-3);
+    assertTest(relativeError(back, v) < 1e-8, "Ujemny czas nie odwraca eksponenty");
+
+    // Mała przestrzeń - Kryłow wyczerpuje ją i daje wynik dokładny
+    numlib::SparseMatrix small = convectionDiffusion(6, 1.0);
+    vector<double> s(6, 1.0);
+    vector<double> exact = multiply(numlib::expm(dense(small)), s);
+    assertTest(relativeError(numlib::expmMultiply(small, s, 1.0), exact) < 1e-12, "Błąd dla n < m");
+}
+
+// Test 4: wiele chwil z jednej bazy; operator bez jawnej macierzy
+void ExpmTest4() {
+    size_t n = 2000;
+    numlib::SparseMatrix A = convectionDiffusion(n, 10.0);
+    vector<double> v(n);
+    for (size_t i = 0; i < n; i++) v[i] = exp(-pow((i - 600.0) / 80.0, 2));
+
+    int calls = 0;
+    numlib::LinearOperator op = [&](const vector<double>& x, vector<double>& y) {
+        calls++;
+        A.multiply(numlib::Span<const double>(x), numlib::Span<double>(y));
+    };
+    vector<double> times;
+    for (int k = 0; k <= 50; k++) times.push_back(k * 2e-6);
+    numlib::Matrix all = numlib::expmMultiply(op, v, times);
+    int callsTogether = calls;
+
+    calls = 0;
+    double worst = 0.0;
+    for (size_t k = 0; k < times.size(); k++) {
+        // Odniesienie liczone z inną podprzestrzenią i tolerancją - inny ciąg kroków
+        vector<double> single = numlib::expmMultiply(op, v, times[k], 1e-13, 45);
+        vector<double> row(all.row(k), all.row(k) + n);
+        double error = relativeError(row, single);
+        assertTest(error == error, "NaN w wyniku");
+        worst = max(worst, error);
+    }
+    cout << "Wywołania operatora: razem " << callsTogether << ", osobno " << calls
+         << ", maks. różnica " << worst << endl;
+    assertTest(worst < 1e-8, "Wyniki dla wielu chwil różne od pojedynczych wywołań");
+    assertTest(callsTogether * 5 < calls, "Wiele chwil nie korzysta ze wspólnej bazy");
+    for (size_t i = 0; i < n; i++) {
+        assertTest(all(0, i) == v[i], "Dla t = 0 wynik powinien być równy v");
+    }
+}
+
+// Test 5: układ liniowy y' = A y - oscylator harmoniczny i porównanie z expm
+void ExpmTest5() {
+    numlib::Matrix A = numlib::Matrix::fromRows({{0.0, 1.0}, {-1.0, 0.0}});
+    auto result = numlib::LinearODE(A, {1.0, 0.0}, 0.0, 0.01, 1000);
+    assertTest(result.first.size() == 1001 && result.second.rows() == 1001, "Błędna liczba kroków");
+    double worst = 0.0;
+    for (size_t k = 0; k <= 1000; k++) {
+        double t = result.first[k];
+        worst = max(worst, abs(result.second(k, 0) - cos(t)));
+        worst = max(worst, abs(result.second(k, 1) + sin(t)));
+    }
+    assertTest(worst < 1e-12, "LinearODE niezgodne z rozwiązaniem dokładnym");
+}
+
+// Test 6: obsługa błędów
+void ExpmTest6() {
+    bool thrown = false;
+    try { numlib::expm(numlib::Matrix(2, 3)); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla macierzy niekwadratowej");
+
+    for (double bad : {std::nan(""), std::numeric_limits<double>::infinity()}) {
+        numlib::Matrix B = numlib::Matrix::identity(3);
+        B(1, 2) = bad;
+        thrown = false;
+        try { numlib::expm(B); } catch (const invalid_argument&) { thrown = true; }
+        assertTest(thrown, "Brak wyjątku dla macierzy z NaN/Inf");
+    }
+
+    numlib::SparseMatrix A = convectionDiffusion(10, 0.0);
+    thrown = false;
+    try { numlib::expmMultiply(A, vector<double>(9, 1.0), 1.0); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla złej długości wektora");
+
+    thrown = false;
+    try { numlib::expmMultiply(A, vector<double>(10, 1.0), vector<double>{0.5, 0.1}); }
+    catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla malejących chwil");
+
+    thrown = false;
+    try { numlib::expmMultiply(A, vector<double>(10, 1.0), 1.0, 1e-10, 0); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla zerowego wymiaru podprzestrzeni");
+
+    thrown = false;
+    try { numlib::LinearODE(numlib::Matrix::identity(2), {1.0}, 0.0, 0.1, 10); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla złego wymiaru warunku początkowego");
+
+    thrown = false;
+    try { numlib::LinearODE(numlib::Matrix::identity(2), {1.0, 1.0}, 0.0, -0.1, 10); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla ujemnego kroku");
+
+    vector<double> zero = numlib::expmMultiply(A, vector<double>(10, 0.0), 1.0);
+    assertTest(zero == vector<double>(10, 0.0), "e^{tA} 0 powinno być 0");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 6;
+
+    if (runTest("Test1", ExpmTest1)) passedTests++;
+    if (runTest("Test2", ExpmTest2)) passedTests++;
+    if (runTest("Test3", ExpmTest3)) passedTests++;
+    if (runTest("Test4", ExpmTest4)) passedTests++;
+    if (runTest("Test5", ExpmTest5)) passedTests++;
+    if (runTest("Test6", ExpmTest6)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -1,4 +1,8 @@
 #include "../include/numlib/Interpolacja.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 // Klasa wyjtku uywana do sygnalizowania niepowodzenia testu
@@ -88,9 +92,249 @@ void InterpolationTest2() {
         "Interpolacja funkcji Rungego powinna dawa znaczcy bd");
 }
 
+// Test 3: Wartoci w wielu punktach bez wydruku - zgodno z jawn sum postaci Newtona
+void InterpolationTest3() {
+    vector<double> x, y;
+    int n = 12;
+    for (int i = 0; i < n; i++) {
+        double xi = cos(3.141592653589793 * (i + 0.5) / n);
+        x.push_back(xi);
+        y.push_back(exp(xi) * sin(3.0 * xi));
+    }
+    auto coeffs = numlib::DividedDiff(x, y);
+
+    // Liczby punktw z reszt po penych rejestrach i wicej ni jedna paczka
+    for (size_t m : {0, 1, 3, 7, 17, 37, 8205}) {
+        vector<double> points(m);
+        for (size_t p = 0; p < m; p++) points[p] = -1.2 + 2.4 * p / (m > 1 ? m - 1 : 1);
+
+        vector<double> reference(m);
+        for (size_t p = 0; p < m; p++) {
+            double term = 1.0, sum = coeffs[0];
+            for (int i = 1; i < n; i++) {
+                term *= points[p] - x[i - 1];
+                sum += coeffs[i] * term;
+            }
+            reference[p] = sum;
+        }
+
+        numlib::SimdLevel saved = numlib::simd::activeLevel();
+        for (int level = 0; level <= static_cast<int>(numlib::simd::detectedLevel()); level++) {
+            numlib::simd::setLevel(static_cast<numlib::SimdLevel>(level));
+            vector<double> values = numlib::NewtonEvaluate(x, coeffs, points);
+            for (size_t p = 0; p < m; p++) {
+                assertTest(abs(values[p] - reference[p]) < 1e-12,
+                    string("Bd NewtonEvaluate dla poziomu ") + numlib::simd::levelName(static_cast<numlib::SimdLevel>(level)));
+            }
+            // Wynik w miejscu argumentw
+            vector<double> inPlace = points;
+            numlib::NewtonEvaluate(x, coeffs, inPlace, inPlace);
+            assertTest(inPlace == values, "Wynik w miejscu rni si od zwykego");
+        }
+        numlib::simd::setLevel(saved);
+
+        // Wynik nie zaley od liczby wtkw
+        numlib::setNumThreads(1);
+        vector<double> single = numlib::NewtonEvaluate(x, coeffs, points);
+        numlib::setNumThreads(4);
+        vector<double> multi = numlib::NewtonEvaluate(x, coeffs, points);
+        numlib::setNumThreads(0);
+        assertTest(single == multi, "Wynik zaley od liczby wtkw");
+    }
+
+    // Jeden wze - wielomian stay
+    vector<double> constant = numlib::NewtonEvaluate({ 2.0 }, { 5.0 }, { -1.0, 0.0, 3.0, 7.0, 9.0 });
+    assertTest(constant == vector<double>(5, 5.0), "Bd dla wielomianu staego");
+}
+
+// Test 4: Obsuga bdw NewtonEvaluate
+void InterpolationTest4() {
+    vector<double> x = { 0.0, 1.0, 2.0 };
+    vector<double> coeffs = { 1.0, 2.0, 3.0 };
+    vector<double> points(4), out(3);
+    bool thrown = false;
+    try { numlib::NewtonEvaluate(x, coeffs, points, out); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla rnych dugoci x i out");
+
+    thrown = false;
+    try { numlib::NewtonEvaluate(x, { 1.0, 2.0 }, points); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla rnych dugoci wzw i wspczynnikw");
+}
+
+// Test 5: Przyrostowe dodawanie wzw - zgodno z DividedDiff
+void InterpolationTest5() {
+    numlib::NewtonInterpolator interpolator;
+    vector<double> x, y;
+    for (int i = 0; i < 10; i++) {
+        double xi = 0.3 * i - 1.0 + 0.05 * (i % 3);
+        double yi = exp(-xi) + xi * xi;
+        interpolator.addNode(xi, yi);
+        x.insert(x.begin(), xi);
+        y.insert(y.begin(), yi);
+
+        // Ta sama kolejno wzw (od najnowszego) - te same ilorazy rnicowe
+        auto coeffs = numlib::DividedDiff(x, y);
+        assertTest(interpolator.nodes() == x, "Bdna kolejno wzw");
+        for (size_t k = 0; k < coeffs.size(); k++) {
+            assertTest(abs(interpolator.coefficients()[k] - coeffs[k]) < 1e-9 * (1.0 + abs(coeffs[k])),
+                "Wspczynniki rne od DividedDiff");
+        }
+        for (size_t k = 0; k < x.size(); k++) {
+            assertTest(abs(interpolator(x[k]) - y[k]) < 1e-10, "Wielomian nie przechodzi przez wze");
+        }
+    }
+
+    // Wartoci w wielu punktach zgodne z pojedynczymi
+    vector<double> points = { -1.5, -0.2, 0.0, 0.7, 1.9, 2.3 };
+    vector<double> values = interpolator.evaluate(points);
+    for (size_t p = 0; p < points.size(); p++) {
+        assertTest(abs(values[p] - interpolator(points[p])) < 1e-12, "evaluate rne od operator()");
+    }
+
+    interpolator.clear();
+    assertTest(interpolator.size() == 0 && interpolator(1.0) == 0.0, "Bd po clear");
+}
+
+// Test 6: Okno przesuwne dla strumienia danych
+void InterpolationTest6() {
+    size_t window = 6;
+    numlib::NewtonInterpolator interpolator(window);
+    for (int step = 0; step < 2000; step++) {
+        double t = 0.01 * step;
+        interpolator.addNode(t, sin(t));
+        assertTest(interpolator.size() == min<size_t>(step + 1, window), "Bdny rozmiar okna");
+    }
+    // Interpolant z okna rwny zbudowanemu od zera na tych samych wzach
+    vector<double> x = interpolator.nodes(), y;
+    for (double xi : x) y.push_back(sin(xi));
+    auto coeffs = numlib::DividedDiff(x, y);
+    for (double t : { 19.94, 19.96, 19.975, 19.99, 20.0 }) {
+        double fresh = coeffs.back();
+        for (size_t i = x.size() - 1; i-- > 0;) fresh = fresh * (t - x[i]) + coeffs[i];
+        assertTest(abs(interpolator(t) - fresh) < 1e-12, "Okno rne od interpolacji od zera");
+        assertTest(abs(interpolator(t) - sin(t)) < 1e-9, "Zbyt duy bd interpolacji w oknie");
+    }
+
+    // Rczne usuwanie najstarszego wza
+    interpolator.removeOldest();
+    assertTest(interpolator.size() == window - 1, "removeOldest nie usun wza");
+    assertTest(interpolator.nodes().back() == x[x.size() - 2], "Usunito niewaciwy wze");
+}
+
+// Test 7: Obsuga bdw NewtonInterpolator
+void InterpolationTest7() {
+    numlib::NewtonInterpolator interpolator(3);
+    bool thrown = false;
+    try { interpolator.removeOldest(); } catch (const runtime_error&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla usuwania z pustego interpolatora");
+
+    interpolator.addNode(0.0, 1.0);
+    interpolator.addNode(1.0, 2.0);
+    thrown = false;
+    try { interpolator.addNode(1.0, 3.0); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla powtrzonego wza");
+    assertTest(interpolator.size() == 2 && abs(interpolator(0.5) - 1.5) < 1e-15, "Wyjtek zmieni stan");
+
+    // Przy penym oknie wze rwny usuwanemu najstarszemu jest dozwolony
+    interpolator.addNode(2.0, 5.0);
+    interpolator.addNode(0.0, 4.0);
+    assertTest(interpolator.size() == 3 && abs(interpolator(0.0) - 4.0) < 1e-15, "Bd przy powrocie do usunitego wza");
+}
+
+// Test 8: Wzr barycentryczny dla dowolnych wzw - zgodno z postaci Newtona
+void InterpolationTest8() {
+    vector<double> x = { -2.0, -1.3, -0.1, 0.4, 1.1, 2.5, 3.0 };
+    vector<double> y;
+    for (double xi : x) y.push_back(cos(xi) + 0.1 * xi * xi * xi);
+    numlib::BarycentricInterpolator interpolator(x, y);
+    auto coeffs = numlib::DividedDiff(x, y);
+
+    for (double t : { -2.2, -1.0, 0.0, 0.77, 2.9, 3.4 }) {
+        vector<double> newton = numlib::NewtonEvaluate(x, coeffs, { t });
+        assertTest(abs(interpolator(t) - newton[0]) < 1e-12, "Wzr barycentryczny rny od postaci Newtona");
+    }
+    for (size_t j = 0; j < x.size(); j++) {
+        assertTest(interpolator(x[j]) == y[j], "Warto w wle powinna by dokadna");
+    }
+
+    // Nowe dane na tych samych wzach - wagi bez zmian
+    vector<double> weights = interpolator.weights();
+    for (double& yi : y) yi = 2.0 * yi - 1.0;
+    interpolator.setValues(y);
+    assertTest(interpolator.weights() == weights, "setValues zmieni wagi");
+    coeffs = numlib::DividedDiff(x, y);
+    vector<double> newton = numlib::NewtonEvaluate(x, coeffs, { 1.7 });
+    assertTest(abs(interpolator(1.7) - newton[0]) < 1e-12, "Bd po zmianie wartoci");
+}
+
+// Test 9: Wzy Czebyszewa - wagi jawne, brak zjawiska Rungego, wersja wektorowa
+void InterpolationTest9() {
+    for (auto kind : { numlib::ChebyshevKind::First, numlib::ChebyshevKind::Second }) {
+        // Wagi jawne proporcjonalne do wyliczonych w O(n^2)
+        auto small = numlib::BarycentricInterpolator::chebyshev(9, -2.0, 3.0, kind);
+        numlib::BarycentricInterpolator general(small.nodes(), vector<double>(9, 0.0));
+        double ratio = general.weights()[0] / small.weights()[0];
+        for (size_t j = 0; j < 9; j++) {
+            assertTest(abs(general.weights()[j] - ratio * small.weights()[j]) < 1e-12 * abs(general.weights()[j]),
+                "Wagi Czebyszewa nieproporcjonalne do oglnych");
+        }
+
+        // Funkcja Rungego: na 201 wzach Czebyszewa bd na poziomie precyzji
+        auto runge = numlib::BarycentricInterpolator::chebyshev(201, -1.0, 1.0, kind);
+        vector<double> f;
+        for (double xi : runge.nodes()) f.push_back(1.0 / (1.0 + 25.0 * xi * xi));
+        runge.setValues(f);
+
+        // Punkty w liczbie z reszt po penych rejestrach, w tym same wzy
+        vector<double> points;
+        for (int p = 0; p < 9001; p++) points.push_back(-1.0 + 2.0 * p / 9000.0);
+        points.insert(points.end(), runge.nodes().begin(), runge.nodes().begin() + 5);
+
+        numlib::SimdLevel saved = numlib::simd::activeLevel();
+        for (int level = 0; level <= static_cast<int>(numlib::simd::detectedLevel()); level++) {
+            numlib::simd::setLevel(static_cast<numlib::SimdLevel>(level));
+            vector<double> values = runge.evaluate(points);
+            double worst = 0.0;
+            for (size_t p = 0; p < points.size(); p++) {
+                worst = max(worst, abs(values[p] - 1.0 / (1.0 + 25.0 * points[p] * points[p])));
+            }
+            assertTest(worst < 1e-13, string("Zbyt duy bd interpolacji Czebyszewa dla poziomu ") +
+                numlib::simd::levelName(static_cast<numlib::SimdLevel>(level)));
+            for (size_t j = 0; j < 5; j++) {
+                assertTest(values[9001 + j] == f[j], "Warto w wle powinna by dokadna");
+            }
+        }
+        numlib::simd::setLevel(saved);
+    }
+}
+
+// Test 10: Obsuga bdw BarycentricInterpolator
+void InterpolationTest10() {
+    bool thrown = false;
+    try { numlib::BarycentricInterpolator({ 0.0, 1.0, 0.0 }, { 1.0, 2.0, 3.0 }); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla powtrzonego wza");
+
+    thrown = false;
+    try { numlib::BarycentricInterpolator({ 0.0, 1.0 }, { 1.0 }); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla niezgodnych dugoci");
+
+    thrown = false;
+    try { numlib::BarycentricInterpolator::chebyshev(5, 1.0, -1.0); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla pustego przedziau");
+
+    auto interpolator = numlib::BarycentricInterpolator::chebyshev(4, 0.0, 1.0, numlib::ChebyshevKind::First);
+    thrown = false;
+    try { interpolator.setValues({ 1.0, 2.0 }); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjtku dla zej liczby wartoci");
+
+    // Jeden wze - funkcja staa
+    numlib::BarycentricInterpolator constant({ 0.5 }, { 3.0 });
+    assertTest(constant(-7.0) == 3.0 && constant(0.5) == 3.0, "Bd dla jednego wza");
+}
+
 int main() {
     int passedTests = 0;
-    int totalTests = 2;
+    int totalTests = 10;
 
     // Wykonanie testw
     if(runTest("Test interpolacji wielomianem kwadratowym", InterpolationTest1)) {
@@ -99,6 +343,30 @@ int main() {
     if(runTest("Test interpolacji funkcji Rungego", InterpolationTest2)) {
         passedTests++;
     }
+    if(runTest("Test wartoci w wielu punktach", InterpolationTest3)) {
+        passedTests++;
+    }
+    if(runTest("Test obsugi bdw", InterpolationTest4)) {
+        passedTests++;
+    }
+    if(runTest("Test przyrostowego dodawania wzw", InterpolationTest5)) {
+        passedTests++;
+    }
+    if(runTest("Test okna przesuwnego", InterpolationTest6)) {
+        passedTests++;
+    }
+    if(runTest("Test obsugi bdw interpolatora", InterpolationTest7)) {
+        passedTests++;
+    }
+    if(runTest("Test wzoru barycentrycznego", InterpolationTest8)) {
+        passedTests++;
+    }
+    if(runTest("Test wzw Czebyszewa", InterpolationTest9)) {
+        passedTests++;
+    }
+    if(runTest("Test obsugi bdw wzoru barycentrycznego", InterpolationTest10)) {
+        passedTests++;
+    }
     
     // Wywietlenie podsumowania
     cout << "\n=== Podsumowanie testw ===" << endl;
@@ -0,0 +1,176 @@
+#include "../include/numlib/JadraSIMD.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+// Deterministyczne dane testowe z przedziału [-1, 1]
+vector<double> testData(size_t n, unsigned seed) {
+    vector<double> v(n);
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        v[i] = (seed >> 16) % 2000 / 1000.0 - 1.0;
+    }
+    return v;
+}
+
+const numlib::SimdLevel allLevels[] = {
+    numlib::SimdLevel::Scalar, numlib::SimdLevel::SSE2,
+    numlib::SimdLevel::AVX2, numlib::SimdLevel::AVX512
+};
+
+/**
+ * Test 1: axpy i dot dla każdego dostępnego poziomu SIMD
+ * Długości wektorów nie są wielokrotnościami szerokości rejestrów
+ */
+void KernelTest1() {
+    cout << "Wykryty poziom: " << numlib::simd::levelName(numlib::simd::detectedLevel()) << endl;
+    for (size_t n : { 0, 1, 3, 7, 17, 64, 101 }) {
+        auto x = testData(n, 1);
+        auto y = testData(n, 2);
+
+        double expectedDot = 0.0;
+        vector<double> expectedAxpy(y);
+        for (size_t i = 0; i < n; i++) {
+            expectedDot += x[i] * y[i];
+            expectedAxpy[i] += 0.75 * x[i];
+        }
+
+        for (auto level : allLevels) {
+            if (!numlib::simd::setLevel(level)) continue;
+            double d = numlib::simd::dot(n, x.data(), y.data());
+            assertTest(abs(d - expectedDot) < 1e-12,
+                string("Błędny iloczyn skalarny dla ") + numlib::simd::levelName(level));
+
+            vector<double> z(y);
+            numlib::simd::axpy(n, 0.75, x.data(), z.data());
+            for (size_t i = 0; i < n; i++) {
+                assertTest(abs(z[i] - expectedAxpy[i]) < 1e-14,
+                    string("Błędny axpy dla ") + numlib::simd::levelName(level));
+            }
+        }
+    }
+    numlib::simd::setLevel(numlib::simd::detectedLevel());
+}
+
+/**
+ * Test 2: aktualizacja rzędu k (C -= L*U) na blokach z odstępem między wierszami
+ */
+void KernelTest2() {
+    size_t m = 5, n = 13, k = 7, ld = 16;
+    auto L = testData(m * ld, 3);
+    auto U = testData(k * ld, 4);
+    auto C0 = testData(m * ld, 5);
+
+    vector<double> expected(C0);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            for (size_t p = 0; p < k; p++) {
+                expected[i * ld + j] -= L[i * ld + p] * U[p * ld + j];
+            }
+        }
+    }
+
+    for (auto level : allLevels) {
+        if (!numlib::simd::setLevel(level)) continue;
+        vector<double> C(C0);
+        numlib::simd::rankUpdate(m, n, k, L.data(), ld, U.data(), ld, C.data(), ld);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < ld; j++) {
+                double want = j < n ? expected[i * ld + j] : C0[i * ld + j];
+                assertTest(abs(C[i * ld + j] - want) < 1e-12,
+                    string("Błędna aktualizacja dla ") + numlib::simd::levelName(level));
+            }
+        }
+    }
+    numlib::simd::setLevel(numlib::simd::detectedLevel());
+}
+
+/**
+ * Test 3: wersje float axpy i rankUpdate zgodne z pętlą skalarną
+ */
+void KernelTest3() {
+    size_t m = 3, n = 37, k = 9, ld = 48;
+    auto Ld = testData(m * ld, 6);
+    auto Ud = testData(k * ld, 7);
+    auto Cd = testData(m * ld, 8);
+    vector<float> L(Ld.begin(), Ld.end()), U(Ud.begin(), Ud.end()), C0(Cd.begin(), Cd.end());
+
+    vector<float> expected(C0);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            for (size_t p = 0; p < k; p++) {
+                expected[i * ld + j] -= L[i * ld + p] * U[p * ld + j];
+            }
+        }
+    }
+
+    for (auto level : allLevels) {
+        if (!numlib::simd::setLevel(level)) continue;
+        vector<float> C(C0);
+        numlib::simd::rankUpdate(m, n, k, L.data(), ld, U.data(), ld, C.data(), ld);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < ld; j++) {
+                float want = j < n ? expected[i * ld + j] : C0[i * ld + j];
+                assertTest(abs(C[i * ld + j] - want) < 1e-5f,
+                    string("Błędna aktualizacja float dla ") + numlib::simd::levelName(level));
+            }
+        }
+
+        vector<float> y(C0.begin(), C0.begin() + n);
+        numlib::simd::axpy(n, 0.5f, L.data(), y.data());
+        for (size_t i = 0; i < n; i++) {
+            assertTest(abs(y[i] - (C0[i] + 0.5f * L[i])) < 1e-6f,
+                string("Błędny axpy float dla ") + numlib::simd::levelName(level));
+        }
+    }
+    numlib::simd::setLevel(numlib::simd::detectedLevel());
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", KernelTest1)) passedTests++;
+    if (runTest("Test2", KernelTest2)) passedTests++;
+    if (runTest("Test3", KernelTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,185 @@
+#include "../include/numlib/LUPozaPamiecia.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+#include <filesystem>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+// Plik tymczasowy usuwany po zakończeniu testu
+struct TempFile {
+    string path;
+    TempFile(const string& name) : path((filesystem::temp_directory_path() / name).string()) {}
+    ~TempFile() { filesystem::remove(path); }
+};
+
+numlib::Matrix randomMatrix(size_t m, size_t n, unsigned seed) {
+    numlib::Matrix A(m, n);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+    }
+    return A;
+}
+
+/**
+ * Test 1: Macierz 300 x 300 w kafelkach 64 x 64 (ostatni kafelek niepełny) -
+ * rozwiązania zgodne z rozkładem LU w pamięci, także dla wielu prawych stron
+ */
+void OutOfCoreTest1() {
+    size_t n = 300;
+    TempFile file("numlib_ooc_test1.bin");
+    numlib::Matrix A = randomMatrix(n, n, 5);
+    numlib::OutOfCoreLU ooc(file.path, A, 64);
+    numlib::LU lu(A);
+    assertTest(ooc.isFactored() && ooc.tileCount() == 5, "Błędna liczba kafelków");
+
+    vector<double> b(n);
+    for (size_t i = 0; i < n; i++) b[i] = sin(0.1 * i) + 1.0;
+    auto x = ooc.solve(b);
+    auto xLU = lu.solve(b);
+    for (size_t i = 0; i < n; i++) {
+        assertTest(abs(x[i] - xLU[i]) < 1e-9 * (1 + abs(xLU[i])), "Rozwiązanie różni się od LU w pamięci");
+    }
+
+    numlib::Matrix B = randomMatrix(n, 3, 17);
+    numlib::Matrix X = ooc.solve(B);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            double r = B(i, j);
+            for (size_t k = 0; k < n; k++) r -= A(i, k) * X(k, j);
+            assertTest(abs(r) < 1e-10, "Zbyt duże residuum dla wielu prawych stron");
+        }
+    }
+}
+
+/**
+ * Test 2: Wypełnianie kafelkami - macierz z zerową przekątną wymaga zamian
+ * wierszy między kafelkami; wynik nie zależy od liczby wątków
+ */
+void OutOfCoreTest2() {
+    size_t n = 150, t = 32;
+    TempFile file("numlib_ooc_test2.bin");
+    numlib::Matrix A = randomMatrix(n, n, 41);
+    for (size_t i = 0; i < n; i++) A(i, i) = 0.0;
+
+    numlib::OutOfCoreLU ooc(file.path, n, t);
+    for (size_t I = 0; I < ooc.tileCount(); I++) {
+        for (size_t J = 0; J < ooc.tileCount(); J++) {
+            numlib::MatrixView T = ooc.tileView(I, J);
+            for (size_t i = 0; i < T.rows(); i++) {
+                for (size_t j = 0; j < T.cols(); j++) T(i, j) = A(I * t + i, J * t + j);
+            }
+        }
+    }
+    ooc.factorize();
+
+    vector<double> b(n, 1.0);
+    auto x = ooc.solve(b);
+    for (size_t i = 0; i < n; i++) {
+        double r = b[i];
+        for (size_t k = 0; k < n; k++) r -= A(i, k) * x[k];
+        assertTest(abs(r) < 1e-10, "Zbyt duże residuum");
+    }
+
+    TempFile file1("numlib_ooc_test2_1.bin");
+    numlib::setNumThreads(1);
+    auto x1 = numlib::OutOfCoreLU(file1.path, A, t).solve(b);
+    numlib::setNumThreads(0);
+    for (size_t i = 0; i < n; i++) {
+        assertTest(x1[i] == x[i], "Wynik zależy od liczby wątków");
+    }
+}
+
+/**
+ * Test 3: Macierz osobliwa, niekwadratowa i rozwiązywanie przed rozkładem
+ */
+void OutOfCoreTest3() {
+    TempFile file("numlib_ooc_test3.bin");
+    size_t n = 40;
+    numlib::OutOfCoreLU ooc(file.path, n, 16);
+    bool thrown = false;
+    try {
+        ooc.solve(vector<double>(n, 1.0));
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku przed rozkładem");
+
+    // Wiersz 30 jest sumą wierszy 3 i 20
+    numlib::Matrix A = randomMatrix(n, n, 8);
+    for (size_t j = 0; j < n; j++) A(30, j) = A(3, j) + A(20, j);
+    for (size_t i = 0; i < n; i++) ooc.setRow(i, numlib::Span<const double>(A.row(i), n));
+    thrown = false;
+    try {
+        ooc.factorize();
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy osobliwej");
+
+    TempFile rectangular("numlib_ooc_test3_rect.bin");
+    thrown = false;
+    try {
+        numlib::OutOfCoreLU bad(rectangular.path, numlib::Matrix(5, 6), 4);
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy niekwadratowej");
+    assertTest(!filesystem::exists(rectangular.path), "Plik utworzony dla macierzy niekwadratowej");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", OutOfCoreTest1)) passedTests++;
+    if (runTest("Test2", OutOfCoreTest2)) passedTests++;
+    if (runTest("Test3", OutOfCoreTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,148 @@
+#include "../include/numlib/MacierzRzadka.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+/**
+ * Test 1: Budowanie z COO - kolejność dowolna, powtórzone pozycje są sumowane
+ */
+void SparseTest1() {
+    numlib::CooBuilder coo(3, 4);
+    coo.add(2, 3, 1.0);
+    coo.add(0, 1, 2.0);
+    coo.add(2, 0, -1.0);
+    coo.add(0, 1, 3.0);
+    coo.add(1, 2, 4.0);
+    coo.add(0, 0, 1.5);
+    auto A = coo.build();
+
+    assertTest(A.rows() == 3 && A.cols() == 4, "Błędne wymiary");
+    assertTest(A.nnz() == 5, "Powtórzona pozycja nie została scalona");
+    assertTest(A.at(0, 1) == 5.0, "Powtórzone wartości nie zostały zsumowane");
+    assertTest(A.at(0, 0) == 1.5 && A.at(2, 0) == -1.0 && A.at(2, 3) == 1.0, "Błędne wartości");
+    assertTest(A.at(1, 1) == 0.0, "Element spoza wzorca powinien być zerowy");
+
+    const auto& ptr = A.rowPointers();
+    const auto& col = A.columnIndices();
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t p = ptr[i] + 1; p < ptr[i + 1]; p++) {
+            assertTest(col[p - 1] < col[p], "Kolumny w wierszu nie są posortowane");
+        }
+    }
+
+    bool thrown = false;
+    try {
+        coo.add(3, 0, 1.0);
+    }
+    catch (const out_of_range&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla indeksu spoza macierzy");
+}
+
+/**
+ * Test 2: Mnożenie macierz-wektor (CSR i CSC) w porównaniu z gęstym, transpozycja
+ */
+void SparseTest2() {
+    size_t m = 300, n = 250;
+    vector<vector<double>> dense(m, vector<double>(n, 0.0));
+    numlib::CooBuilder coo(m, n);
+    unsigned seed = 7;
+    for (int k = 0; k < 4000; k++) {
+        seed = seed * 1103515245u + 12345u;
+        size_t i = (seed >> 8) % m;
+        seed = seed * 1103515245u + 12345u;
+        size_t j = (seed >> 8) % n;
+        double v = 1.0 + k % 11;
+        coo.add(i, j, v);
+        dense[i][j] += v;
+    }
+    auto A = coo.build();
+
+    vector<double> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + j % 7;
+
+    auto y = A.multiply(x);
+    auto yc = A.toCSC().multiply(x);
+    for (size_t i = 0; i < m; i++) {
+        double expected = 0.0;
+        for (size_t j = 0; j < n; j++) expected += dense[i][j] * x[j];
+        assertTest(abs(y[i] - expected) < 1e-10, "Błędne mnożenie CSR");
+        assertTest(abs(yc[i] - expected) < 1e-10, "Błędne mnożenie CSC");
+    }
+
+    auto T = A.transpose();
+    assertTest(T.rows() == n && T.cols() == m && T.nnz() == A.nnz(), "Błędne wymiary transpozycji");
+    for (size_t i = 0; i < m; i += 13) {
+        for (size_t j = 0; j < n; j += 7) {
+            assertTest(T.at(j, i) == A.at(i, j), "Błędna transpozycja");
+        }
+    }
+
+    auto back = A.toCSC().toCSR();
+    assertTest(back.values() == A.values() && back.columnIndices() == A.columnIndices(),
+               "Konwersja CSR -> CSC -> CSR zmienia macierz");
+}
+
+/**
+ * Test 3: Niespójne tablice CSR są odrzucane
+ */
+void SparseTest3() {
+    bool thrown = false;
+    try {
+        numlib::SparseMatrix A(2, 2, {0, 2, 3}, {1, 0, 1}, {1.0, 2.0, 3.0});
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla nieposortowanych indeksów");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", SparseTest1)) passedTests++;
+    if (runTest("Test2", SparseTest2)) passedTests++;
+    if (runTest("Test3", SparseTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
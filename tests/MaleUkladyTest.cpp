@@ -0,0 +1,162 @@
+#include "../include/numlib/MaleUklady.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+using numlib::fixed::Mat;
+using numlib::fixed::Vec;
+
+// Układ o stałych współczynnikach rozwiązany w czasie kompilacji
+constexpr Mat<3> constA = {{ {{ 2.0, 1.0, -1.0 }}, {{ -3.0, -1.0, 2.0 }}, {{ -2.0, 1.0, 2.0 }} }};
+constexpr Vec<3> constB = {{ 8.0, -11.0, -3.0 }};
+constexpr Vec<3> constX = numlib::fixed::solve(constA, constB);
+static_assert(constX[0] > 1.999999 && constX[0] < 2.000001, "Rozwiązanie w czasie kompilacji");
+static_assert(constX[1] > 2.999999 && constX[1] < 3.000001, "Rozwiązanie w czasie kompilacji");
+static_assert(constX[2] > -1.000001 && constX[2] < -0.999999, "Rozwiązanie w czasie kompilacji");
+
+template<size_t N>
+Mat<N> randomMatrix(unsigned seed, double diagonal) {
+    Mat<N> A{};
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = 0; j < N; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A[i][j] = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+        A[i][i] += diagonal;
+    }
+    return A;
+}
+
+template<size_t N>
+double residual(const Mat<N>& A, const Vec<N>& x, const Vec<N>& b) {
+    double worst = 0.0;
+    for (size_t i = 0; i < N; i++) {
+        double sum = 0.0;
+        for (size_t j = 0; j < N; j++) sum += A[i][j] * x[j];
+        worst = max(worst, abs(sum - b[i]));
+    }
+    return worst;
+}
+
+template<size_t N>
+void checkSize(unsigned seed) {
+    Vec<N> b{};
+    for (size_t i = 0; i < N; i++) b[i] = 1.0 + i;
+
+    // Bez dominującej przekątnej - wymaga wyboru elementu głównego
+    Mat<N> A = randomMatrix<N>(seed, 0.0);
+    Vec<N> x = numlib::fixed::solve(A, b);
+    numlib::Matrix M(N, N);
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = 0; j < N; j++) M(i, j) = A[i][j];
+    }
+    auto reference = numlib::GaussSolve(M, vector<double>(b.begin(), b.end()));
+    for (size_t i = 0; i < N; i++) {
+        assertTest(abs(x[i] - reference[i]) < 1e-9 * (1.0 + abs(reference[i])),
+            "Rozwiązanie różni się od GaussSolve dla N = " + to_string(N));
+    }
+
+    Mat<N> D = randomMatrix<N>(seed + 1, N);
+    Vec<N> y = numlib::fixed::solve<numlib::fixed::NoPivoting>(D, b);
+    assertTest(residual(D, y, b) < 1e-12, "Duże residuum bez wyboru elementu głównego dla N = " + to_string(N));
+}
+
+/**
+ * Test 1: zgodność z GaussSolve dla różnych rozmiarów i obu strategii wyboru
+ */
+void FixedTest1() {
+    checkSize<1>(1);
+    checkSize<2>(2);
+    checkSize<4>(3);
+    checkSize<6>(4);
+    checkSize<9>(5);
+    checkSize<16>(6);
+}
+
+/**
+ * Test 2: zerowy element na przekątnej wymaga zamiany wierszy
+ */
+void FixedTest2() {
+    Mat<3> A = {{ {{ 0.0, 2.0, 1.0 }}, {{ 1.0, 1.0, 1.0 }}, {{ 2.0, 1.0, 0.0 }} }};
+    Vec<3> b = {{ 5.0, 6.0, 4.0 }};
+    Mat<3> work = A;
+    Vec<3> x = b;
+    numlib::fixed::solveInPlace(work, x);
+    assertTest(residual(A, x, b) < 1e-14, "Błędne rozwiązanie z zamianą wierszy");
+
+    bool thrown = false;
+    try {
+        numlib::fixed::solve<numlib::fixed::NoPivoting>(A, b);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla zera na przekątnej bez wyboru elementu głównego");
+}
+
+/**
+ * Test 3: macierz osobliwa
+ */
+void FixedTest3() {
+    Mat<3> A = {{ {{ 1.0, 2.0, 3.0 }}, {{ 2.0, 4.0, 6.0 }}, {{ 1.0, 0.0, 1.0 }} }};
+    Vec<3> b = {{ 1.0, 2.0, 3.0 }};
+    bool thrown = false;
+    try {
+        numlib::fixed::solve(A, b);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy osobliwej");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", FixedTest1)) passedTests++;
+    if (runTest("Test2", FixedTest2)) passedTests++;
+    if (runTest("Test3", FixedTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,187 @@
+#include "../include/numlib/MetodaWielosiatkowa.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+using numlib::CycleType;
+using numlib::Smoother;
+using numlib::StructuredGrid;
+
+double trueResidual(const numlib::SparseMatrix& A, const vector<double>& x, const vector<double>& b) {
+    auto Ax = A.multiply(x);
+    double r = 0.0, nb = 0.0;
+    for (size_t i = 0; i < b.size(); i++) {
+        r += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+        nb += b[i] * b[i];
+    }
+    return sqrt(r / nb);
+}
+
+// f = 1 + drobne zaburzenie, aby residuum zawierało wszystkie częstotliwości
+vector<double> rightHandSide(size_t n) {
+    vector<double> b(n);
+    for (size_t i = 0; i < n; i++) b[i] = 1.0 + 0.3 * ((i * 7919) % 13) / 13.0;
+    return b;
+}
+
+numlib::KrylovResult runMultigrid(const StructuredGrid& grid, CycleType cycle, Smoother smoother) {
+    numlib::MultigridOptions options;
+    options.cycle = cycle;
+    options.smoother = smoother;
+    options.tolerance = 1e-10;
+    numlib::Multigrid mg(grid, options);
+    auto b = rightHandSide(mg.size());
+    auto result = mg.solve(b);
+    assertTest(result.converged, "Metoda wielosiatkowa nie zbiegła");
+    assertTest(trueResidual(mg.matrix(), result.x, b) < 1e-10, "Zbyt duże residuum");
+    return result;
+}
+
+/**
+ * Test 1: liczba cykli V nie rośnie z rozmiarem siatki 2D
+ */
+void MultigridTest1() {
+    int previous = 0;
+    for (size_t n : { 31, 63, 127, 255 }) {
+        auto grid = StructuredGrid::unitCube(2, n);
+        numlib::Multigrid mg(grid);
+        auto result = runMultigrid(grid, CycleType::V, Smoother::RedBlackGaussSeidel);
+        cout << "2D n = " << n << ": poziomów " << mg.levelCount() << ", cykli V " << result.iterations << endl;
+        assertTest(result.iterations <= 12, "Zbyt wiele cykli V");
+        if (previous > 0) assertTest(result.iterations <= previous + 1, "Liczba cykli rośnie z rozmiarem siatki");
+        previous = result.iterations;
+    }
+}
+
+/**
+ * Test 2: 1D i 3D, cykle W i F, wygładzanie Jacobiego, siatka anizotropowa
+ */
+void MultigridTest2() {
+    auto line = runMultigrid(StructuredGrid::unitCube(1, 1023), CycleType::V, Smoother::RedBlackGaussSeidel);
+    auto cube = runMultigrid(StructuredGrid::unitCube(3, 31), CycleType::V, Smoother::RedBlackGaussSeidel);
+    auto w = runMultigrid(StructuredGrid::unitCube(2, 127), CycleType::W, Smoother::RedBlackGaussSeidel);
+    auto f = runMultigrid(StructuredGrid::unitCube(2, 127), CycleType::F, Smoother::RedBlackGaussSeidel);
+    auto jacobi = runMultigrid(StructuredGrid::unitCube(2, 127), CycleType::V, Smoother::WeightedJacobi);
+
+    auto grid = StructuredGrid::unitCube(2, 63);
+    grid.ky = 0.2;
+    grid.c = 5.0;
+    auto anisotropic = runMultigrid(grid, CycleType::W, Smoother::RedBlackGaussSeidel);
+
+    cout << "cykle: 1D " << line.iterations << ", 3D " << cube.iterations << ", W " << w.iterations
+         << ", F " << f.iterations << ", Jacobi " << jacobi.iterations
+         << ", anizotropia " << anisotropic.iterations << endl;
+    assertTest(line.iterations <= 12 && cube.iterations <= 12, "Zbyt wiele cykli dla 1D/3D");
+    assertTest(w.iterations <= 12 && f.iterations <= 12, "Zbyt wiele cykli W/F");
+    assertTest(jacobi.iterations <= 25, "Zbyt wiele cykli z wygładzaniem Jacobiego");
+    assertTest(anisotropic.iterations <= 40, "Zbyt wiele cykli dla siatki anizotropowej");
+}
+
+/**
+ * Test 3: cykl V jako preconditioner CG; wynik nie zależy od liczby wątków
+ */
+void MultigridTest3() {
+    auto grid = StructuredGrid::unitCube(2, 127);
+    numlib::Multigrid mg(grid);
+    auto A = mg.matrix();
+    auto b = rightHandSide(mg.size());
+
+    auto plain = numlib::CG(A, b, nullptr, 1e-10, 5000);
+    auto withMultigrid = numlib::CG(A, b, &mg, 1e-10, 100);
+    cout << "iteracje CG: " << plain.iterations << ", z cyklem V: " << withMultigrid.iterations << endl;
+    assertTest(withMultigrid.converged && withMultigrid.iterations <= 10, "CG z cyklem V zbiega zbyt wolno");
+    assertTest(plain.iterations > 10 * withMultigrid.iterations, "Cykl V powinien wielokrotnie zmniejszyć liczbę iteracji");
+
+    numlib::setNumThreads(1);
+    auto one = mg.solve(b);
+    numlib::setNumThreads(4);
+    auto four = mg.solve(b);
+    numlib::setNumThreads(0);
+    assertTest(one.x == four.x, "Wynik zależy od liczby wątków");
+}
+
+/**
+ * Test 4: siatka, której nie da się zgrubić, i nieprawidłowe parametry
+ */
+void MultigridTest4() {
+    StructuredGrid grid = StructuredGrid::unitCube(2, 40);
+    numlib::Multigrid mg(grid);
+    assertTest(mg.levelCount() == 1, "Siatka o parzystym n nie powinna być zgrubiana");
+    auto b = rightHandSide(mg.size());
+    auto direct = mg.solve(b);
+    assertTest(direct.converged && direct.iterations == 1, "Jeden poziom powinien dawać rozwiązanie dokładne");
+
+    bool thrown = false;
+    try {
+        StructuredGrid bad = StructuredGrid::unitCube(2, 15);
+        bad.nz = 3;
+        numlib::Multigrid invalid(bad);
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla nz > 1 w siatce 2D");
+
+    thrown = false;
+    try {
+        StructuredGrid bad = StructuredGrid::unitCube(3, 7);
+        bad.c = -1.0;
+        numlib::Multigrid invalid(bad);
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla ujemnego c");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 4;
+
+    if (runTest("Test1", MultigridTest1)) passedTests++;
+    if (runTest("Test2", MultigridTest2)) passedTests++;
+    if (runTest("Test3", MultigridTest3)) passedTests++;
+    if (runTest("Test4", MultigridTest4)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,166 @@
+#include "../include/numlib/MetodyKrylowa.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+// Dyskretyzacja -Δu + c·∂u/∂x na siatce m x m (c = 0 daje macierz symetryczną)
+numlib::SparseMatrix convectionDiffusion(int m, double c) {
+    int n = m * m;
+    numlib::CooBuilder coo(n, n);
+    coo.reserve(5 * n);
+    double h = 1.0 / (m + 1);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            coo.add(k, k, 4.0);
+            if (i > 0) coo.add(k, k - m, -1.0);
+            if (i + 1 < m) coo.add(k, k + m, -1.0);
+            if (j > 0) coo.add(k, k - 1, -1.0 - c * h / 2);
+            if (j + 1 < m) coo.add(k, k + 1, -1.0 + c * h / 2);
+        }
+    }
+    return coo.build();
+}
+
+double trueResidual(const numlib::SparseMatrix& A, const vector<double>& x, const vector<double>& b) {
+    auto Ax = A.multiply(x);
+    double r = 0.0, nb = 0.0;
+    for (size_t i = 0; i < b.size(); i++) {
+        r += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+        nb += b[i] * b[i];
+    }
+    return sqrt(r / nb);
+}
+
+/**
+ * Test 1: CG dla równania Poissona - bez preconditionera, z Jacobim i z ILU(0)
+ */
+void KrylovTest1() {
+    auto A = convectionDiffusion(40, 0.0);
+    vector<double> b(A.rows(), 1.0);
+
+    auto plain = numlib::CG(A, b, nullptr, 1e-10, 2000);
+    numlib::JacobiPreconditioner jacobi(A);
+    auto withJacobi = numlib::CG(A, b, &jacobi, 1e-10, 2000);
+    numlib::ILU0Preconditioner ilu(A);
+    auto withIlu = numlib::CG(A, b, &ilu, 1e-10, 2000);
+
+    cout << "iteracje CG: " << plain.iterations << ", z Jacobim: " << withJacobi.iterations
+         << ", z ILU(0): " << withIlu.iterations << endl;
+    assertTest(plain.converged && withJacobi.converged && withIlu.converged, "CG nie zbiegła");
+    assertTest(trueResidual(A, withIlu.x, b) < 1e-9, "Zbyt duże residuum CG");
+    assertTest(withIlu.iterations < plain.iterations, "ILU(0) powinien zmniejszyć liczbę iteracji");
+
+    assertTest(plain.residuals.size() == static_cast<size_t>(plain.iterations) + 1,
+               "Historia residuów ma błędną długość");
+    assertTest(plain.residuals.front() == 1.0, "Residuum początkowe dla x0 = 0 powinno wynosić 1");
+    assertTest(plain.residuals.back() == plain.residual, "Ostatnie residuum w historii różni się od końcowego");
+}
+
+/**
+ * Test 2: BiCGSTAB i GMRES(m) dla niesymetrycznego równania konwekcji-dyfuzji
+ */
+void KrylovTest2() {
+    auto A = convectionDiffusion(30, 40.0);
+    vector<double> b(A.rows());
+    for (size_t i = 0; i < b.size(); i++) b[i] = 1.0 + i % 5;
+
+    numlib::ILU0Preconditioner ilu(A);
+    auto bicg = numlib::BiCGSTAB(A, b, &ilu, 1e-10, 1000);
+    auto gmres = numlib::GMRES(A, b, 20, &ilu, 1e-10, 1000);
+    auto gmresPlain = numlib::GMRES(A, b, 20, nullptr, 1e-10, 5000);
+
+    cout << "iteracje BiCGSTAB: " << bicg.iterations << ", GMRES(20): " << gmres.iterations
+         << ", GMRES(20) bez preconditionera: " << gmresPlain.iterations << endl;
+    assertTest(bicg.converged && gmres.converged && gmresPlain.converged, "Metoda nie zbiegła");
+    assertTest(trueResidual(A, bicg.x, b) < 1e-9, "Zbyt duże residuum BiCGSTAB");
+    assertTest(trueResidual(A, gmres.x, b) < 1e-9, "Zbyt duże residuum GMRES");
+    assertTest(trueResidual(A, gmresPlain.x, b) < 1e-9, "Zbyt duże residuum GMRES bez preconditionera");
+
+    // Residuum GMRES (minimalizowane w każdym cyklu) nie rośnie
+    for (size_t k = 1; k < gmres.residuals.size(); k++) {
+        assertTest(gmres.residuals[k] <= gmres.residuals[k - 1] * (1 + 1e-12), "Residuum GMRES wzrosło");
+    }
+}
+
+/**
+ * Test 3: Wersja bez jawnej macierzy, przybliżenie początkowe i limit iteracji
+ */
+void KrylovTest3() {
+    auto A = convectionDiffusion(20, 0.0);
+    numlib::LinearOperator op = [&A](const vector<double>& x, vector<double>& y) {
+        y = A.multiply(x);
+    };
+    vector<double> b(A.rows(), 1.0);
+
+    auto exact = numlib::CG(op, b, nullptr, 1e-12, 1000);
+    auto restarted = numlib::CG(op, b, nullptr, 1e-12, 1000, exact.x);
+    assertTest(restarted.converged && restarted.iterations == 0, "Dokładne x0 powinno kończyć bez iteracji");
+
+    auto limited = numlib::GMRES(op, b, 5, nullptr, 1e-14, 7);
+    assertTest(!limited.converged && limited.iterations == 7, "Nie przestrzegano limitu iteracji");
+
+    auto zero = numlib::BiCGSTAB(op, vector<double>(A.rows(), 0.0));
+    assertTest(zero.converged && zero.x == vector<double>(A.rows(), 0.0), "Dla b = 0 rozwiązaniem jest 0");
+
+    bool thrown = false;
+    try {
+        numlib::CooBuilder coo(2, 2);
+        coo.add(0, 1, 1.0);
+        coo.add(1, 0, 1.0);
+        numlib::ILU0Preconditioner ilu(coo.build());
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla brakującej przekątnej");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", KrylovTest1)) passedTests++;
+    if (runTest("Test2", KrylovTest2)) passedTests++;
+    if (runTest("Test3", KrylovTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
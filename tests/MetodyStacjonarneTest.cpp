@@ -0,0 +1,236 @@
+#include "../include/numlib/MetodyStacjonarne.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+using numlib::StationaryMethod;
+using numlib::Ordering;
+
+// Równanie Poissona -Δu = f na siatce m x m (schemat 5-punktowy)
+numlib::SparseMatrix poisson(int m) {
+    int n = m * m;
+    numlib::CooBuilder coo(n, n);
+    coo.reserve(5 * n);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            coo.add(k, k, 4.0);
+            if (i > 0) coo.add(k, k - m, -1.0);
+            if (i + 1 < m) coo.add(k, k + m, -1.0);
+            if (j > 0) coo.add(k, k - 1, -1.0);
+            if (j + 1 < m) coo.add(k, k + 1, -1.0);
+        }
+    }
+    return coo.build();
+}
+
+double trueResidual(const numlib::SparseMatrix& A, const vector<double>& x, const vector<double>& b) {
+    auto Ax = A.multiply(x);
+    double r = 0.0, nb = 0.0;
+    for (size_t i = 0; i < b.size(); i++) {
+        r += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+        nb += b[i] * b[i];
+    }
+    return sqrt(r / nb);
+}
+
+numlib::StationaryResult run(const numlib::SparseMatrix& A, const vector<double>& b, StationaryMethod method,
+                             Ordering ordering = Ordering::Multicolor, double omega = 0.0) {
+    numlib::StationaryOptions options;
+    options.method = method;
+    options.ordering = ordering;
+    options.omega = omega;
+    options.tolerance = 1e-8;
+    options.maxIterations = 20000;
+    return numlib::StationarySolve(A, b, options);
+}
+
+/**
+ * Test 1: wszystkie metody zbiegają dla równania Poissona; Gauss-Seidel
+ * potrzebuje około połowy iteracji Jacobiego, a SOR z dobranym omega - rząd mniej
+ */
+void StationaryTest1() {
+    const int m = 32;
+    auto A = poisson(m);
+    vector<double> b(A.rows(), 1.0);
+
+    vector<int> color;
+    assertTest(numlib::greedyColoring(A, color) == 2, "Siatka 5-punktowa powinna mieć 2 kolory");
+    assertTest(color[0] != color[1] && color[0] != color[m] && color[0] == color[m + 1],
+               "Kolorowanie powinno być szachownicą");
+
+    auto jacobi = run(A, b, StationaryMethod::Jacobi);
+    auto gsNatural = run(A, b, StationaryMethod::GaussSeidel, Ordering::Natural);
+    auto gsColor = run(A, b, StationaryMethod::GaussSeidel);
+    auto sor = run(A, b, StationaryMethod::SOR);
+    auto ssor = run(A, b, StationaryMethod::SSOR);
+    cout << "iteracje Jacobi: " << jacobi.iterations << ", GS: " << gsNatural.iterations
+         << ", GS czerwono-czarny: " << gsColor.iterations << ", SOR: " << sor.iterations
+         << " (omega " << sor.omega << "), SSOR: " << ssor.iterations << " (omega " << ssor.omega << ")" << endl;
+
+    for (const auto* r : { &jacobi, &gsNatural, &gsColor, &sor, &ssor }) {
+        assertTest(r->converged, "Metoda nie zbiegła");
+        assertTest(trueResidual(A, r->x, b) < 1e-8, "Zbyt duże residuum");
+        assertTest(r->residuals.size() == static_cast<size_t>(r->iterations) + 1, "Historia residuów ma błędną długość");
+    }
+    assertTest(gsColor.colors == 2 && gsNatural.colors == 1 && ssor.colors == 1, "Błędna liczba kolorów w wyniku");
+    assertTest(gsNatural.iterations < 0.6 * jacobi.iterations, "Gauss-Seidel powinien zbiegać około 2 razy szybciej");
+    assertTest(abs(gsColor.iterations - gsNatural.iterations) < 0.05 * gsNatural.iterations,
+               "Kolejność czerwono-czarna nie powinna zmieniać szybkości zbieżności");
+    assertTest(sor.iterations * 5 < gsColor.iterations, "SOR powinien zbiegać znacznie szybciej");
+    assertTest(ssor.iterations * 3 < gsColor.iterations, "SSOR powinien zbiegać znacznie szybciej");
+}
+
+/**
+ * Test 2: automatyczne omega bliskie optymalnemu 2 / (1 + sin(pi h))
+ */
+void StationaryTest2() {
+    const int m = 48;
+    auto A = poisson(m);
+    vector<double> b(A.rows());
+    for (size_t i = 0; i < b.size(); i++) b[i] = 1.0 + i % 7;
+
+    double optimal = 2.0 / (1.0 + sin(M_PI / (m + 1)));
+    auto automatic = run(A, b, StationaryMethod::SOR);
+    auto best = run(A, b, StationaryMethod::SOR, Ordering::Multicolor, optimal);
+    cout << "omega automatyczne " << automatic.omega << " (optymalne " << optimal << "), iteracje "
+         << automatic.iterations << " wobec " << best.iterations << endl;
+    assertTest(automatic.converged && best.converged, "SOR nie zbiegł");
+    assertTest(automatic.omega > 1.5 && automatic.omega < 2.0, "Omega poza oczekiwanym zakresem");
+    assertTest(automatic.iterations < 2 * best.iterations, "Automatyczne omega zbyt dalekie od optymalnego");
+}
+
+/**
+ * Test 3: wynik nie zależy od liczby wątków, macierz gęsta daje to samo co rzadka
+ */
+void StationaryTest3() {
+    const int m = 20;
+    auto A = poisson(m);
+    vector<double> b(A.rows(), 1.0);
+
+    numlib::setNumThreads(1);
+    auto one = run(A, b, StationaryMethod::SOR, Ordering::Multicolor, 1.7);
+    numlib::setNumThreads(4);
+    auto four = run(A, b, StationaryMethod::SOR, Ordering::Multicolor, 1.7);
+    numlib::setNumThreads(0);
+    assertTest(one.iterations == four.iterations && one.x == four.x, "Wynik zależy od liczby wątków");
+
+    numlib::Matrix dense(A.rows(), A.cols());
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t p = A.rowPointers()[i]; p < A.rowPointers()[i + 1]; p++) {
+            dense(i, A.columnIndices()[p]) = A.values()[p];
+        }
+    }
+    numlib::StationaryOptions options;
+    options.method = StationaryMethod::SOR;
+    options.omega = 1.7;
+    auto fromDense = numlib::StationarySolve(dense, b, options);
+    assertTest(fromDense.colors == 2, "Kolory macierzy gęstej powinny wynikać z jej zer");
+    assertTest(abs(fromDense.iterations - one.iterations) <= 1, "Macierz gęsta zbiega inaczej niż rzadka");
+    for (size_t i = 0; i < b.size(); i++) {
+        assertTest(abs(fromDense.x[i] - one.x[i]) < 1e-6, "Rozwiązania z macierzy gęstej i rzadkiej różnią się");
+    }
+}
+
+/**
+ * Test 4: błędne dane
+ */
+void StationaryTest4() {
+    numlib::CooBuilder coo(2, 2);
+    coo.add(0, 1, 1.0);
+    coo.add(1, 0, 1.0);
+    coo.add(1, 1, 1.0);
+    auto A = coo.build();
+    bool thrown = false;
+    try {
+        numlib::StationarySolve(A, vector<double>{ 1.0, 1.0 });
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla zera na przekątnej");
+
+    thrown = false;
+    try {
+        numlib::StationarySolve(poisson(3), vector<double>(8, 1.0));
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla błędnego rozmiaru prawej strony");
+
+    auto zero = numlib::StationarySolve(poisson(3), vector<double>(9, 0.0));
+    assertTest(zero.converged && zero.iterations == 0, "Dla b = 0 rozwiązaniem jest zero");
+}
+
+/**
+ * Test 5: macierz pełna nie jest kolorowana (n kolorów) - przechodzi na kolejność naturalną
+ */
+void StationaryTest5() {
+    const size_t n = 300;
+    numlib::Matrix A(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) A(i, j) = i == j ? 2.0 * n : 1.0 / (1.0 + i + j);
+    }
+    vector<double> b(n, 1.0);
+    auto multicolor = numlib::StationarySolve(A, b);
+    numlib::StationaryOptions options;
+    options.ordering = Ordering::Natural;
+    auto natural = numlib::StationarySolve(A, b, options);
+    assertTest(multicolor.converged && multicolor.colors == 1, "Macierz pełna powinna iść w kolejności naturalnej");
+    assertTest(multicolor.iterations == natural.iterations && multicolor.x == natural.x,
+               "Wynik różni się od kolejności naturalnej");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 5;
+
+    if (runTest("Test1", StationaryTest1)) passedTests++;
+    if (runTest("Test2", StationaryTest2)) passedTests++;
+    if (runTest("Test3", StationaryTest3)) passedTests++;
+    if (runTest("Test4", StationaryTest4)) passedTests++;
+    if (runTest("Test5", StationaryTest5)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
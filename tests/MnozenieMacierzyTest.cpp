@@ -0,0 +1,295 @@
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/JadraSIMD.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+using numlib::Op;
+using numlib::Side;
+using numlib::Triangle;
+using numlib::Diagonal;
+
+numlib::Matrix randomMatrix(size_t m, size_t n, unsigned seed) {
+    numlib::Matrix A(m, n);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+    }
+    return A;
+}
+
+double opAt(const numlib::Matrix& X, Op op, size_t i, size_t j) {
+    return op == Op::None ? X(i, j) : X(j, i);
+}
+
+// Referencyjne C = alpha * op(A) * op(B) + beta * C potrójną pętlą
+numlib::Matrix naiveGemm(Op opA, Op opB, double alpha, const numlib::Matrix& A, const numlib::Matrix& B,
+                         double beta, const numlib::Matrix& C) {
+    numlib::Matrix R = numlib::Matrix::copyOf(C.view());
+    size_t k = opA == Op::None ? A.cols() : A.rows();
+    for (size_t i = 0; i < C.rows(); i++) {
+        for (size_t j = 0; j < C.cols(); j++) {
+            double sum = 0.0;
+            for (size_t p = 0; p < k; p++) sum += opAt(A, opA, i, p) * opAt(B, opB, p, j);
+            R(i, j) = alpha * sum + beta * C(i, j);
+        }
+    }
+    return R;
+}
+
+double maxDifference(const numlib::Matrix& X, const numlib::Matrix& Y) {
+    double worst = 0.0;
+    for (size_t i = 0; i < X.rows(); i++) {
+        for (size_t j = 0; j < X.cols(); j++) worst = max(worst, abs(X(i, j) - Y(i, j)));
+    }
+    return worst;
+}
+
+const numlib::SimdLevel allLevels[] = {
+    numlib::SimdLevel::Scalar, numlib::SimdLevel::SSE2,
+    numlib::SimdLevel::AVX2, numlib::SimdLevel::AVX512
+};
+
+/**
+ * Test 1: gemm dla wszystkich kombinacji transpozycji i każdego poziomu SIMD.
+ * Wymiary nie są wielokrotnościami rozmiarów kafelków ani bloków.
+ */
+void GemmTest1() {
+    const size_t m = 131, n = 101, k = 300;
+    const Op ops[] = { Op::None, Op::Transpose };
+    numlib::Matrix C0 = randomMatrix(m, n, 3);
+
+    for (auto level : allLevels) {
+        if (!numlib::simd::setLevel(level)) continue;
+        for (Op opA : ops) {
+            for (Op opB : ops) {
+                numlib::Matrix A = opA == Op::None ? randomMatrix(m, k, 1) : randomMatrix(k, m, 1);
+                numlib::Matrix B = opB == Op::None ? randomMatrix(k, n, 2) : randomMatrix(n, k, 2);
+                numlib::Matrix expected = naiveGemm(opA, opB, 0.5, A, B, -2.0, C0);
+                numlib::Matrix C = numlib::Matrix::copyOf(C0.view());
+                numlib::gemm(opA, opB, 0.5, A.view(), B.view(), -2.0, C.view());
+                assertTest(maxDifference(C, expected) < 1e-11,
+                    string("Błędny wynik gemm dla ") + numlib::simd::levelName(level));
+            }
+        }
+    }
+    numlib::simd::setLevel(numlib::simd::detectedLevel());
+
+    // beta = 0 nie czyta C (NaN nie może przeniknąć do wyniku)
+    numlib::Matrix A = randomMatrix(7, 5, 4), B = randomMatrix(5, 9, 5);
+    numlib::Matrix C(7, 9);
+    for (size_t i = 0; i < 7; i++) {
+        for (size_t j = 0; j < 9; j++) C(i, j) = NAN;
+    }
+    numlib::gemm(Op::None, Op::None, 1.0, A.view(), B.view(), 0.0, C.view());
+    assertTest(maxDifference(C, numlib::multiply(A.view(), B.view())) == 0.0, "beta = 0 powinno pomijać C");
+}
+
+/**
+ * Test 2: gemm na fragmentach większych macierzy - elementy poza blokiem C
+ * pozostają bez zmian, a wynik nie zależy od liczby wątków
+ */
+void GemmTest2() {
+    numlib::Matrix big = randomMatrix(600, 700, 6);
+    numlib::Matrix A = randomMatrix(550, 270, 7), B = randomMatrix(270, 610, 8);
+    numlib::Matrix reference;
+    for (int threads : { 1, 3, 4 }) {
+        numlib::setNumThreads(threads);
+        numlib::Matrix C = numlib::Matrix::copyOf(big.view());
+        numlib::gemm(Op::None, Op::None, 1.0, A.view(), B.view(), 1.0, C.view().block(20, 30, 550, 610));
+        if (threads == 1) {
+            reference = numlib::Matrix::copyOf(C.view());
+            numlib::Matrix expected = naiveGemm(Op::None, Op::None, 1.0, A, B, 1.0,
+                                                numlib::Matrix::copyOf(big.view().block(20, 30, 550, 610)));
+            for (size_t i = 0; i < 600; i++) {
+                for (size_t j = 0; j < 700; j++) {
+                    bool inside = i >= 20 && i < 570 && j >= 30 && j < 640;
+                    double want = inside ? expected(i - 20, j - 30) : big(i, j);
+                    assertTest(abs(C(i, j) - want) < 1e-10, "Błędny element poza lub wewnątrz bloku");
+                }
+            }
+        }
+        else {
+            assertTest(maxDifference(C, reference) == 0.0, "Wynik zależy od liczby wątków");
+        }
+    }
+    numlib::setNumThreads(0);
+}
+
+/**
+ * Test 3: syrk liczy tylko wskazany trójkąt
+ */
+void SyrkTest() {
+    const size_t n = 230, k = 90;
+    numlib::Matrix C0 = randomMatrix(n, n, 9);
+    for (Op op : { Op::None, Op::Transpose }) {
+        numlib::Matrix A = op == Op::None ? randomMatrix(n, k, 10) : randomMatrix(k, n, 10);
+        Op opT = op == Op::None ? Op::Transpose : Op::None;
+        numlib::Matrix expected = naiveGemm(op, opT, -1.0, A, A, 0.5, C0);
+        for (Triangle uplo : { Triangle::Lower, Triangle::Upper }) {
+            numlib::Matrix C = numlib::Matrix::copyOf(C0.view());
+            numlib::syrk(uplo, op, -1.0, A.view(), 0.5, C.view());
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < n; j++) {
+                    bool inside = uplo == Triangle::Lower ? j <= i : j >= i;
+                    double want = inside ? expected(i, j) : C0(i, j);
+                    assertTest(abs(C(i, j) - want) < 1e-11, "Błędny wynik syrk");
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Test 4: trsm dla wszystkich kombinacji strony, trójkąta, transpozycji i przekątnej
+ */
+void TrsmTest() {
+    const size_t n = 290, m = 150;
+    // Małe elementy poza przekątną - trójkąt z jedynkami na przekątnej pozostaje dobrze uwarunkowany
+    numlib::Matrix T = randomMatrix(n, n, 11);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) T(i, j) *= 4.0 / n;
+        T(i, i) = 4.0 + i % 3;
+    }
+
+    for (Side side : { Side::Left, Side::Right }) {
+        numlib::Matrix B0 = side == Side::Left ? randomMatrix(n, m, 12) : randomMatrix(m, n, 12);
+        for (Triangle uplo : { Triangle::Lower, Triangle::Upper }) {
+            // Trójkąt użyty przez trsm jako jawna macierz do sprawdzenia wyniku
+            numlib::Matrix Tri(n, n);
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < n; j++) {
+                    if (uplo == Triangle::Lower ? j < i : j > i) Tri(i, j) = T(i, j);
+                }
+            }
+            for (Diagonal diag : { Diagonal::NonUnit, Diagonal::Unit }) {
+                for (size_t i = 0; i < n; i++) Tri(i, i) = diag == Diagonal::Unit ? 1.0 : T(i, i);
+                for (Op op : { Op::None, Op::Transpose }) {
+                    numlib::Matrix X = numlib::Matrix::copyOf(B0.view());
+                    numlib::trsm(side, uplo, op, diag, 2.0, T.view(), X.view());
+
+                    numlib::Matrix zero(B0.rows(), B0.cols());
+                    numlib::Matrix product = side == Side::Left
+                        ? naiveGemm(op, Op::None, 1.0, Tri, X, 0.0, zero)
+                        : naiveGemm(Op::None, op, 1.0, X, Tri, 0.0, zero);
+                    for (size_t i = 0; i < B0.rows(); i++) {
+                        for (size_t j = 0; j < B0.cols(); j++) {
+                            assertTest(abs(product(i, j) - 2.0 * B0(i, j)) < 1e-9, "Błędny wynik trsm");
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Test 5: nieprawidłowe wymiary
+ */
+void DimensionTest() {
+    numlib::Matrix A(4, 3), B(4, 5), C(4, 5), S(4, 4);
+    bool thrown = false;
+    try {
+        numlib::gemm(Op::None, Op::None, 1.0, A.view(), B.view(), 0.0, C.view());
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla niezgodnych wymiarów gemm");
+
+    thrown = false;
+    try {
+        numlib::syrk(Triangle::Lower, Op::Transpose, 1.0, A.view(), 0.0, S.view());
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla niezgodnych wymiarów syrk");
+
+    thrown = false;
+    try {
+        numlib::trsm(Side::Right, Triangle::Lower, Op::None, Diagonal::NonUnit, 1.0, S.view(), B.view());
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla niezgodnych wymiarów trsm");
+
+    // Puste wymiary są poprawne
+    numlib::Matrix E(0, 5), F(5, 3), G(0, 3);
+    numlib::gemm(Op::None, Op::None, 1.0, E.view(), F.view(), 0.0, G.view());
+}
+
+/**
+ * Test 6: gemm wywołany z wnętrza zadania parallelFor - zagnieżdżone wywołanie
+ * wykonuje się sekwencyjnie i nie może zakleszczyć puli wątków
+ */
+void NestedGemmTest() {
+    numlib::Matrix A = randomMatrix(70, 40, 9), B = randomMatrix(40, 50, 10);
+    numlib::Matrix expected = numlib::multiply(A.view(), B.view());
+    numlib::setNumThreads(4);
+    vector<numlib::Matrix> results(8, numlib::Matrix(70, 50));
+    numlib::parallelFor(8, [&](int t) {
+        numlib::gemm(Op::None, Op::None, 1.0, A.view(), B.view(), 0.0, results[t].view());
+    });
+    numlib::setNumThreads(0);
+    for (const numlib::Matrix& C : results) {
+        assertTest(maxDifference(C, expected) < 1e-12, "Błędny wynik gemm wewnątrz parallelFor");
+    }
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 6;
+
+    if (runTest("Test1", GemmTest1)) passedTests++;
+    if (runTest("Test2", GemmTest2)) passedTests++;
+    if (runTest("Test3", SyrkTest)) passedTests++;
+    if (runTest("Test4", TrsmTest)) passedTests++;
+    if (runTest("Test5", DimensionTest)) passedTests++;
+    if (runTest("Test6", NestedGemmTest)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,223 @@
+#include "../include/numlib/PlikMacierzy.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/MetodyKrylowa.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+#include <filesystem>
+#include <fstream>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+// Plik tymczasowy usuwany po zakończeniu testu
+struct TempFile {
+    string path;
+    TempFile(const string& name) : path((filesystem::temp_directory_path() / name).string()) {}
+    ~TempFile() { filesystem::remove(path); }
+};
+
+/**
+ * Test 1: Zapis strumieniowy wiersz po wierszu, odczyt bez kopiowania i rozwiązanie
+ * układu w miejscu na danych z pliku (kopia przy zapisie - plik pozostaje niezmieniony)
+ */
+void MatrixFileTest1() {
+    size_t n = 45;
+    TempFile fileA("numlib_plik_A.bin"), fileB("numlib_plik_b.bin");
+    numlib::Matrix A(n, n);
+    vector<double> b(n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) A(i, j) = 1.0 / (1.0 + i + 2.0 * j) + (i == j ? 3.0 : 0.0);
+        b[i] = cos(0.3 * i);
+    }
+    {
+        numlib::MatrixFileWriter writer(fileA.path, n, n);
+        for (size_t i = 0; i < n; i++) writer.writeRow(numlib::Span<const double>(A.row(i), n));
+        writer.close();
+    }
+    numlib::writeVectorFile(fileB.path, b);
+
+    numlib::MatrixFile mA(fileA.path, numlib::MatrixFile::Access::CopyOnWrite);
+    numlib::MatrixFile mb(fileB.path);
+    assertTest(mA.layout() == numlib::MatrixFileLayout::Dense && mA.rows() == n && mA.cols() == n, "Błędny nagłówek");
+    numlib::ConstMatrixView view = mA.dense();
+    assertTest(reinterpret_cast<uintptr_t>(view.data()) % numlib::MATRIX_ALIGNMENT == 0, "Dane nie są wyrównane");
+    assertTest(view.stride() % (numlib::MATRIX_ALIGNMENT / sizeof(double)) == 0, "Wiersze nie są wyrównane");
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) assertTest(view(i, j) == A(i, j), "Odczytano inne dane niż zapisano");
+    }
+
+    vector<double> x(mb.vector().begin(), mb.vector().end());
+    numlib::GaussSolveInPlace(mA.mutableDense(), x);
+    auto expected = numlib::LU(A).solve(b);
+    for (size_t i = 0; i < n; i++) {
+        assertTest(abs(x[i] - expected[i]) < 1e-12, "Błędne rozwiązanie układu z pliku");
+    }
+
+    numlib::MatrixFile again(fileA.path);
+    assertTest(again.dense()(3, 7) == A(3, 7), "Rozkład w miejscu zmienił plik");
+}
+
+/**
+ * Test 2: Macierz rzadka i dane w pojedynczej precyzji
+ */
+void MatrixFileTest2() {
+    TempFile fileS("numlib_plik_S.bin"), fileF("numlib_plik_F.bin");
+    size_t n = 500;
+    numlib::CooBuilder coo(n, n);
+    for (size_t i = 0; i < n; i++) {
+        coo.add(i, i, 4.0);
+        if (i > 0) coo.add(i, i - 1, -1.0);
+        if (i + 1 < n) coo.add(i, i + 1, -1.0);
+    }
+    numlib::SparseMatrix S = coo.build();
+    numlib::writeMatrixFile(fileS.path, S);
+
+    numlib::MatrixFile mS(fileS.path);
+    numlib::SparseMatrixView view = mS.sparse();
+    assertTest(view.nnz() == S.nnz(), "Błędna liczba niezerowych");
+    vector<double> b(n, 1.0);
+    auto y = view.multiply(b);
+    auto yExpected = S.multiply(b);
+    for (size_t i = 0; i < n; i++) assertTest(y[i] == yExpected[i], "Błędne mnożenie widoku rzadkiego");
+
+    // Metody Kryłowa działają bezpośrednio na widoku przez LinearOperator
+    numlib::LinearOperator op = [&](const vector<double>& in, vector<double>& out) {
+        view.multiply(in, out);
+    };
+    auto result = numlib::CG(op, b);
+    assertTest(result.converged, "CG na widoku z pliku nie zbiega");
+    numlib::SparseMatrix copy = numlib::SparseMatrix::copyOf(view);
+    assertTest(copy.at(7, 8) == -1.0, "Błędna kopia macierzy rzadkiej");
+
+    numlib::Matrix A(3, 5);
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 5; j++) A(i, j) = 0.1 * (i + 1) + j;
+    }
+    numlib::writeMatrixFile(fileF.path, A, numlib::ScalarType::Float32);
+    numlib::MatrixFile mF(fileF.path);
+    auto f = mF.denseFloat();
+    assertTest(f(2, 4) == static_cast<float>(A(2, 4)), "Błędna konwersja do float");
+    bool thrown = false;
+    try {
+        mF.dense();
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla niezgodnego typu danych");
+}
+
+/**
+ * Test 3: Uszkodzone i niekompletne pliki są odrzucane
+ */
+void MatrixFileTest3() {
+    TempFile file("numlib_plik_zly.bin");
+    {
+        ofstream out(file.path, ios::binary);
+        out << string(200, 'x');
+    }
+    bool thrown = false;
+    try {
+        numlib::MatrixFile m(file.path);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla błędnego nagłówka");
+
+    thrown = false;
+    {
+        numlib::MatrixFileWriter writer(file.path, 10, 10);
+        writer.writeRow(vector<double>(10, 1.0));
+        try {
+            writer.close();
+        }
+        catch (const runtime_error&) {
+            thrown = true;
+        }
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla niekompletnego zapisu");
+
+    thrown = false;
+    try {
+        numlib::MatrixFile m(file.path);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla za krótkiego pliku");
+
+    // Wymiary, których iloczyn przekracza zakres size_t: rows = 2^61, stride = 1
+    // daje 2^64 bajtów danych, co bez kontroli przepełnienia zawija się do 0
+    {
+        numlib::MatrixFileWriter writer(file.path, 1, 8);
+        writer.writeRow(vector<double>(8, 1.0));
+        writer.close();
+    }
+    {
+        fstream patch(file.path, ios::binary | ios::in | ios::out);
+        numlib::MatrixFileHeader header;
+        patch.read(reinterpret_cast<char*>(&header), sizeof(header));
+        header.rows = uint64_t(1) << 61;
+        header.cols = 1;
+        header.stride = 1;
+        patch.seekp(0);
+        patch.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    thrown = false;
+    try {
+        numlib::MatrixFile m(file.path);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla wymiarów przepełniających rozmiar");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", MatrixFileTest1)) passedTests++;
+    if (runTest("Test2", MatrixFileTest2)) passedTests++;
+    if (runTest("Test3", MatrixFileTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
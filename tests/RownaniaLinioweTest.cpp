@@ -1,5 +1,7 @@
 #include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/Watki.h"
 #include <cassert>
+#include <cmath>
 #include <stdexcept>
 
 // Klasa wyjtku uywana do sygnalizowania niepowodzenia testu
@@ -119,14 +121,391 @@ void LinearEquationTest3() {
     cout << "x[0] = " << x[0] << ", x[1] = " << x[1] << ", x[2] = " << x[2] << endl;
 }
 
+/**
+ * Test 4: Rozwizanie na macierzy cigej numlib::Matrix bez wypisywania
+ * Ukad z testu 3, dodatkowo sprawdzenie wyjtku dla macierzy osobliwej
+ */
+void LinearEquationTest4() {
+    numlib::Matrix A = numlib::Matrix::fromRows({
+        {2, 1, -1},
+        {-3, -1, 2},
+        {-2, 1, 2}
+    });
+    vector<double> b = { 8, -11, -3 };
+
+    auto x = numlib::GaussSolve(A, b);
+
+    assertTest(A.stride() % 8 == 0, "Wiersze macierzy powinny by wyrwnane");
+    assertTest(abs(x[0] - 2) < 1e-12, "x[0] powinno by 2");
+    assertTest(abs(x[1] - 3) < 1e-12, "x[1] powinno by 3");
+    assertTest(abs(x[2] - (-1)) < 1e-12, "x[2] powinno by -1");
+
+    numlib::Matrix S = numlib::Matrix::fromRows({ {1, 2}, {2, 4} });
+    bool thrown = false;
+    try {
+        numlib::GaussSolve(S, { 1, 2 });
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Macierz osobliwa powinna zgosi wyjtek");
+}
+
+/**
+ * Test 5: Blokowy rozkad LU uywany dla wielu prawych stron
+ * Macierz 150x150 (rozmiar niepodzielny przez blok), residuum ||Ax - b||
+ */
+void LinearEquationTest5() {
+    int n = 150;
+    numlib::Matrix A(n, n);
+    unsigned seed = 12345;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 1000 / 500.0 - 1.0;
+        }
+    }
+
+    numlib::LU lu(A, 16);
+    numlib::Matrix B(n, 3);
+    for (int i = 0; i < n; i++) {
+        B(i, 0) = 1.0;
+        B(i, 1) = i;
+        B(i, 2) = (i % 2) ? -1.0 : 1.0;
+    }
+    numlib::Matrix X = lu.solve(B);
+    auto x0 = lu.solve(vector<double>(n, 1.0));
+
+    double maxResidual = 0.0;
+    for (int c = 0; c < 3; c++) {
+        for (int i = 0; i < n; i++) {
+            double sum = 0.0;
+            for (int j = 0; j < n; j++) sum += A(i, j) * X(j, c);
+            maxResidual = max(maxResidual, abs(sum - B(i, c)));
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        assertTest(abs(x0[i] - X(i, 0)) < 1e-10, "solve(b) i solve(B) daj rne wyniki");
+    }
+    cout << "max |Ax - b| = " << maxResidual << endl;
+    assertTest(maxResidual < 1e-8, "Zbyt due residuum rozwizania LU");
+}
+
+/**
+ * Test 6: Rwnolegy rozkad LU daje identyczny wynik dla rnej liczby wtkw
+ */
+void LinearEquationTest6() {
+    int n = 300;
+    numlib::Matrix A(n, n);
+    unsigned seed = 777;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 1000 / 500.0 - 1.0;
+        }
+    }
+
+    int previous = numlib::getNumThreads();
+    numlib::setNumThreads(1);
+    numlib::LU serial(A, 32);
+    numlib::setNumThreads(4);
+    numlib::LU parallel(A, 32);
+    numlib::setNumThreads(previous);
+
+    for (int i = 0; i < n; i++) {
+        assertTest(serial.pivots()[i] == parallel.pivots()[i], "Rne wiersze gwne");
+        for (int j = 0; j < n; j++) {
+            assertTest(serial.factors()(i, j) == parallel.factors()(i, j),
+                "Wynik zaley od liczby wtkw");
+        }
+    }
+}
+
+/**
+ * Test 7: Blokowy rozkad Cholesky'ego macierzy dodatnio okrelonej
+ * A = M^T M + n I, porwnanie z rozwizaniem LU oraz L L^T = A
+ */
+void LinearEquationTest7() {
+    int n = 200;
+    numlib::Matrix M(n, n);
+    unsigned seed = 4242;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            M(i, j) = (seed >> 16) % 1000 / 500.0 - 1.0;
+        }
+    }
+    numlib::Matrix A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double sum = (i == j) ? n : 0.0;
+            for (int p = 0; p < n; p++) sum += M(p, i) * M(p, j);
+            A(i, j) = sum;
+        }
+    }
+
+    numlib::Cholesky chol(A, 48);
+    const numlib::Matrix& L = chol.factor();
+    double maxError = 0.0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double sum = 0.0;
+            for (int p = 0; p <= j; p++) sum += L(i, p) * L(j, p);
+            maxError = max(maxError, abs(sum - A(i, j)));
+        }
+        assertTest(i + 1 == n || L(i, i + 1) == 0.0, "Grny trjkt L powinien by zerowy");
+    }
+    assertTest(maxError < 1e-9, "L L^T rni si od A");
+
+    vector<double> b(n);
+    for (int i = 0; i < n; i++) b[i] = 1.0 + i % 7;
+    auto x = chol.solve(b);
+    auto xLU = numlib::LU(A).solve(b);
+    for (int i = 0; i < n; i++) {
+        assertTest(abs(x[i] - xLU[i]) < 1e-10, "Cholesky i LU daj rne rozwizania");
+    }
+}
+
+/**
+ * Test 8: SolveSPD przechodzi do LU dla macierzy nieokrelonej i niesymetrycznej
+ */
+void LinearEquationTest8() {
+    numlib::Matrix indefinite = numlib::Matrix::fromRows({ {1, 2}, {2, 1} });
+    bool thrown = false;
+    try {
+        numlib::Cholesky chol(indefinite);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Cholesky powinien odrzuci macierz nieokrelon");
+
+    auto x = numlib::SolveSPD(indefinite, { 3, 3 });
+    assertTest(abs(x[0] - 1) < 1e-12 && abs(x[1] - 1) < 1e-12, "Bdne rozwizanie dla macierzy nieokrelonej");
+
+    numlib::Matrix general = numlib::Matrix::fromRows({ {2, 1.5}, {1, 3} });
+    assertTest(!numlib::isSymmetric(general), "Macierz nie jest symetryczna");
+    x = numlib::SolveSPD(general, { 3.5, 4 });
+    assertTest(abs(x[0] - 1) < 1e-12 && abs(x[1] - 1) < 1e-12, "Bdne rozwizanie dla macierzy niesymetrycznej");
+}
+
+/**
+ * Test 9: LU w pojedynczej precyzji z poprawianiem iteracyjnym. Dobrze
+ * uwarunkowana macierz osiga dokadno double bez rozkadu w double,
+ * macierz prawie osobliwa i elementy spoza zakresu float wymuszaj rozkad w double.
+ */
+void LinearEquationTest9() {
+    int n = 150;
+    numlib::Matrix A(n, n);
+    unsigned seed = 777;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+        A(i, i) += n / 4.0;
+    }
+    vector<double> b(n);
+    for (int i = 0; i < n; i++) b[i] = 1.0 + i % 5;
+
+    numlib::MixedLU mixed(A, 32);
+    assertTest(mixed.usesSinglePrecision(), "Rozkad w float powinien si powie");
+    auto result = mixed.solve(b);
+    auto xLU = numlib::LU(A).solve(b);
+    assertTest(!result.fallback, "Dobrze uwarunkowany ukad nie powinien wymaga rozkadu w double");
+    assertTest(result.iterations >= 1 && result.iterations < 10, "Nieoczekiwana liczba krokw poprawiania");
+    assertTest(result.residual < 1e-14, "Za duy bd wsteczny po poprawianiu");
+    for (int i = 0; i < n; i++) {
+        assertTest(abs(result.x[i] - xLU[i]) < 1e-12 * (1 + abs(xLU[i])), "Wynik rni si od LU w double");
+    }
+
+    // Ostatni wiersz prawie rwny sumie dwch pierwszych - wskanik uwarunkowania rzdu 1e7
+    numlib::Matrix S(A);
+    for (int j = 0; j < n; j++) S(n - 1, j) = S(0, j) + S(1, j) + (j == 0 ? 1e-6 : 0.0);
+    result = numlib::MixedPrecisionSolve(S, b);
+    assertTest(result.fallback, "le uwarunkowana macierz powinna wymusi rozkad w double");
+    assertTest(result.residual < 1e-14, "Za duy bd wsteczny po rozkadzie w double");
+
+    numlib::Matrix big = numlib::Matrix::fromRows({ {1e300, 1}, {1, 1} });
+    numlib::MixedLU outOfRange(big);
+    assertTest(!outOfRange.usesSinglePrecision(), "Elementy poza zakresem float wymagaj rozkadu w double");
+    result = outOfRange.solve({ 1e300 + 1, 2 });
+    assertTest(result.fallback && abs(result.x[0] - 1) < 1e-12 && abs(result.x[1] - 1) < 1e-12,
+        "Bdne rozwizanie dla elementw poza zakresem float");
+}
+
+// Losowa macierz symetryczna dodatnio okrelona (B B^T + n I)
+numlib::Matrix randomSPD(int n, unsigned seed) {
+    numlib::Matrix B(n, n), A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            B(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double sum = 0.0;
+            for (int k = 0; k < n; k++) sum += B(i, k) * B(j, k);
+            A(i, j) = sum + (i == j ? n : 0.0);
+        }
+    }
+    return A;
+}
+
+double maxDifference(const numlib::Matrix& X, const numlib::Matrix& Y) {
+    double d = 0.0;
+    for (size_t i = 0; i < X.rows(); i++) {
+        for (size_t j = 0; j < X.cols(); j++) d = max(d, abs(X(i, j) - Y(i, j)));
+    }
+    return d;
+}
+
+/**
+ * Test 10: aktualizacja i downdate rozkadu Cholesky'ego rzdu 1 i k
+ * daj ten sam czynnik co rozkad od nowa
+ */
+void LinearEquationTest10() {
+    int n = 120, k = 5;
+    numlib::Matrix A = randomSPD(n, 1234);
+    numlib::Matrix V(n, k);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < k; j++) V(i, j) = sin(0.1 * i + j);
+    }
+
+    // A + v v^T dla pierwszej kolumny V
+    numlib::Cholesky chol(A);
+    vector<double> v(n);
+    for (int i = 0; i < n; i++) v[i] = V(i, 0);
+    chol.update(v);
+    numlib::Matrix A1(A);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) A1(i, j) += v[i] * v[j];
+    }
+    assertTest(maxDifference(chol.factor(), numlib::Cholesky(A1).factor()) < 1e-12,
+        "Czynnik po aktualizacji rzdu 1 rni si od rozkadu od nowa");
+
+    // + V V^T, a potem - V V^T i - v v^T wraca do A
+    chol.update(V);
+    numlib::Matrix A2(A1);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int q = 0; q < k; q++) A2(i, j) += V(i, q) * V(j, q);
+        }
+    }
+    assertTest(maxDifference(chol.factor(), numlib::Cholesky(A2).factor()) < 1e-12,
+        "Czynnik po aktualizacji rzdu k rni si od rozkadu od nowa");
+    chol.downdate(V);
+    chol.downdate(v);
+    assertTest(maxDifference(chol.factor(), numlib::Cholesky(A).factor()) < 1e-11,
+        "Downdate nie odtworzy czynnika wyjciowego");
+
+    // Downdate prowadzcy do macierzy nieokrelonej - wyjtek, czynnik bez zmian
+    numlib::Matrix before(chol.factor());
+    vector<double> big(n, 0.0);
+    big[3] = 2.0 * sqrt(A(3, 3));
+    bool thrown = false;
+    try {
+        chol.downdate(big);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjtku dla downdate do macierzy nieokrelonej");
+    assertTest(maxDifference(chol.factor(), before) == 0.0, "Nieudany downdate zmieni czynnik");
+}
+
+/**
+ * Test 11: LU z poprawkami Shermana-Morrisona-Woodbury'ego - zmiany wierszy,
+ * kolumn i rzdu k, automatyczny ponowny rozkad i poprawka do macierzy osobliwej
+ */
+void LinearEquationTest11() {
+    int n = 200;
+    numlib::Matrix A(n, n);
+    unsigned seed = 4321;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+        A(i, i) += n / 4.0;
+    }
+    vector<double> b(n);
+    for (int i = 0; i < n; i++) b[i] = cos(0.3 * i);
+
+    numlib::WoodburyLU lu(A, 8);
+    numlib::Matrix current(A);
+    auto check = [&](const string& what) {
+        auto x = lu.solve(b);
+        auto reference = numlib::LU(current).solve(b);
+        for (int i = 0; i < n; i++) {
+            assertTest(abs(x[i] - reference[i]) < 1e-10 * (1 + abs(reference[i])), "Rozwizanie rni si od LU: " + what);
+        }
+        assertTest(maxDifference(lu.matrix(), current) < 1e-12, "Przechowywana macierz si nie zgadza: " + what);
+    };
+
+    for (int step = 0; step < 6; step++) {
+        vector<double> delta(n);
+        for (int j = 0; j < n; j++) delta[j] = sin(step + 0.05 * j);
+        int row = (7 * step + 3) % n;
+        lu.updateRow(row, delta);
+        for (int j = 0; j < n; j++) current(row, j) += delta[j];
+        check("zmiana wiersza");
+
+        int column = (11 * step + 5) % n;
+        lu.updateColumn(column, delta);
+        for (int i = 0; i < n; i++) current(i, column) += delta[i];
+        check("zmiana kolumny");
+    }
+    // 12 poprawek rzdu 1 przy limicie 8 - dziewita wymusia ponowny rozkad
+    assertTest(lu.rank() == 3, "Oczekiwano ponownego rozkadu po przekroczeniu limitu rzdu");
+
+    numlib::Matrix U(n, 3), V(n, 3);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < 3; j++) {
+            U(i, j) = cos(0.2 * i * (j + 1));
+            V(i, j) = 0.1 * sin(0.7 * i + j);
+        }
+    }
+    lu.update(U, V);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int q = 0; q < 3; q++) current(i, j) += U(i, q) * V(j, q);
+        }
+    }
+    assertTest(lu.rank() == 6, "Nieoczekiwany rzd poprawek");
+    check("poprawka rzdu 3");
+
+    // Wiersz 0 staje si rwny -wiersz 1, czyli macierz osobliwa
+    vector<double> delta(n);
+    for (int j = 0; j < n; j++) delta[j] = -current(0, j) - current(1, j);
+    bool thrown = false;
+    try {
+        lu.updateRow(0, delta);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjtku dla macierzy osobliwej");
+    check("po nieudanej poprawce");
+}
+
 int main() {
     int passedTests = 0;
-    int totalTests = 3;
+    int totalTests = 11;
 
     // Wykonanie wszystkich testw ukadw rwna liniowych
     if (runTest("Test1", LinearEquationTest1)) passedTests++;
     if (runTest("Test2", LinearEquationTest2)) passedTests++;
     if (runTest("Test3", LinearEquationTest3)) passedTests++;
+    if (runTest("Test4", LinearEquationTest4)) passedTests++;
+    if (runTest("Test5", LinearEquationTest5)) passedTests++;
+    if (runTest("Test6", LinearEquationTest6)) passedTests++;
+    if (runTest("Test7", LinearEquationTest7)) passedTests++;
+    if (runTest("Test8", LinearEquationTest8)) passedTests++;
+    if (runTest("Test9", LinearEquationTest9)) passedTests++;
+    if (runTest("Test10", LinearEquationTest10)) passedTests++;
+    if (runTest("Test11", LinearEquationTest11)) passedTests++;
 
     // Wywietlenie podsumowania wynikw testw
     cout << "\n=== Podsumowanie testw ===" << endl;
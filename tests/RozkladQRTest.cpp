@@ -0,0 +1,228 @@
+#include "../include/numlib/RozkladQR.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+// Losowa macierz m x n z przedziału [-1, 1]
+numlib::Matrix randomMatrix(size_t m, size_t n, unsigned seed) {
+    numlib::Matrix A(m, n);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = (seed >> 16) % 2000 / 1000.0 - 1.0;
+        }
+    }
+    return A;
+}
+
+// Zwraca max |A^T (b - Ax)| - zero dla rozwiązania zadania najmniejszych kwadratów
+double normalResidual(const numlib::Matrix& A, const vector<double>& x, const vector<double>& b) {
+    vector<double> r(b);
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t j = 0; j < A.cols(); j++) r[i] -= A(i, j) * x[j];
+    }
+    double worst = 0.0;
+    for (size_t j = 0; j < A.cols(); j++) {
+        double s = 0.0;
+        for (size_t i = 0; i < A.rows(); i++) s += A(i, j) * r[i];
+        worst = max(worst, abs(s));
+    }
+    return worst;
+}
+
+/**
+ * Test 1: Wysoka macierz 3000 x 37 (blok 8 - ostatni blok niepełny, kilka pasków wierszy):
+ * Q R = A, Q jest ortogonalna, a rozwiązanie spełnia równania normalne
+ */
+void QRTest1() {
+    size_t m = 3000, n = 37;
+    numlib::Matrix A = randomMatrix(m, n, 11);
+    numlib::QR qr(A, false, 8);
+
+    // Kolumna j macierzy A to Q [R(:, j); 0]
+    numlib::Matrix R = qr.R();
+    for (size_t j = 0; j < n; j += 5) {
+        vector<double> col(m, 0.0);
+        for (size_t i = 0; i <= j; i++) col[i] = R(i, j);
+        qr.applyQ(col);
+        for (size_t i = 0; i < m; i++) {
+            assertTest(abs(col[i] - A(i, j)) < 1e-12, "QR różni się od A");
+        }
+    }
+
+    vector<double> b(m);
+    for (size_t i = 0; i < m; i++) b[i] = sin(0.01 * i) + 0.1 * (i % 7);
+    vector<double> y(b);
+    qr.applyQT(y);
+    qr.applyQ(y);
+    for (size_t i = 0; i < m; i++) {
+        assertTest(abs(y[i] - b[i]) < 1e-12, "Q Q^T b różni się od b");
+    }
+
+    auto x = qr.solve(b);
+    assertTest(normalResidual(A, x, b) < 1e-9, "Rozwiązanie nie spełnia równań normalnych");
+
+    // Wynik nie zależy od liczby wątków
+    numlib::setNumThreads(1);
+    auto x1 = numlib::QR(A, false, 8).solve(b);
+    numlib::setNumThreads(0);
+    for (size_t j = 0; j < n; j++) {
+        assertTest(x1[j] == x[j], "Wynik zależy od liczby wątków");
+    }
+}
+
+/**
+ * Test 2: Macierz kwadratowa - QR i LU dają to samo rozwiązanie,
+ * wersja blokowa i z wyborem kolumn są zgodne
+ */
+void QRTest2() {
+    size_t n = 70;
+    numlib::Matrix A = randomMatrix(n, n, 23);
+    vector<double> b(n);
+    for (size_t i = 0; i < n; i++) b[i] = 1.0 + i % 4;
+
+    auto xLU = numlib::LU(A).solve(b);
+    auto xQR = numlib::LeastSquaresQR(A, b);
+    auto xQRP = numlib::LeastSquaresQR(A, b, true);
+    for (size_t i = 0; i < n; i++) {
+        assertTest(abs(xQR[i] - xLU[i]) < 1e-9 * (1 + abs(xLU[i])), "QR i LU dają różne rozwiązania");
+        assertTest(abs(xQRP[i] - xLU[i]) < 1e-9 * (1 + abs(xLU[i])), "QR z wyborem kolumn i LU dają różne rozwiązania");
+    }
+}
+
+/**
+ * Test 3: Wybór kolumn ujawnia rząd - kolumna 5 jest sumą kolumn 1 i 2,
+ * a kolumna 9 jest zerowa; |R(k, k)| nie rosną
+ */
+void QRTest3() {
+    size_t m = 200, n = 12;
+    numlib::Matrix A = randomMatrix(m, n, 37);
+    for (size_t i = 0; i < m; i++) {
+        A(i, 5) = A(i, 1) + A(i, 2);
+        A(i, 9) = 0.0;
+    }
+    numlib::QR qr(A, true);
+    assertTest(qr.rank() == 10, "Błędny rząd numeryczny");
+    const numlib::Matrix& F = qr.factors();
+    for (size_t k = 1; k < n; k++) {
+        assertTest(abs(F(k, k)) <= abs(F(k - 1, k - 1)) * (1 + 1e-12), "Elementy przekątnej R nie maleją");
+    }
+
+    vector<double> b(m);
+    for (size_t i = 0; i < m; i++) b[i] = cos(0.1 * i);
+    auto x = qr.solve(b);
+    assertTest(normalResidual(A, x, b) < 1e-10, "Rozwiązanie bazowe nie minimalizuje residuum");
+    int zeros = 0;
+    for (double v : x) zeros += v == 0.0;
+    assertTest(zeros == 2, "Rozwiązanie bazowe powinno mieć dwie zerowe składowe");
+}
+
+/**
+ * Test 4: Macierz Vandermonde'a stopnia 14 - QR odtwarza współczynniki wielomianu
+ */
+void QRTest4() {
+    size_t m = 300, n = 15;
+    numlib::Matrix V(m, n);
+    vector<double> b(m, 0.0), coeffs(n);
+    for (size_t j = 0; j < n; j++) coeffs[j] = 1.0 / (j + 1);
+    for (size_t i = 0; i < m; i++) {
+        double x = -1.0 + 2.0 * i / (m - 1);
+        double p = 1.0;
+        for (size_t j = 0; j < n; j++) {
+            V(i, j) = p;
+            b[i] += coeffs[j] * p;
+            p *= x;
+        }
+    }
+    auto x = numlib::LeastSquaresQR(V, b);
+    for (size_t j = 0; j < n; j++) {
+        assertTest(abs(x[j] - coeffs[j]) < 1e-8, "Nie odtworzono współczynników wielomianu");
+    }
+}
+
+/**
+ * Test 5: Błędne argumenty
+ */
+void QRTest5() {
+    bool thrown = false;
+    try {
+        numlib::QR qr(randomMatrix(3, 5, 1));
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy szerokiej");
+
+    thrown = false;
+    numlib::QR qr(randomMatrix(6, 3, 2));
+    try {
+        qr.solve(vector<double>(5, 1.0));
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla błędnej długości prawej strony");
+
+    thrown = false;
+    numlib::Matrix singular(4, 3);
+    try {
+        numlib::QR(singular).solve(vector<double>(4, 1.0));
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy osobliwej");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 5;
+
+    if (runTest("Test1", QRTest1)) passedTests++;
+    if (runTest("Test2", QRTest2)) passedTests++;
+    if (runTest("Test3", QRTest3)) passedTests++;
+    if (runTest("Test4", QRTest4)) passedTests++;
+    if (runTest("Test5", QRTest5)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,339 @@
+#include "../include/numlib/RozkladRzadki.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/MetodyKrylowa.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+#include <random>
+#include <algorithm>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+using numlib::FillOrdering;
+
+// -div(k grad u) na siatce m^d (d = 2 lub 3); współczynnik k skacze o kontrast
+// w połowie punktów, co psuje uwarunkowanie, ale nie zmienia wzorca
+numlib::SparseMatrix diffusion(int m, int d, double contrast, unsigned seed = 1) {
+    int n = d == 2 ? m * m : m * m * m;
+    mt19937 gen(seed);
+    uniform_int_distribution<int> coin(0, 1);
+    vector<double> k(n);
+    for (double& v : k) v = coin(gen) ? contrast : 1.0;
+    numlib::CooBuilder coo(n, n);
+    coo.reserve(7 * n);
+    int stride[3] = { 1, m, m * m };
+    for (int p = 0; p < n; p++) {
+        int coord[3] = { p % m, (p / m) % m, p / (m * m) };
+        for (int a = 0; a < d; a++) {
+            for (int dir = -1; dir <= 1; dir += 2) {
+                int c = coord[a] + dir;
+                double kf = c >= 0 && c < m ? 2.0 / (1.0 / k[p] + 1.0 / k[p + dir * stride[a]]) : k[p];
+                coo.add(p, p, kf);
+                if (c >= 0 && c < m) coo.add(p, p + dir * stride[a], -kf);
+            }
+        }
+    }
+    return coo.build();
+}
+
+// Macierz niesymetryczna o niesymetrycznym wzorcu, dominująca przekątniowo
+numlib::SparseMatrix unsymmetric(int n, int perRow, unsigned seed) {
+    mt19937 gen(seed);
+    uniform_int_distribution<int> column(0, n - 1);
+    uniform_real_distribution<double> value(-1.0, 1.0);
+    numlib::CooBuilder coo(n, n);
+    for (int i = 0; i < n; i++) {
+        double sum = 0.0;
+        for (int e = 0; e < perRow; e++) {
+            int j = column(gen);
+            if (j == i) continue;
+            double v = value(gen);
+            coo.add(i, j, v);
+            sum += fabs(v);
+        }
+        coo.add(i, i, sum + 1.0);
+    }
+    return coo.build();
+}
+
+// Symetryczna permutacja P A P^T (ta sama macierz, inna numeracja)
+numlib::SparseMatrix permuted(const numlib::SparseMatrix& A, const vector<int>& p) {
+    numlib::CooBuilder coo(A.rows(), A.cols());
+    const auto& ptr = A.rowPointers();
+    const auto& idx = A.columnIndices();
+    const auto& val = A.values();
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t q = ptr[i]; q < ptr[i + 1]; q++) coo.add(p[i], p[idx[q]], val[q]);
+    }
+    return coo.build();
+}
+
+double relativeResidual(const numlib::SparseMatrix& A, const vector<double>& x, const vector<double>& b) {
+    auto Ax = A.multiply(x);
+    double r = 0.0, nb = 0.0;
+    for (size_t i = 0; i < b.size(); i++) {
+        r += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+        nb += b[i] * b[i];
+    }
+    return sqrt(r / nb);
+}
+
+vector<double> randomVector(size_t n, unsigned seed) {
+    mt19937 gen(seed);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    vector<double> v(n);
+    for (double& x : v) x = dist(gen);
+    return v;
+}
+
+/**
+ * Test 1: Cholesky dla źle uwarunkowanej dyfuzji 2D - wszystkie uporządkowania;
+ * AMD daje najmniejsze wypełnienie, RCM naprawia losową numerację
+ */
+void SparseDirectTest1() {
+    int m = 60;
+    auto A = diffusion(m, 2, 1e4);
+    auto b = randomVector(A.rows(), 2);
+
+    size_t fill[3];
+    FillOrdering orderings[3] = { FillOrdering::Natural, FillOrdering::AMD, FillOrdering::RCM };
+    for (int o = 0; o < 3; o++) {
+        numlib::SparseCholesky chol(A, orderings[o]);
+        auto x = chol.solve(b);
+        double res = relativeResidual(A, x, b);
+        fill[o] = chol.analysis().factorNonzeros();
+        cout << "uporządkowanie " << o << ": nnz(L) = " << fill[o] << ", supernody "
+             << chol.analysis().supernodeCount() << ", residuum " << res << endl;
+        assertTest(res < 1e-10, "Za duże residuum rozkładu Cholesky'ego");
+    }
+    assertTest(fill[1] * 2 < fill[0], "AMD powinno wyraźnie zmniejszyć wypełnienie");
+
+    // CG bez preconditionera nie radzi sobie przy tym kontraście
+    auto cg = numlib::CG(A, b, nullptr, 1e-10, 500);
+    cout << "CG po 500 iteracjach: residuum " << cg.residual << endl;
+    assertTest(!cg.converged, "CG nie powinno zbiec przy takim uwarunkowaniu");
+
+    // Losowa numeracja psuje naturalne pasmo; RCM i AMD je odzyskują
+    vector<int> shuffle(A.rows());
+    for (size_t i = 0; i < shuffle.size(); i++) shuffle[i] = (int)i;
+    std::shuffle(shuffle.begin(), shuffle.end(), mt19937(3));
+    auto S = permuted(A, shuffle);
+    numlib::SparseSymbolic natural(S, FillOrdering::Natural), rcm(S, FillOrdering::RCM), amd(S, FillOrdering::AMD);
+    cout << "po przemieszaniu: naturalne " << natural.factorNonzeros() << ", RCM " << rcm.factorNonzeros()
+         << ", AMD " << amd.factorNonzeros() << endl;
+    assertTest(rcm.factorNonzeros() * 5 < natural.factorNonzeros(), "RCM powinno odzyskać pasmo");
+    assertTest(amd.factorNonzeros() < rcm.factorNonzeros(), "AMD powinno dać mniejsze wypełnienie niż RCM");
+
+    // Permutacje są poprawne
+    auto p = numlib::approximateMinimumDegree(S);
+    auto q = numlib::reverseCuthillMcKee(S);
+    sort(p.begin(), p.end());
+    sort(q.begin(), q.end());
+    for (size_t i = 0; i < p.size(); i++) {
+        assertTest(p[i] == (int)i && q[i] == (int)i, "Uporządkowanie nie jest permutacją");
+    }
+}
+
+/**
+ * Test 2: LU dla macierzy o niesymetrycznym wzorcu - porównanie z gęstym GaussSolve
+ */
+void SparseDirectTest2() {
+    int n = 300;
+    auto A = unsymmetric(n, 4, 5);
+    auto b = randomVector(n, 6);
+    numlib::SparseLU lu(A);
+    auto x = lu.solve(b);
+
+    numlib::Matrix dense(n, n);
+    const auto& ptr = A.rowPointers();
+    for (int i = 0; i < n; i++) {
+        for (size_t q = ptr[i]; q < ptr[i + 1]; q++) dense(i, A.columnIndices()[q]) = A.values()[q];
+    }
+    auto reference = numlib::GaussSolve(dense.view(), b);
+    double diff = 0.0;
+    for (int i = 0; i < n; i++) diff = max(diff, fabs(x[i] - reference[i]));
+    cout << "LU: residuum " << relativeResidual(A, x, b) << ", różnica z GaussSolve " << diff << endl;
+    assertTest(diff < 1e-10, "Rozwiązanie różni się od gęstego");
+
+    // Konwekcja-dyfuzja: niesymetryczne wartości, wymagany wybór w supernodach
+    int m = 50;
+    numlib::CooBuilder coo(m * m, m * m);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            coo.add(k, k, 1e-3);
+            if (i > 0) coo.add(k, k - m, -1.0);
+            if (i + 1 < m) coo.add(k, k + m, 1.0);
+            if (j > 0) coo.add(k, k - 1, -2.0);
+            if (j + 1 < m) coo.add(k, k + 1, 2.5);
+        }
+    }
+    auto C = coo.build();
+    auto c = randomVector(C.rows(), 7);
+    numlib::SparseLU luC(C, FillOrdering::AMD);
+    double res = relativeResidual(C, luC.solve(c), c);
+    cout << "konwekcja: residuum " << res << endl;
+    assertTest(res < 1e-12, "Za duże residuum dla macierzy konwekcji");
+}
+
+/**
+ * Test 3: wielokrotny rozkład z jedną analizą symboliczną
+ */
+void SparseDirectTest3() {
+    auto A = diffusion(40, 2, 10.0);
+    numlib::SparseSymbolic analysis(A);
+    numlib::SparseCholesky chol(analysis, A);
+    numlib::SparseLU lu(analysis, A);
+    auto b = randomVector(A.rows(), 8);
+
+    for (int step = 1; step <= 20; step++) {
+        // Te same pozycje, inne wartości: A + step * I
+        numlib::SparseMatrix B = A;
+        for (size_t i = 0; i < B.rows(); i++) {
+            for (size_t q = B.rowPointers()[i]; q < B.rowPointers()[i + 1]; q++) {
+                if (B.columnIndices()[q] == (int)i) B.values()[q] += step;
+            }
+        }
+        chol.factorize(B);
+        lu.factorize(B);
+        double r1 = relativeResidual(B, chol.solve(b), b);
+        double r2 = relativeResidual(B, lu.solve(b), b);
+        assertTest(r1 < 1e-12 && r2 < 1e-12, "Za duże residuum po ponownym rozkładzie");
+    }
+
+    bool thrown = false;
+    try {
+        chol.factorize(diffusion(40, 2, 10.0, 9));
+        auto other = unsymmetric(1600, 3, 9);
+        chol.factorize(other);
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla innego wzorca");
+}
+
+/**
+ * Test 4: dyfuzja 3D (duże supernody liczone przez gemm) - wynik niezależny od liczby wątków
+ */
+void SparseDirectTest4() {
+    auto A = diffusion(20, 3, 100.0);
+    auto b = randomVector(A.rows(), 10);
+
+    numlib::setNumThreads(1);
+    auto x1 = numlib::SparseCholesky(A).solve(b);
+    auto y1 = numlib::SparseLU(A).solve(b);
+    numlib::setNumThreads(4);
+    numlib::SparseCholesky chol(A);
+    auto x4 = chol.solve(b);
+    auto y4 = numlib::SparseLU(A).solve(b);
+    numlib::setNumThreads(0);
+
+    size_t widest = 0;
+    const auto& starts = chol.analysis().supernodeStarts();
+    for (size_t s = 0; s + 1 < starts.size(); s++) widest = max(widest, (size_t)(starts[s + 1] - starts[s]));
+    cout << "3D: nnz(L) = " << chol.analysis().factorNonzeros() << ", najszerszy supernod " << widest
+         << ", residuum " << relativeResidual(A, x4, b) << endl;
+    assertTest(widest >= 100, "Oczekiwano szerokich supernodów w 3D");
+    assertTest(x1 == x4 && y1 == y4, "Wynik zależy od liczby wątków");
+    assertTest(relativeResidual(A, x4, b) < 1e-12, "Za duże residuum w 3D");
+    assertTest(relativeResidual(A, y4, b) < 1e-12, "Za duże residuum LU w 3D");
+}
+
+/**
+ * Test 5: błędy - macierz niekwadratowa, nieokreślona, zły rozmiar prawej strony
+ */
+void SparseDirectTest5() {
+    bool thrown = false;
+    try {
+        numlib::CooBuilder coo(3, 4);
+        coo.add(0, 0, 1.0);
+        numlib::SparseSymbolic bad(coo.build());
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy niekwadratowej");
+
+    numlib::CooBuilder coo(3, 3);
+    coo.add(0, 0, 1.0);
+    coo.add(0, 1, 2.0);
+    coo.add(1, 0, 2.0);
+    coo.add(1, 1, 1.0);
+    coo.add(2, 2, 1.0);
+    auto indefinite = coo.build();
+    thrown = false;
+    try {
+        numlib::SparseCholesky chol(indefinite);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla macierzy nieokreślonej");
+
+    // LU radzi sobie z tą samą macierzą
+    numlib::SparseLU lu(indefinite);
+    auto x = lu.solve({ 3.0, 3.0, 1.0 });
+    assertTest(fabs(x[0] - 1.0) < 1e-14 && fabs(x[1] - 1.0) < 1e-14 && fabs(x[2] - 1.0) < 1e-14,
+               "Nieprawidłowe rozwiązanie LU");
+
+    thrown = false;
+    try {
+        lu.solve({ 1.0, 2.0 });
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla złego rozmiaru prawej strony");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 5;
+
+    if (runTest("Test1", SparseDirectTest1)) passedTests++;
+    if (runTest("Test2", SparseDirectTest2)) passedTests++;
+    if (runTest("Test3", SparseDirectTest3)) passedTests++;
+    if (runTest("Test4", SparseDirectTest4)) passedTests++;
+    if (runTest("Test5", SparseDirectTest5)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,149 @@
+#include "../include/numlib/UkladyPasmowe.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+/**
+ * Test 1: Algorytm Thomasa dla dyskretyzacji -u'' = 2 na [0, 1], u(0) = u(1) = 0
+ * Rozwiązanie dokładne u = x(1 - x) jest odtwarzane dokładnie przez schemat trzypunktowy
+ */
+void BandTest1() {
+    int n = 100000;
+    double h = 1.0 / (n + 1);
+    vector<double> lower(n - 1, -1.0), diag(n, 2.0), upper(n - 1, -1.0), rhs(n, 2.0 * h * h);
+
+    auto u = numlib::Thomas(lower, diag, upper, rhs);
+
+    double maxError = 0.0;
+    for (int i = 0; i < n; i++) {
+        double x = (i + 1) * h;
+        maxError = max(maxError, abs(u[i] - x * (1 - x)));
+    }
+    cout << "max błąd = " << maxError << endl;
+    assertTest(maxError < 1e-6, "Zbyt duży błąd algorytmu Thomasa");
+}
+
+/**
+ * Test 2: Wersja wsadowa daje te same wyniki co pojedyncze wywołania
+ */
+void BandTest2() {
+    size_t n = 37, batch = 1100;
+    vector<double> lower((n - 1) * batch), diag(n * batch), upper((n - 1) * batch), rhs(n * batch);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t s = 0; s < batch; s++) {
+            diag[i * batch + s] = 4.0 + (s % 5);
+            rhs[i * batch + s] = sin(0.1 * i + 0.01 * s);
+            if (i + 1 < n) {
+                lower[i * batch + s] = -1.0 - 0.001 * s;
+                upper[i * batch + s] = 1.5;
+            }
+        }
+    }
+    vector<double> batched(rhs);
+    numlib::ThomasBatched(n, batch, lower, diag, upper, batched);
+
+    for (size_t s = 0; s < batch; s += 97) {
+        vector<double> lo(n - 1), di(n), up(n - 1), r(n);
+        for (size_t i = 0; i < n; i++) {
+            di[i] = diag[i * batch + s];
+            r[i] = rhs[i * batch + s];
+            if (i + 1 < n) {
+                lo[i] = lower[i * batch + s];
+                up[i] = upper[i * batch + s];
+            }
+        }
+        auto x = numlib::Thomas(lo, di, up, r);
+        for (size_t i = 0; i < n; i++) {
+            assertTest(abs(x[i] - batched[i * batch + s]) < 1e-13, "Wyniki wsadowe różnią się od pojedynczych");
+        }
+    }
+}
+
+/**
+ * Test 3: Pasmowy rozkład LU (kl = 2, ku = 1) z wymuszoną zamianą wierszy,
+ * porównanie z gęstym rozkładem LU
+ */
+void BandTest3() {
+    size_t n = 60, kl = 2, ku = 1;
+    numlib::BandMatrix B(n, kl, ku);
+    numlib::Matrix D(n, n);
+    unsigned seed = 99;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = (i >= kl ? i - kl : 0); j <= min(n - 1, i + ku); j++) {
+            seed = seed * 1103515245u + 12345u;
+            double v = (seed >> 16) % 1000 / 500.0 - 1.0;
+            if (i == j) v *= 0.01;  // mały element na przekątnej wymusza wybór elementu głównego
+            B(i, j) = v;
+            D(i, j) = v;
+        }
+    }
+    const numlib::BandMatrix& constB = B;
+    assertTest(!B.inBand(5, 9) && constB(5, 9) == 0.0, "Element poza pasmem powinien być zerowy");
+
+    vector<double> b(n);
+    for (size_t i = 0; i < n; i++) b[i] = 1.0 + i % 3;
+
+    auto y = B.multiply(b);
+    numlib::BandLU lu(B);
+    auto x = lu.solve(b);
+    auto xDense = numlib::LU(D).solve(b);
+    auto Ax = B.multiply(x);
+
+    for (size_t i = 0; i < n; i++) {
+        double expected = 0.0;
+        for (size_t j = 0; j < n; j++) expected += D(i, j) * b[j];
+        assertTest(abs(y[i] - expected) < 1e-12, "Błędne mnożenie macierzy pasmowej");
+        assertTest(abs(x[i] - xDense[i]) < 1e-8, "Rozwiązanie pasmowe różni się od gęstego");
+        assertTest(abs(Ax[i] - b[i]) < 1e-10, "Zbyt duże residuum rozwiązania pasmowego");
+    }
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", BandTest1)) passedTests++;
+    if (runTest("Test2", BandTest2)) passedTests++;
+    if (runTest("Test3", BandTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,255 @@
+#include "../include/numlib/UkladyStrukturalne.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/Interpolacja.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+#include <chrono>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+
+// Jawna macierz Toeplitza T(i, j) = column[i-j] (i >= j) lub row[j-i]
+numlib::Matrix toeplitz(const vector<double>& column, const vector<double>& row) {
+    size_t n = column.size();
+    numlib::Matrix T(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) T(i, j) = i >= j ? column[i - j] : row[j - i];
+    }
+    return T;
+}
+
+double maxDiff(const vector<double>& a, const vector<double>& b) {
+    double m = 0.0;
+    for (size_t i = 0; i < a.size(); i++) m = max(m, abs(a[i] - b[i]));
+    return m;
+}
+
+vector<double> randomVector(size_t n, unsigned seed) {
+    vector<double> v(n);
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        v[i] = (seed >> 16) % 2001 / 1000.0 - 1.0;
+    }
+    return v;
+}
+
+// Test 1: symetryczna macierz Toeplitza (Kac-Murdock-Szegő r_k = rho^k) - porównanie z GaussSolve
+void StructuredTest1() {
+    size_t n = 200;
+    vector<double> r(n);
+    for (size_t k = 0; k < n; k++) r[k] = 3.0 * pow(0.7, k);
+    vector<double> b = randomVector(n, 1);
+    numlib::Matrix T = toeplitz(r, r);
+    vector<double> reference = numlib::GaussSolve(T, b);
+
+    vector<double> x = numlib::SymmetricToeplitzSolve(r, b);
+    assertTest(maxDiff(x, reference) < 1e-10, "SymmetricToeplitzSolve niezgodny z GaussSolve");
+    vector<double> y = numlib::ToeplitzSolve(r, r, b);
+    assertTest(maxDiff(y, reference) < 1e-10, "ToeplitzSolve niezgodny z GaussSolve dla macierzy symetrycznej");
+
+    // n = 1
+    vector<double> single = numlib::SymmetricToeplitzSolve({4.0}, {2.0});
+    assertTest(single.size() == 1 && abs(single[0] - 0.5) < 1e-15, "Błąd dla n = 1");
+}
+
+// Test 2: niesymetryczna macierz Toeplitza
+void StructuredTest2() {
+    size_t n = 150;
+    vector<double> column = randomVector(n, 7), row = randomVector(n, 11);
+    column[0] = row[0] = 8.0;       // dominująca przekątna - wiodące podmacierze nieosobliwe
+    for (size_t k = 1; k < n; k++) {
+        column[k] /= k * k;
+        row[k] /= k * k;
+    }
+    vector<double> b = randomVector(n, 13);
+    vector<double> reference = numlib::GaussSolve(toeplitz(column, row), b);
+    vector<double> x = numlib::ToeplitzSolve(column, row, b);
+    assertTest(maxDiff(x, reference) < 1e-12, "ToeplitzSolve niezgodny z GaussSolve");
+
+    // Wiodąca podmacierz 2 x 2 osobliwa
+    bool thrown = false;
+    try { numlib::ToeplitzSolve({1.0, 1.0, 0.0}, {1.0, 1.0, 5.0}, {1.0, 2.0, 3.0}); }
+    catch (const runtime_error&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla osobliwej wiodącej podmacierzy");
+}
+
+// Test 3: rekurencja Levinsona-Durbina i odwrotność Trencha
+void StructuredTest3() {
+    // Proces AR(2) x_t = 0.75 x_{t-1} - 0.5 x_{t-2} + e_t: autokorelacja z równań Yule'a-Walkera
+    double a1 = 0.75, a2 = -0.5;
+    size_t p = 10;
+    vector<double> r(p + 1);
+    r[0] = 1.0;
+    r[1] = a1 / (1.0 - a2);
+    for (size_t k = 2; k <= p; k++) r[k] = a1 * r[k - 1] + a2 * r[k - 2];
+
+    numlib::LevinsonDurbinResult model = numlib::LevinsonDurbin(r, p);
+    assertTest(abs(model.coefficients[0] - a1) < 1e-12 && abs(model.coefficients[1] - a2) < 1e-12,
+               "Nieodtworzone współczynniki AR(2)");
+    for (size_t k = 2; k < p; k++) {
+        assertTest(abs(model.coefficients[k]) < 1e-12, "Współczynniki rzędu > 2 powinny być zerowe");
+        assertTest(abs(model.reflection[k]) < 1e-12, "Współczynniki odbicia rzędu > 2 powinny być zerowe");
+    }
+    assertTest(abs(model.reflection[1] - a2) < 1e-12, "Błędny współczynnik odbicia rzędu 2");
+    double noise = r[0] - a1 * r[1] - a2 * r[2];
+    assertTest(abs(model.error - noise) < 1e-12, "Błędna wariancja błędu predykcji");
+
+    numlib::LevinsonDurbinResult empty = numlib::LevinsonDurbin(r, 0);
+    assertTest(empty.coefficients.empty() && empty.error == r[0], "Błąd dla rzędu 0");
+
+    for (size_t n : {1u, 2u, 5u, 6u, 60u}) {
+        vector<double> t(n);
+        for (size_t k = 0; k < n; k++) t[k] = 2.0 / (1.0 + k * k);
+        t[0] = 5.0;
+        numlib::Matrix B = numlib::SymmetricToeplitzInverse(t);
+        numlib::Matrix T = toeplitz(t, t);
+        double worst = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                double s = 0.0;
+                for (size_t k = 0; k < n; k++) s += T(i, k) * B(k, j);
+                worst = max(worst, abs(s - (i == j ? 1.0 : 0.0)));
+            }
+        }
+        assertTest(worst < 1e-12, "T B != I dla odwrotności Trencha");
+    }
+}
+
+// Test 4: układy Vandermonde'a algorytmem Björcka-Pereyry
+void StructuredTest4() {
+    const double pi = acos(-1.0);
+    size_t n = 12;
+    vector<double> nodes(n), coeffs = randomVector(n, 5), values(n);
+    for (size_t i = 0; i < n; i++) nodes[i] = -cos((2.0 * i + 1.0) * pi / (2.0 * n));
+    for (size_t i = 0; i < n; i++) {
+        double v = 0.0;
+        for (size_t j = n; j-- > 0;) v = v * nodes[i] + coeffs[j];
+        values[i] = v;
+    }
+    vector<double> a = numlib::VandermondeSolve(nodes, values);
+    assertTest(maxDiff(a, coeffs) < 1e-12, "VandermondeSolve nie odtworzył współczynników");
+
+    // Ta sama droga przez ilorazy różnicowe
+    vector<double> viaNewton = numlib::NewtonToMonomial(nodes, numlib::DividedDiff(nodes, values));
+    assertTest(maxDiff(viaNewton, a) == 0.0, "NewtonToMonomial(DividedDiff) różni się od VandermondeSolve");
+
+    // Wagi kwadratury interpolacyjnej na [-1, 1]: momenty 2 / (j + 1) dla parzystych j
+    vector<double> moments(n);
+    for (size_t j = 0; j < n; j++) moments[j] = j % 2 == 0 ? 2.0 / (j + 1) : 0.0;
+    vector<double> w = numlib::VandermondeTransposeSolve(nodes, moments);
+    for (size_t j = 0; j < n; j++) {
+        double s = 0.0;
+        for (size_t i = 0; i < n; i++) s += w[i] * pow(nodes[i], j);
+        assertTest(abs(s - moments[j]) < 1e-13, "VandermondeTransposeSolve nie spełnia układu");
+    }
+    // Wagi Fejéra są dodatnie, a ich suma to długość przedziału
+    double total = 0.0;
+    for (double wi : w) {
+        assertTest(wi > 0.0, "Ujemna waga kwadratury");
+        total += wi;
+    }
+    assertTest(abs(total - 2.0) < 1e-13, "Suma wag różna od 2");
+}
+
+// Test 5: obsługa błędów
+void StructuredTest5() {
+    bool thrown = false;
+    try { numlib::ToeplitzSolve({1.0, 2.0}, {3.0, 2.0}, {1.0, 1.0}); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla column[0] != row[0]");
+
+    thrown = false;
+    try { numlib::ToeplitzSolve({1.0, 2.0}, {1.0}, {1.0, 1.0}); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla złej długości wiersza");
+
+    thrown = false;
+    try { numlib::SymmetricToeplitzSolve({1.0, 2.0}, {1.0, 1.0}); } catch (const runtime_error&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla macierzy nieokreślonej");
+
+    thrown = false;
+    try { numlib::SymmetricToeplitzInverse({1.0, 1.0, 1.0}); } catch (const runtime_error&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla osobliwej macierzy w odwrotności Trencha");
+
+    thrown = false;
+    try { numlib::LevinsonDurbin({1.0, 0.5}, 2); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla zbyt krótkiej autokorelacji");
+
+    thrown = false;
+    try { numlib::VandermondeSolve({0.0, 1.0, 0.0}, {1.0, 2.0, 3.0}); } catch (const runtime_error&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla powtórzonych węzłów");
+
+    thrown = false;
+    try { numlib::VandermondeTransposeSolve({0.0, 1.0}, {1.0}); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla niezgodnych długości");
+}
+
+// Test 6: O(n^2) zamiast O(n^3) - porównanie czasu z GaussSolve
+void StructuredTest6() {
+    size_t n = 1500;
+    vector<double> r(n);
+    for (size_t k = 0; k < n; k++) r[k] = 1.0 / (1.0 + k);
+    r[0] = 4.0;
+    vector<double> b = randomVector(n, 3);
+
+    auto t0 = chrono::steady_clock::now();
+    vector<double> x = numlib::SymmetricToeplitzSolve(r, b);
+    auto t1 = chrono::steady_clock::now();
+    vector<double> reference = numlib::GaussSolve(toeplitz(r, r), b);
+    auto t2 = chrono::steady_clock::now();
+
+    double levinson = chrono::duration<double>(t1 - t0).count();
+    double gauss = chrono::duration<double>(t2 - t1).count();
+    cout << "n = " << n << ": Levinson " << levinson << " s, Gauss " << gauss << " s" << endl;
+    assertTest(maxDiff(x, reference) < 1e-10, "Wyniki Levinsona i Gaussa różne");
+    assertTest(levinson < gauss, "Levinson nie jest szybszy od eliminacji Gaussa");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 6;
+
+    if (runTest("Test1", StructuredTest1)) passedTests++;
+    if (runTest("Test2", StructuredTest2)) passedTests++;
+    if (runTest("Test3", StructuredTest3)) passedTests++;
+    if (runTest("Test4", StructuredTest4)) passedTests++;
+    if (runTest("Test5", StructuredTest5)) passedTests++;
+    if (runTest("Test6", StructuredTest6)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
@@ -0,0 +1,190 @@
+#include "../include/numlib/UkladyWsadowe.h"
+#include "../include/numlib/RownaniaLiniowe.h"
+#include "../include/numlib/JadraSIMD.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+// Losowe układy n x n w układzie SoA; co trzeci ma zero na przekątnej (wymusza wybór elementu głównego)
+void randomSystems(int n, size_t batch, vector<double>& A, vector<double>& b) {
+    A.assign(n * n * batch, 0.0);
+    b.assign(n * batch, 0.0);
+    unsigned seed = 12345 + n;
+    for (size_t s = 0; s < batch; s++) {
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                seed = seed * 1103515245u + 12345u;
+                double v = (seed >> 16) % 2000 / 1000.0 - 1.0;
+                if (i == j) v = (s % 3 == 0) ? 0.0 : v + 2.0;
+                A[(i * n + j) * batch + s] = v;
+            }
+            b[i * batch + s] = 1.0 + (i + s) % 5;
+        }
+    }
+}
+
+// Porównuje wynik wsadowy z rozkładem LU każdego układu osobno
+void checkAgainstLU(int n, size_t batch, const vector<double>& A, const vector<double>& b,
+                    const vector<double>& x) {
+    for (size_t s = 0; s < batch; s += 7) {
+        numlib::Matrix M(n, n);
+        vector<double> rhs(n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) M(i, j) = A[(i * n + j) * batch + s];
+            rhs[i] = b[i * batch + s];
+        }
+        auto expected = numlib::LU(M).solve(rhs);
+        for (int i = 0; i < n; i++) {
+            assertTest(abs(x[i * batch + s] - expected[i]) < 1e-9 * (1 + abs(expected[i])),
+                       "Wynik wsadowy różni się od rozkładu LU (n = " + to_string(n) + ")");
+        }
+    }
+}
+
+/**
+ * Test 1: Rozmiary 3, 7 i 12, liczba układów niepodzielna przez rozmiar paczki
+ */
+void BatchedTest1() {
+    size_t batch = 1003;
+    vector<double> A, b;
+
+    randomSystems(3, batch, A, b);
+    vector<double> x3(b);
+    numlib::SolveSmallBatched<3>(batch, A, x3);
+    checkAgainstLU(3, batch, A, b, x3);
+
+    randomSystems(7, batch, A, b);
+    vector<double> x7(b);
+    numlib::SolveSmallBatched<7>(batch, A, x7);
+    checkAgainstLU(7, batch, A, b, x7);
+
+    randomSystems(12, batch, A, b);
+    vector<double> x12(b);
+    numlib::SolveSmallBatched(12, batch, A, x12);
+    checkAgainstLU(12, batch, A, b, x12);
+}
+
+/**
+ * Test 2: Wszystkie poziomy SIMD dają ten sam wynik co wersja skalarna
+ */
+void BatchedTest2() {
+    int n = 5;
+    size_t batch = 517;
+    vector<double> A, b;
+    randomSystems(n, batch, A, b);
+
+    numlib::SimdLevel original = numlib::simd::activeLevel();
+    numlib::simd::setLevel(numlib::SimdLevel::Scalar);
+    vector<double> reference(b);
+    numlib::SolveSmallBatched<5>(batch, A, reference);
+
+    for (auto level : {numlib::SimdLevel::SSE2, numlib::SimdLevel::AVX2, numlib::SimdLevel::AVX512}) {
+        if (!numlib::simd::setLevel(level)) continue;
+        vector<double> x(b);
+        numlib::SolveSmallBatched<5>(batch, A, x);
+        for (size_t k = 0; k < x.size(); k++) {
+            assertTest(abs(x[k] - reference[k]) < 1e-12 * (1 + abs(reference[k])),
+                       string("Różnica wyników dla ") + numlib::simd::levelName(level));
+        }
+    }
+    numlib::simd::setLevel(original);
+}
+
+/**
+ * Test 3: Układ osobliwy, błędne wymiary i nieobsługiwany rozmiar
+ */
+void BatchedTest3() {
+    size_t batch = 20;
+    vector<double> A, b;
+    randomSystems(4, batch, A, b);
+    for (int j = 0; j < 4; j++) A[(2 * 4 + j) * batch + 13] = 0.0;  // zerowy wiersz w układzie 13
+
+    bool thrown = false;
+    try {
+        numlib::SolveSmallBatched<4>(batch, A, b);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla układu osobliwego");
+
+    // Prawie osobliwy: wiersz 3 układu 5 równy wierszowi 1 z zaburzeniem 1e-14 - ta sama granica co w LU
+    randomSystems(4, batch, A, b);
+    for (int j = 0; j < 4; j++) A[(3 * 4 + j) * batch + 5] = A[(1 * 4 + j) * batch + 5];
+    A[(3 * 4 + 3) * batch + 5] += 1e-14;
+    thrown = false;
+    try {
+        numlib::SolveSmallBatched<4>(batch, A, b);
+    }
+    catch (const runtime_error&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla układu prawie osobliwego");
+
+    thrown = false;
+    try {
+        numlib::SolveSmallBatched<4>(batch + 1, A, b);
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla błędnych wymiarów");
+
+    thrown = false;
+    try {
+        numlib::SolveSmallBatched(17, batch, A, b);
+    }
+    catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Oczekiwano wyjątku dla nieobsługiwanego rozmiaru");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 3;
+
+    if (runTest("Test1", BatchedTest1)) passedTests++;
+    if (runTest("Test2", BatchedTest2)) passedTests++;
+    if (runTest("Test3", BatchedTest3)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
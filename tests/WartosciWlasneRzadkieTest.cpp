@@ -0,0 +1,420 @@
+#include "../include/numlib/WartosciWlasneRzadkie.h"
+#include "../include/numlib/WartosciWlasne.h"
+#include "../include/numlib/MacierzRzadka.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <complex>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+// Laplasjan 5-punktowy na siatce nx x ny (warunki Dirichleta, bez czynnika 1/h^2)
+numlib::SparseMatrix laplacian2D(size_t nx, size_t ny) {
+    numlib::CooBuilder builder(nx * ny, nx * ny);
+    for (size_t j = 0; j < ny; j++) {
+        for (size_t i = 0; i < nx; i++) {
+            size_t k = j * nx + i;
+            builder.add(k, k, 4.0);
+            if (i > 0) builder.add(k, k - 1, -1.0);
+            if (i + 1 < nx) builder.add(k, k + 1, -1.0);
+            if (j > 0) builder.add(k, k - nx, -1.0);
+            if (j + 1 < ny) builder.add(k, k + nx, -1.0);
+        }
+    }
+    return builder.build();
+}
+
+// Dokładne wartości własne laplacianu 2D (rosnąco)
+vector<double> laplacianSpectrum(size_t nx, size_t ny) {
+    const double pi = acos(-1.0);
+    vector<double> values;
+    for (size_t i = 1; i <= nx; i++) {
+        for (size_t j = 1; j <= ny; j++) {
+            values.push_back(4.0 - 2.0 * cos(i * pi / (nx + 1)) - 2.0 * cos(j * pi / (ny + 1)));
+        }
+    }
+    sort(values.begin(), values.end());
+    return values;
+}
+
+// max ||A x_j - lambda_j x_j|| dla wyniku metody Lanczosa
+double maxResidual(const numlib::SparseMatrix& A, const numlib::SparseEigenResult& r) {
+    size_t n = A.rows();
+    double worst = 0.0;
+    for (size_t j = 0; j < r.values.size(); j++) {
+        vector<double> x(n);
+        for (size_t i = 0; i < n; i++) x[i] = r.vectors(i, j);
+        vector<double> Ax = A.multiply(x);
+        double s = 0.0;
+        for (size_t i = 0; i < n; i++) s += pow(Ax[i] - r.values[j] * x[i], 2);
+        worst = max(worst, sqrt(s));
+    }
+    return worst;
+}
+
+// max |V^T V - I|
+double orthogonalityError(const numlib::Matrix& V) {
+    double worst = 0.0;
+    for (size_t a = 0; a < V.cols(); a++) {
+        for (size_t b = 0; b < V.cols(); b++) {
+            double s = 0.0;
+            for (size_t i = 0; i < V.rows(); i++) s += V(i, a) * V(i, b);
+            worst = max(worst, abs(s - (a == b ? 1.0 : 0.0)));
+        }
+    }
+    return worst;
+}
+
+// max ||A x - lambda x|| dla zespolonych wektorów w zapisie z ArnoldiResult
+double maxResidual(const numlib::SparseMatrix& A, const numlib::ArnoldiResult& r) {
+    size_t n = A.rows();
+    double worst = 0.0;
+    for (size_t j = 0; j < r.values.size(); j++) {
+        vector<double> re(n), im(n, 0.0);
+        double lambdaIm = r.values[j].imag();
+        for (size_t i = 0; i < n; i++) {
+            if (lambdaIm == 0.0) {
+                re[i] = r.vectors(i, j);
+            } else if (lambdaIm > 0.0) {
+                re[i] = r.vectors(i, j);
+                im[i] = r.vectors(i, j + 1);
+            } else {
+                re[i] = r.vectors(i, j - 1);
+                im[i] = -r.vectors(i, j);
+            }
+        }
+        vector<double> Are = A.multiply(re), Aim = A.multiply(im);
+        double s = 0.0, norm = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            complex<double> x(re[i], im[i]);
+            s += std::norm(complex<double>(Are[i], Aim[i]) - r.values[j] * x);
+            norm += std::norm(x);
+        }
+        worst = max(worst, sqrt(s / norm));
+    }
+    return worst;
+}
+
+/*
+    Macierz blokowo górnotrójkątna o znanym widmie: na przekątnej 2.8 oraz
+    bloki [[a, b], [-b, a]] (wartości a +- ib), nad blokami sprzężenia 0.3.
+    Odstające wartości: 3 +- i, 2.8, 2.6 +- 0.5i, 2.2 +- 0.8i, reszta
+    z |Re| <= 1.
+*/
+numlib::SparseMatrix blockMatrix(size_t blocks, vector<complex<double>>& spectrum) {
+    size_t n = 2 * blocks + 1;
+    numlib::CooBuilder builder(n, n);
+    builder.add(0, 0, 2.8);
+    spectrum = {complex<double>(2.8, 0.0)};
+    for (size_t k = 0; k < blocks; k++) {
+        double a, b;
+        if (k == 0) { a = 3.0; b = 1.0; }
+        else if (k == 1) { a = 2.6; b = 0.5; }
+        else if (k == 2) { a = 2.2; b = 0.8; }
+        else {
+            a = -1.0 + 2.0 * k / blocks;
+            b = 0.1 + 0.4 * k / blocks;
+        }
+        size_t i = 1 + 2 * k;
+        builder.add(i, i, a);
+        builder.add(i, i + 1, b);
+        builder.add(i + 1, i, -b);
+        builder.add(i + 1, i + 1, a);
+        spectrum.push_back(complex<double>(a, b));
+        spectrum.push_back(complex<double>(a, -b));
+    }
+    for (size_t i = 0; i + 2 < n; i++) builder.add(i, i + 2, 0.3);
+    return builder.build();
+}
+
+bool containsValue(const vector<complex<double>>& spectrum, complex<double> value, double tolerance) {
+    for (const auto& s : spectrum) {
+        if (abs(s - value) <= tolerance) return true;
+    }
+    return false;
+}
+
+// Test 1: skrajne wartości laplacianu 2D - porównanie z gęstym rozkładem
+void SparseEigenTest1() {
+    size_t nx = 20, ny = 13, n = nx * ny;
+    numlib::SparseMatrix A = laplacian2D(nx, ny);
+    vector<double> exact = laplacianSpectrum(nx, ny);
+
+    numlib::KrylovEigenOptions options;
+    options.target = numlib::EigenTarget::Largest;
+    numlib::SparseEigenResult largest = numlib::Lanczos(A, 5, options);
+    assertTest(largest.converged, "Metoda Lanczosa (największe) nie zbiegła");
+    for (size_t j = 0; j < 5; j++) {
+        assertTest(abs(largest.values[j] - exact[n - 1 - j]) < 1e-9, "Błędna największa wartość własna");
+    }
+    assertTest(maxResidual(A, largest) < 1e-8, "Za duże residuum wektorów własnych");
+    assertTest(orthogonalityError(largest.vectors) < 1e-10, "Wektory nie są ortonormalne");
+
+    options.target = numlib::EigenTarget::Smallest;
+    options.subspace = 30;
+    numlib::SparseEigenResult smallest = numlib::Lanczos(A, 6, options);
+    assertTest(smallest.converged, "Metoda Lanczosa (najmniejsze) nie zbiegła");
+    numlib::Matrix dense(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t p = A.rowPointers()[i]; p < A.rowPointers()[i + 1]; p++) {
+            dense(i, A.columnIndices()[p]) = A.values()[p];
+        }
+    }
+    numlib::EigenDecomposition reference = numlib::SymmetricEigen(dense, false);
+    for (size_t j = 0; j < 6; j++) {
+        assertTest(abs(smallest.values[j] - reference.values[j]) < 1e-9, "Niezgodność z SymmetricEigen");
+    }
+    assertTest(maxResidual(A, smallest) < 1e-8, "Za duże residuum wektorów własnych");
+
+    // Podprzestrzeń równa całej przestrzeni - wynik dokładny bez restartów
+    numlib::SparseMatrix B = laplacian2D(4, 3);
+    options.subspace = 12;
+    numlib::SparseEigenResult full = numlib::Lanczos(B, 3, options);
+    assertTest(full.converged && full.restarts == 0, "Pełna podprzestrzeń powinna dać wynik od razu");
+    vector<double> exactB = laplacianSpectrum(4, 3);
+    for (size_t j = 0; j < 3; j++) {
+        assertTest(abs(full.values[j] - exactB[j]) < 1e-12, "Błędna wartość dla pełnej podprzestrzeni");
+    }
+}
+
+// Test 2: przesunięcie i odwrócenie - najmniejsze i wewnętrzne wartości
+void SparseEigenTest2() {
+    size_t nx = 60, ny = 45, n = nx * ny;
+    numlib::SparseMatrix A = laplacian2D(nx, ny);
+    vector<double> exact = laplacianSpectrum(nx, ny);
+
+    numlib::SparseCholesky cholesky(A);
+    numlib::SparseEigenResult smallest = numlib::LanczosShiftInvert(cholesky, 0.0, 6);
+    assertTest(smallest.converged, "Przesunięcie i odwrócenie (sigma = 0) nie zbiegło");
+    for (size_t j = 0; j < 6; j++) {
+        assertTest(abs(smallest.values[j] - exact[j]) < 1e-10, "Błędna najmniejsza wartość własna");
+    }
+    assertTest(maxResidual(A, smallest) < 1e-9, "Za duże residuum wektorów własnych");
+    assertTest(smallest.operations < 200, "Za dużo rozwiązań układu dla przesunięcia");
+
+    double sigma = 2.05;
+    numlib::CooBuilder shifted(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t p = A.rowPointers()[i]; p < A.rowPointers()[i + 1]; p++) {
+            shifted.add(i, A.columnIndices()[p], A.values()[p]);
+        }
+        shifted.add(i, i, -sigma);
+    }
+    numlib::SparseLU lu(shifted.build());
+    numlib::SparseEigenResult interior = numlib::LanczosShiftInvert(lu, sigma, 5);
+    assertTest(interior.converged, "Przesunięcie i odwrócenie (sigma wewnątrz widma) nie zbiegło");
+    vector<double> nearest = exact;
+    sort(nearest.begin(), nearest.end(), [sigma](double a, double b) { return abs(a - sigma) < abs(b - sigma); });
+    for (size_t j = 0; j < 5; j++) {
+        assertTest(abs(interior.values[j] - nearest[j]) < 1e-9, "Błędna wartość najbliższa sigma");
+    }
+    assertTest(maxResidual(A, interior) < 1e-8, "Za duże residuum wektorów wewnętrznych");
+}
+
+// Test 3: metoda Arnoldiego - zespolone pary dla macierzy niesymetrycznej
+void SparseEigenTest3() {
+    vector<complex<double>> spectrum;
+    numlib::SparseMatrix A = blockMatrix(500, spectrum);
+
+    numlib::KrylovEigenOptions options;
+    options.target = numlib::EigenTarget::Largest;
+    numlib::ArnoldiResult r = numlib::Arnoldi(A, 6, options);
+    assertTest(r.converged, "Metoda Arnoldiego nie zbiegła");
+    // 3 +- i, 2.8, 2.6 +- 0.5i, 2.2 + 0.8i oraz para sprzężona - razem 7
+    assertTest(r.values.size() == 7, "Para sprzężona na granicy powinna być zwrócona w całości");
+    vector<complex<double>> expected = {{3.0, 1.0}, {3.0, -1.0}, {2.8, 0.0}, {2.6, 0.5},
+                                        {2.6, -0.5}, {2.2, 0.8}, {2.2, -0.8}};
+    for (size_t j = 0; j < 7; j++) {
+        assertTest(abs(r.values[j] - expected[j]) < 1e-9, "Błędna wartość własna metody Arnoldiego");
+    }
+    assertTest(maxResidual(A, r) < 1e-8, "Za duże residuum wektorów zespolonych");
+
+    options.target = numlib::EigenTarget::LargestMagnitude;
+    numlib::ArnoldiResult magnitude = numlib::Arnoldi(A, 3, options);
+    assertTest(magnitude.converged, "Metoda Arnoldiego (moduł) nie zbiegła");
+    assertTest(abs(magnitude.values[0] - complex<double>(3.0, 1.0)) < 1e-9, "Błędna wartość o największym module");
+    assertTest(abs(magnitude.values[2] - complex<double>(2.8, 0.0)) < 1e-9, "Błędna wartość o największym module");
+    for (const auto& value : magnitude.values) {
+        assertTest(containsValue(spectrum, value, 1e-9), "Wartość spoza widma");
+    }
+}
+
+// Test 4: metoda Arnoldiego z przesunięciem i odwróceniem (rozkład SparseLU)
+void SparseEigenTest4() {
+    // Konwekcja-dyfuzja 1D: widmo rzeczywiste 2 - 2 sqrt(1 - p^2) cos(k pi / (n + 1))
+    size_t n = 100;
+    double p = 0.1;
+    numlib::CooBuilder builder(n, n);
+    for (size_t i = 0; i < n; i++) {
+        builder.add(i, i, 2.0);
+        if (i > 0) builder.add(i, i - 1, -1.0 - p);
+        if (i + 1 < n) builder.add(i, i + 1, -1.0 + p);
+    }
+    numlib::SparseMatrix A = builder.build();
+    numlib::SparseLU lu(A);
+    numlib::ArnoldiResult r = numlib::ArnoldiShiftInvert(lu, 0.0, 4);
+    assertTest(r.converged, "Przesunięcie i odwrócenie nie zbiegło");
+    const double pi = acos(-1.0);
+    for (size_t j = 0; j < 4; j++) {
+        double exact = 2.0 - 2.0 * sqrt(1.0 - p * p) * cos((j + 1) * pi / (n + 1));
+        assertTest(abs(r.values[j].imag()) == 0.0, "Wartość powinna być rzeczywista");
+        assertTest(abs(r.values[j].real() - exact) < 1e-9, "Błędna wartość własna konwekcji-dyfuzji");
+    }
+    assertTest(maxResidual(A, r) < 1e-9, "Za duże residuum");
+
+    // Pary zespolone: po odwróceniu znowu najpierw część urojona dodatnia
+    vector<complex<double>> spectrum;
+    numlib::SparseMatrix B = blockMatrix(200, spectrum);
+    double sigma = 2.5;
+    numlib::CooBuilder shifted(B.rows(), B.cols());
+    for (size_t i = 0; i < B.rows(); i++) {
+        for (size_t q = B.rowPointers()[i]; q < B.rowPointers()[i + 1]; q++) {
+            shifted.add(i, B.columnIndices()[q], B.values()[q]);
+        }
+        shifted.add(i, i, -sigma);
+    }
+    numlib::SparseLU luB(shifted.build());
+    numlib::ArnoldiResult near = numlib::ArnoldiShiftInvert(luB, sigma, 3);
+    assertTest(near.converged && near.values.size() == 3, "Przesunięcie i odwrócenie (pary) nie zbiegło");
+    assertTest(abs(near.values[0] - complex<double>(2.8, 0.0)) < 1e-9, "Błędna wartość najbliższa sigma");
+    assertTest(abs(near.values[1] - complex<double>(2.6, 0.5)) < 1e-9, "Błędna kolejność w parze sprzężonej");
+    assertTest(abs(near.values[2] - complex<double>(2.6, -0.5)) < 1e-9, "Błędna kolejność w parze sprzężonej");
+    assertTest(maxResidual(B, near) < 1e-8, "Za duże residuum wektorów zespolonych");
+}
+
+// Test 5: operator bez jawnej macierzy; wynik niezależny od liczby wątków
+void SparseEigenTest5() {
+    size_t nx = 300, ny = 200, n = nx * ny;
+    numlib::LinearOperator stencil = [nx, ny](const vector<double>& x, vector<double>& y) {
+        for (size_t j = 0; j < ny; j++) {
+            for (size_t i = 0; i < nx; i++) {
+                size_t k = j * nx + i;
+                double s = 4.0 * x[k];
+                if (i > 0) s -= x[k - 1];
+                if (i + 1 < nx) s -= x[k + 1];
+                if (j > 0) s -= x[k - nx];
+                if (j + 1 < ny) s -= x[k + nx];
+                y[k] = s;
+            }
+        }
+    };
+    numlib::KrylovEigenOptions options;
+    options.maxRestarts = 15;
+    numlib::setNumThreads(1);
+    numlib::SparseEigenResult one = numlib::Lanczos(stencil, n, 4, options);
+    numlib::ArnoldiResult oneA = numlib::Arnoldi(stencil, n, 2, options);
+    numlib::setNumThreads(4);
+    numlib::SparseEigenResult four = numlib::Lanczos(stencil, n, 4, options);
+    numlib::ArnoldiResult fourA = numlib::Arnoldi(stencil, n, 2, options);
+    numlib::setNumThreads(0);
+
+    assertTest(one.operations == four.operations, "Liczba mnożeń zależy od liczby wątków");
+    for (size_t j = 0; j < 4; j++) {
+        assertTest(one.values[j] == four.values[j], "Wartości zależą od liczby wątków");
+        for (size_t i = 0; i < n; i++) {
+            assertTest(one.vectors(i, j) == four.vectors(i, j), "Wektory zależą od liczby wątków");
+        }
+    }
+    for (size_t j = 0; j < oneA.values.size(); j++) {
+        assertTest(oneA.values[j] == fourA.values[j], "Wartości Arnoldiego zależą od liczby wątków");
+    }
+    // Wartości Ritza przybliżają widmo od środka - nie mogą przekroczyć największej wartości
+    vector<double> exact = laplacianSpectrum(nx, ny);
+    assertTest(one.values[0] <= exact.back() + 1e-12 && one.values[0] > exact.back() - 1e-3,
+               "Wartość Ritza poza oczekiwanym zakresem");
+}
+
+// Test 6: obsługa błędów
+void SparseEigenTest6() {
+    numlib::SparseMatrix A = laplacian2D(5, 4);
+    bool thrown = false;
+    try { numlib::Lanczos(A, 0); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla nev = 0");
+
+    thrown = false;
+    try { numlib::Lanczos(A, 20); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla nev >= n");
+
+    thrown = false;
+    try { numlib::Arnoldi(A, 19); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla nev + 1 >= n (Arnoldi)");
+
+    numlib::KrylovEigenOptions options;
+    options.subspace = 4;
+    thrown = false;
+    try { numlib::Lanczos(A, 4, options); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla za małej podprzestrzeni");
+
+    options.subspace = 0;
+    options.start = vector<double>(7, 1.0);
+    thrown = false;
+    try { numlib::Lanczos(A, 2, options); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla złej długości wektora startowego");
+
+    options.start = vector<double>(20, 0.0);
+    thrown = false;
+    try { numlib::Lanczos(A, 2, options); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla zerowego wektora startowego");
+
+    numlib::LinearOperator wrong = [](const vector<double>&, vector<double>& y) { y.assign(3, 0.0); };
+    thrown = false;
+    try { numlib::Lanczos(wrong, 20, 2); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla złego wyniku operatora");
+
+    numlib::SparseMatrix rectangular = numlib::CooBuilder(3, 4).build();
+    thrown = false;
+    try { numlib::Lanczos(rectangular, 1); } catch (const invalid_argument&) { thrown = true; }
+    assertTest(thrown, "Brak wyjątku dla macierzy niekwadratowej");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 6;
+
+    if (runTest("Test1", SparseEigenTest1)) passedTests++;
+    if (runTest("Test2", SparseEigenTest2)) passedTests++;
+    if (runTest("Test3", SparseEigenTest3)) passedTests++;
+    if (runTest("Test4", SparseEigenTest4)) passedTests++;
+    if (runTest("Test5", SparseEigenTest5)) passedTests++;
+    if (runTest("Test6", SparseEigenTest6)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}
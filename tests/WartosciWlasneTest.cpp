@@ -0,0 +1,310 @@
+#include "../include/numlib/WartosciWlasne.h"
+#include "../include/numlib/MnozenieMacierzy.h"
+#include "../include/numlib/Watki.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+// Klasa wyjątku używana do sygnalizowania niepowodzenia testu
+class TestFailedException : public runtime_error {
+public:
+    TestFailedException(const string& message) : runtime_error(message) {}
+};
+
+// Funkcja pomocnicza do weryfikacji warunków testowych
+void assertTest(bool condition, const string& message) {
+    if (!condition) {
+        throw TestFailedException(message);
+    }
+}
+
+// Obsługuje wyjątki i wyświetla wyniki testów
+bool runTest(const string& testName, void (*testFunction)()) {
+    cout << "\nUruchamiam " << testName << "..." << endl;
+    try {
+        testFunction();
+        cout << testName << " PASSED" << endl;
+        return true;
+    }
+    catch (const TestFailedException& e) {
+        cout << testName << " FAILED: " << e.what() << endl;
+        return false;
+    }
+    catch (const std::exception& e) {
+        cout << testName << " FAILED z nieoczekiwanym wyjątkiem: " << e.what() << endl;
+        return false;
+    }
+}
+
+// Symetryczna macierz losowa o elementach z [-1, 1]
+numlib::Matrix randomSymmetric(size_t n, unsigned seed) {
+    numlib::Matrix A(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j <= i; j++) {
+            seed = seed * 1103515245u + 12345u;
+            A(i, j) = A(j, i) = (seed >> 16) % 2001 / 1000.0 - 1.0;
+        }
+    }
+    return A;
+}
+
+// A = Q diag(values) Q^T, Q - odbicie Householdera I - 2 w w^T / (w^T w)
+numlib::Matrix withSpectrum(const vector<double>& values, unsigned seed) {
+    size_t n = values.size();
+    vector<double> w(n);
+    double ww = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        w[i] = (seed >> 16) % 2001 / 1000.0 - 1.0;
+        ww += w[i] * w[i];
+    }
+    numlib::Matrix Q = numlib::Matrix::identity(n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) Q(i, j) -= 2.0 * w[i] * w[j] / ww;
+    }
+    numlib::Matrix QD(n, n), A(n, n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) QD(i, j) = Q(i, j) * values[j];
+    }
+    numlib::gemm(numlib::Op::None, numlib::Op::Transpose, 1.0, QD, Q, 0.0, A);
+    return A;
+}
+
+double maxAbs(numlib::ConstMatrixView A) {
+    double m = 0.0;
+    for (size_t i = 0; i < A.rows(); i++) {
+        for (size_t j = 0; j < A.cols(); j++) m = max(m, abs(A(i, j)));
+    }
+    return m;
+}
+
+// max |A V - V diag(values)| / max |A|
+double eigenResidual(const numlib::Matrix& A, const numlib::EigenDecomposition& r) {
+    numlib::Matrix AV = numlib::multiply(A, r.vectors);
+    for (size_t i = 0; i < AV.rows(); i++) {
+        for (size_t j = 0; j < AV.cols(); j++) AV(i, j) -= r.vectors(i, j) * r.values[j];
+    }
+    return maxAbs(AV) / maxAbs(A);
+}
+
+// max |V^T V - I|
+double orthogonalityError(const numlib::Matrix& V) {
+    numlib::Matrix G(V.cols(), V.cols());
+    numlib::gemm(numlib::Op::Transpose, numlib::Op::None, 1.0, V, V, 0.0, G);
+    for (size_t i = 0; i < G.rows(); i++) G(i, i) -= 1.0;
+    return maxAbs(G);
+}
+
+/**
+ * Test 1: Macierz trójdiagonalna tridiag(-1, 2, -1) - wartości własne 2 - 2 cos(k pi / (n + 1))
+ * Rozmiar większy niż liście metody "dziel i zwyciężaj", więc wykonywane są łączenia
+ */
+void EigenTest1() {
+    const size_t n = 200;
+    vector<double> d(n, 2.0), e(n - 1, -1.0);
+    numlib::EigenDecomposition r = numlib::TridiagonalEigen(d, e);
+    numlib::EigenDecomposition values = numlib::TridiagonalEigen(d, e, false);
+    assertTest(r.values.size() == n && r.vectors.rows() == n && r.vectors.cols() == n, "Nieprawidłowe wymiary wyniku");
+    assertTest(values.vectors.empty(), "Dla samych wartości macierz wektorów powinna być pusta");
+    const double pi = acos(-1.0);
+    for (size_t k = 0; k < n; k++) {
+        double exact = 2.0 - 2.0 * cos((k + 1) * pi / (n + 1));
+        assertTest(abs(r.values[k] - exact) < 1e-13, "Błędna wartość własna (dziel i zwyciężaj)");
+        assertTest(abs(values.values[k] - exact) < 1e-13, "Błędna wartość własna (QL)");
+    }
+    numlib::Matrix T(n, n);
+    for (size_t i = 0; i < n; i++) {
+        T(i, i) = 2.0;
+        if (i + 1 < n) T(i, i + 1) = T(i + 1, i) = -1.0;
+    }
+    assertTest(eigenResidual(T, r) < 1e-14 * n, "Za duże residuum wektorów własnych");
+    assertTest(orthogonalityError(r.vectors) < 1e-14 * n, "Wektory własne nie są ortogonalne");
+}
+
+/**
+ * Test 2: Losowa macierz symetryczna - residuum, ortogonalność, zgodność z samymi wartościami
+ * oraz redukcja trójdiagonalna Q T Q^T = A
+ */
+void EigenTest2() {
+    const size_t n = 400;
+    numlib::Matrix A = randomSymmetric(n, 7);
+    numlib::EigenDecomposition r = numlib::SymmetricEigen(A);
+    assertTest(eigenResidual(A, r) < 1e-14 * n, "Za duże residuum rozkładu własnego");
+    assertTest(orthogonalityError(r.vectors) < 1e-14 * n, "Wektory własne nie są ortogonalne");
+    for (size_t k = 1; k < n; k++) assertTest(r.values[k - 1] <= r.values[k], "Wartości nie są rosnące");
+
+    numlib::EigenDecomposition values = numlib::SymmetricEigen(A, false);
+    for (size_t k = 0; k < n; k++) {
+        assertTest(abs(values.values[k] - r.values[k]) < 1e-12, "Wartości bez wektorów różnią się");
+    }
+
+    // Tylko dolny trójkąt A jest używany
+    numlib::Matrix L = A;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i + 1; j < n; j++) L(i, j) = 1e300;
+    }
+    numlib::Tridiagonalization tri(L, 16);
+    numlib::Matrix Q = tri.Q();
+    numlib::Matrix T(n, n);
+    for (size_t i = 0; i < n; i++) {
+        T(i, i) = tri.diagonal()[i];
+        if (i + 1 < n) T(i, i + 1) = T(i + 1, i) = tri.offDiagonal()[i];
+    }
+    numlib::Matrix QT = numlib::multiply(Q, T), QTQ(n, n);
+    numlib::gemm(numlib::Op::None, numlib::Op::Transpose, 1.0, QT, Q, 0.0, QTQ);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) QTQ(i, j) -= A(i, j);
+    }
+    assertTest(maxAbs(QTQ) < 1e-13 * n, "Q T Q^T różni się od A");
+    assertTest(orthogonalityError(Q) < 1e-14 * n, "Q nie jest ortogonalna");
+}
+
+/**
+ * Test 3: Widma z wielokrotnymi i bardzo bliskimi wartościami (silna deflacja)
+ */
+void EigenTest3() {
+    // Wartości 1, 2, 3 powtórzone po 100 razy
+    vector<double> spectrum;
+    for (int k = 0; k < 300; k++) spectrum.push_back(1.0 + k % 3);
+    numlib::Matrix A = withSpectrum(spectrum, 3);
+    numlib::EigenDecomposition r = numlib::SymmetricEigen(A);
+    for (size_t k = 0; k < spectrum.size(); k++) {
+        assertTest(abs(r.values[k] - (1.0 + k / 100)) < 1e-13, "Błędna wartość wielokrotna");
+    }
+    assertTest(eigenResidual(A, r) < 1e-13, "Za duże residuum dla wartości wielokrotnych");
+    assertTest(orthogonalityError(r.vectors) < 1e-13, "Wektory dla wartości wielokrotnych nie są ortogonalne");
+
+    // Macierz Wilkinsona W+ (pary wartości zgodne na kilkunastu cyfrach)
+    const size_t m = 150, n = 2 * m + 1;
+    vector<double> d(n), e(n - 1, 1.0);
+    for (size_t i = 0; i < n; i++) d[i] = abs(static_cast<double>(i) - static_cast<double>(m));
+    numlib::EigenDecomposition w = numlib::TridiagonalEigen(d, e);
+    numlib::Matrix T(n, n);
+    for (size_t i = 0; i < n; i++) {
+        T(i, i) = d[i];
+        if (i + 1 < n) T(i, i + 1) = T(i + 1, i) = 1.0;
+    }
+    assertTest(eigenResidual(T, w) < 1e-14 * n, "Za duże residuum dla macierzy Wilkinsona");
+    assertTest(orthogonalityError(w.vectors) < 1e-14 * n, "Wektory macierzy Wilkinsona nie są ortogonalne");
+
+    // Zerowe elementy poddiagonali - macierz blokowo przekątna
+    for (size_t i = 0; i < n - 1; i += 7) e[i] = 0.0;
+    numlib::EigenDecomposition b = numlib::TridiagonalEigen(d, e);
+    for (size_t i = 0; i < n - 1; i++) T(i, i + 1) = T(i + 1, i) = e[i];
+    assertTest(eigenResidual(T, b) < 1e-14 * n, "Za duże residuum dla macierzy blokowej");
+    assertTest(orthogonalityError(b.vectors) < 1e-14 * n, "Wektory macierzy blokowej nie są ortogonalne");
+}
+
+/**
+ * Test 4: Wartości z przedziału i o zadanych numerach (bisekcja i odwrotna iteracja)
+ */
+void EigenTest4() {
+    const size_t n = 300;
+    numlib::Matrix A = randomSymmetric(n, 11);
+    numlib::EigenDecomposition all = numlib::SymmetricEigen(A, false);
+
+    double lower = -3.0, upper = 5.0;
+    numlib::EigenDecomposition r = numlib::SymmetricEigenRange(A, lower, upper);
+    vector<double> expected;
+    for (double v : all.values) {
+        if (v > lower && v <= upper) expected.push_back(v);
+    }
+    assertTest(!expected.empty() && r.values.size() == expected.size(), "Nieprawidłowa liczba wartości w przedziale");
+    for (size_t k = 0; k < expected.size(); k++) {
+        assertTest(abs(r.values[k] - expected[k]) < 1e-12, "Błędna wartość z przedziału");
+    }
+    assertTest(r.vectors.rows() == n && r.vectors.cols() == expected.size(), "Nieprawidłowe wymiary wektorów");
+    assertTest(eigenResidual(A, r) < 1e-13, "Za duże residuum wektorów z przedziału");
+    assertTest(orthogonalityError(r.vectors) < 1e-12, "Wektory z przedziału nie są ortogonalne");
+
+    numlib::EigenDecomposition top = numlib::SymmetricEigenIndex(A, n - 5, n - 1);
+    assertTest(top.values.size() == 5, "Nieprawidłowa liczba wartości o zadanych numerach");
+    for (size_t k = 0; k < 5; k++) {
+        assertTest(abs(top.values[k] - all.values[n - 5 + k]) < 1e-12, "Błędna wartość o zadanym numerze");
+    }
+    assertTest(eigenResidual(A, top) < 1e-13, "Za duże residuum wektorów o zadanych numerach");
+
+    // Skupisko wartości wielokrotnych - odwrotna iteracja z ortogonalizacją
+    vector<double> spectrum;
+    for (int k = 0; k < 60; k++) spectrum.push_back(k < 20 ? 1.0 : 1.0 + k);
+    numlib::Matrix B = withSpectrum(spectrum, 5);
+    numlib::EigenDecomposition cluster = numlib::SymmetricEigenRange(B, 0.5, 1.5);
+    assertTest(cluster.values.size() == 20, "Nieprawidłowa liczba wartości w skupisku");
+    assertTest(eigenResidual(B, cluster) < 1e-13, "Za duże residuum wektorów skupiska");
+    assertTest(orthogonalityError(cluster.vectors) < 1e-12, "Wektory skupiska nie są ortogonalne");
+}
+
+/**
+ * Test 5: Wynik nie zależy od liczby wątków
+ */
+void EigenTest5() {
+    const size_t n = 700;
+    numlib::Matrix A = randomSymmetric(n, 21);
+    numlib::setNumThreads(1);
+    numlib::EigenDecomposition one = numlib::SymmetricEigen(A);
+    numlib::setNumThreads(4);
+    numlib::EigenDecomposition four = numlib::SymmetricEigen(A);
+    numlib::setNumThreads(0);
+    for (size_t i = 0; i < n; i++) {
+        assertTest(one.values[i] == four.values[i], "Wartości zależą od liczby wątków");
+        for (size_t j = 0; j < n; j++) {
+            assertTest(one.vectors(i, j) == four.vectors(i, j), "Wektory zależą od liczby wątków");
+        }
+    }
+    assertTest(eigenResidual(A, one) < 1e-14 * n, "Za duże residuum dla n = 700");
+}
+
+/**
+ * Test 6: Nieprawidłowe argumenty
+ */
+void EigenTest6() {
+    bool thrown = false;
+    try {
+        numlib::SymmetricEigen(numlib::Matrix(3, 4));
+    } catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Brak wyjątku dla macierzy niekwadratowej");
+
+    thrown = false;
+    try {
+        numlib::TridiagonalEigen({1.0, 2.0}, {1.0, 2.0});
+    } catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Brak wyjątku dla niezgodnych długości d i e");
+
+    thrown = false;
+    try {
+        numlib::SymmetricEigenIndex(numlib::Matrix::identity(3), 1, 3);
+    } catch (const invalid_argument&) {
+        thrown = true;
+    }
+    assertTest(thrown, "Brak wyjątku dla numeru poza zakresem");
+
+    numlib::EigenDecomposition empty = numlib::SymmetricEigenRange(numlib::Matrix::identity(4), 2.0, 3.0);
+    assertTest(empty.values.empty(), "Przedział bez wartości własnych powinien dać pusty wynik");
+    numlib::EigenDecomposition one = numlib::SymmetricEigen(numlib::Matrix(1, 1, 5.0));
+    assertTest(one.values[0] == 5.0 && one.vectors(0, 0) == 1.0, "Błędny wynik dla macierzy 1 x 1");
+}
+
+int main() {
+    int passedTests = 0;
+    int totalTests = 6;
+
+    if (runTest("Test1", EigenTest1)) passedTests++;
+    if (runTest("Test2", EigenTest2)) passedTests++;
+    if (runTest("Test3", EigenTest3)) passedTests++;
+    if (runTest("Test4", EigenTest4)) passedTests++;
+    if (runTest("Test5", EigenTest5)) passedTests++;
+    if (runTest("Test6", EigenTest6)) passedTests++;
+
+    cout << "\n=== Podsumowanie testów ===" << endl;
+    cout << "Przeszło: " << passedTests << "/" << totalTests << endl;
+
+    return passedTests != totalTests;
+}